@@ -0,0 +1,52 @@
+#ifndef BENCHMARKS_BENCHMARK_HPP
+#define BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+
+// Note(3011):
+// Minimal timing helpers shared by the benchmark executables. A benchmark
+// runs its kernel a few times and reports the fastest run, which is the
+// least disturbed by the rest of the system. Kernels write their results
+// to memory that ends up in a checksum printed at the end, so the compiler
+// cannot drop the work. Numbers are only meaningful in optimized builds.
+
+namespace Benchmark
+{
+    inline constexpr int Repetitions = 7;
+
+    // Note(3011): Runs func, which processes count items, and prints and
+    // returns the best time per item in nanoseconds.
+    template <typename Func>
+    double Run(const char* name, std::size_t count, Func&& func)
+    {
+        double best = std::numeric_limits<double>::infinity();
+        for (int i = 0; i < Repetitions; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        const double perItem = best / static_cast<double>(count);
+        std::printf("  %-36s %10.2f ns\n", name, perItem);
+        return perItem;
+    }
+
+    // Note(3011): Prints the speedup of a measurement over its baseline.
+    inline void Compare(const char* name, double baseline, double measured)
+    {
+        std::printf("  %-36s %10.2fx\n", name, baseline / measured);
+    }
+
+    inline void Checksum(double value)
+    {
+        std::printf("checksum %g\n", value);
+    }
+}
+
+#endif //BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,148 @@
+#include "Benchmark.hpp"
+
+#include <Math/Random.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+// Note(3011):
+// Times importance sampling with Distribution1D and Distribution2D against
+// uniform sampling, which is the cost the importance sampling adds, and
+// the guide table of Distribution1D against a plain binary search of the
+// same CDF.
+
+namespace
+{
+    constexpr std::size_t Count = 1 << 20;
+
+    // Note(3011): A bright spot on a dim background, similar to an
+    // environment map with a sun.
+    std::vector<f32> MakeImage(std::size_t width, std::size_t height)
+    {
+        std::vector<f32> result(width * height);
+        for (std::size_t y = 0; y < height; ++y)
+        {
+            for (std::size_t x = 0; x < width; ++x)
+            {
+                const double dx = static_cast<double>(x) / width - 0.7;
+                const double dy = static_cast<double>(y) / height - 0.3;
+                result[y * width + x] = Math::Cast<f32>(0.1 + 1000.0 * std::exp(-400.0 * (dx * dx + dy * dy)));
+            }
+        }
+        return result;
+    }
+
+    std::vector<f32> MakeUniforms()
+    {
+        Math::Random64 rng(1);
+        const Math::UniformUnitDistribution<f32> unit;
+
+        std::vector<f32> result(2 * Count);
+        for (f32& u : result)
+        {
+            u = unit(rng);
+        }
+        return result;
+    }
+
+    double Run2D(const std::vector<f32>& uniforms)
+    {
+        constexpr std::size_t Width = 512;
+        constexpr std::size_t Height = 256;
+        const std::vector<f32> image = MakeImage(Width, Height);
+        const Math::Distribution2D<f32> distribution(image, Width, Height);
+        std::vector<f32> pdfs(Count);
+
+        std::printf("Distribution2D %zux%zu\n", Width, Height);
+        const double baseline = Benchmark::Run("uniform", Count, [&]()
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                const std::size_t x = std::min(static_cast<std::size_t>(Math::ToUnderlying(uniforms[2 * i] * Math::Cast<f32>(Width))), Width - 1);
+                const std::size_t y = std::min(static_cast<std::size_t>(Math::ToUnderlying(uniforms[2 * i + 1] * Math::Cast<f32>(Height))), Height - 1);
+                pdfs[i] = image[y * Width + x];
+            }
+        });
+        double checksum = 0.0;
+        for (f32 pdf : pdfs)
+        {
+            checksum += static_cast<double>(Math::ToUnderlying(pdf));
+        }
+
+        const double measured = Benchmark::Run("SampleContinuous", Count, [&]()
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                pdfs[i] = distribution.SampleContinuous(Math::Vector2f(uniforms[2 * i], uniforms[2 * i + 1])).PDF;
+            }
+        });
+        for (f32 pdf : pdfs)
+        {
+            checksum += static_cast<double>(Math::ToUnderlying(pdf));
+        }
+        Benchmark::Compare("SampleContinuous over uniform", baseline, measured);
+        return checksum;
+    }
+
+    double Run1D(const std::vector<f32>& uniforms)
+    {
+        constexpr std::size_t Size = 1 << 16;
+        const std::vector<f32> function = MakeImage(Size, 1);
+        const Math::Distribution1D<f32> distribution(function);
+
+        std::vector<f32> cdf(Size + 1);
+        double sum = 0.0;
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            sum += static_cast<double>(Math::ToUnderlying(function[i]));
+            cdf[i + 1] = Math::Cast<f32>(sum);
+        }
+        for (f32& value : cdf)
+        {
+            value = Math::Cast<f32>(static_cast<double>(Math::ToUnderlying(value)) / sum);
+        }
+
+        std::vector<std::size_t> indices(Count);
+
+        std::printf("Distribution1D %zu\n", Size);
+        const double baseline = Benchmark::Run("binary search", Count, [&]()
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                indices[i] = std::upper_bound(cdf.begin() + 1, cdf.end() - 1, uniforms[i]) - cdf.begin() - 1;
+            }
+        });
+        double checksum = 0.0;
+        for (std::size_t index : indices)
+        {
+            checksum += static_cast<double>(index);
+        }
+
+        const double measured = Benchmark::Run("SampleDiscrete", Count, [&]()
+        {
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                indices[i] = Math::ToUnderlying(distribution.SampleDiscrete(uniforms[i]).Index);
+            }
+        });
+        for (std::size_t index : indices)
+        {
+            checksum += static_cast<double>(index);
+        }
+        Benchmark::Compare("SampleDiscrete over binary search", baseline, measured);
+        return checksum;
+    }
+}
+
+int main()
+{
+    const std::vector<f32> uniforms = MakeUniforms();
+
+    double checksum = Run2D(uniforms);
+    checksum += Run1D(uniforms);
+    Benchmark::Checksum(checksum);
+    return 0;
+}
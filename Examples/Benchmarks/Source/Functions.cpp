@@ -0,0 +1,137 @@
+#include "Benchmark.hpp"
+
+#include <Math/Functions.hpp>
+#include <Math/Packet.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+// Note(3011):
+// Times the polynomial Sin, Cos and Atan2 and Fast::Exp against <cmath>
+// over the same inputs, for scalars and for packets of the same scalars.
+
+namespace
+{
+    constexpr std::size_t Count = 1 << 14;
+    constexpr int Rounds = 64;
+
+    template <typename T>
+    std::vector<T> MakeInputs(double begin, double end, int seed)
+    {
+        // Note(3011): Same odd stride as the trigonometric tests, so the
+        // inputs don't follow the branch pattern of an ordered sweep.
+        std::vector<T> result(Count);
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            const double t = static_cast<double>((i * 7919 + seed) % Count) / Count;
+            result[i] = Math::Cast<T>(begin + (end - begin) * t);
+        }
+        return result;
+    }
+
+    template <typename T>
+    double Sum(const std::vector<T>& values)
+    {
+        double sum = 0.0;
+        for (T value : values)
+        {
+            sum += static_cast<double>(Math::ToUnderlying(value));
+        }
+        return sum;
+    }
+
+    // Note(3011): func takes two inputs, so one signature covers the unary
+    // functions and Atan2. The packet variant takes P::Size inputs per call.
+    template <typename T, typename Func>
+    double TimeScalar(const char* name, const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& out, Func&& func)
+    {
+        return Benchmark::Run(name, Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    out[i] = func(a[i], b[i]);
+                }
+            }
+        });
+    }
+
+    template <typename P, typename T, typename Func>
+    double TimePacket(const char* name, const std::vector<T>& a, const std::vector<T>& b, std::vector<T>& out, Func&& func)
+    {
+        return Benchmark::Run(name, Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; i += Math::ToUnderlying(P::Size))
+                {
+                    func(P::Load(&a[i]), P::Load(&b[i])).Store(&out[i]);
+                }
+            }
+        });
+    }
+
+    template <typename T, typename P>
+    double RunFunctions(const char* label)
+    {
+        using Raw = Math::UnderlyingType<T>;
+
+        const std::vector<T> angles = MakeInputs<T>(-100.0, 100.0, 0);
+        const std::vector<T> y = MakeInputs<T>(-10.0, 10.0, 1);
+        const std::vector<T> x = MakeInputs<T>(-10.0, 10.0, 2);
+        const std::vector<T> exponents = MakeInputs<T>(-80.0, 80.0, 3);
+        std::vector<T> out(Count);
+        double checksum = 0.0;
+
+        std::printf("%s\n", label);
+
+        double baseline = TimeScalar("std::sin", angles, angles, out, [](T a, T) { return T(std::sin(Math::ToUnderlying(a))); });
+        checksum += Sum(out);
+        double measured = TimeScalar("Math::Sin", angles, angles, out, [](T a, T) { return Math::Sin(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Sin over std::sin", baseline, measured);
+        measured = TimePacket<P>("Math::Sin packet", angles, angles, out, [](P a, P) { return Math::Sin(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Sin packet over std::sin", baseline, measured);
+
+        baseline = TimeScalar("std::cos", angles, angles, out, [](T a, T) { return T(std::cos(Math::ToUnderlying(a))); });
+        checksum += Sum(out);
+        measured = TimeScalar("Math::Cos", angles, angles, out, [](T a, T) { return Math::Cos(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Cos over std::cos", baseline, measured);
+        measured = TimePacket<P>("Math::Cos packet", angles, angles, out, [](P a, P) { return Math::Cos(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Cos packet over std::cos", baseline, measured);
+
+        baseline = TimeScalar("std::atan2", y, x, out, [](T a, T b) { return T(std::atan2(Math::ToUnderlying(a), Math::ToUnderlying(b))); });
+        checksum += Sum(out);
+        measured = TimeScalar("Math::Atan2", y, x, out, [](T a, T b) { return Math::Atan2(a, b); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Atan2 over std::atan2", baseline, measured);
+        measured = TimePacket<P>("Math::Atan2 packet", y, x, out, [](P a, P b) { return Math::Atan2(a, b); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Atan2 packet over std::atan2", baseline, measured);
+
+        baseline = TimeScalar("std::exp", exponents, exponents, out, [](T a, T) { return T(std::exp(Raw(Math::ToUnderlying(a)))); });
+        checksum += Sum(out);
+        measured = TimeScalar("Math::Fast::Exp", exponents, exponents, out, [](T a, T) { return Math::Fast::Exp(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Fast::Exp over std::exp", baseline, measured);
+        measured = TimePacket<P>("Math::Fast::Exp packet", exponents, exponents, out, [](P a, P) { return Math::Fast::Exp(a); });
+        checksum += Sum(out);
+        Benchmark::Compare("Math::Fast::Exp packet over std::exp", baseline, measured);
+
+        return checksum;
+    }
+}
+
+int main()
+{
+    double checksum = RunFunctions<f32, Math::Packet8f>("f32");
+    checksum += RunFunctions<f64, Math::Packet4d>("f64");
+    Benchmark::Checksum(checksum);
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "Benchmark.hpp"
+
+#include <Math/Vector.hpp>
+
+#include <vector>
+
+using namespace Math::Types;
+
+// Note(3011):
+// Compiled twice, once with MATH_ENABLE_SIMD and once without, so that the
+// two executables time the SIMD and the scalar path of the same code.
+
+namespace
+{
+    constexpr std::size_t Count = 4096;
+    constexpr int Rounds = 256;
+
+    template <typename Vec>
+    std::vector<Vec> MakeVectors(f32 offset)
+    {
+        std::vector<Vec> result(Count);
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            const f32 x = Math::Cast<f32>(i % 17) + offset;
+            const f32 y = Math::Cast<f32>(i % 13) - offset;
+            const f32 z = Math::Cast<f32>(i % 7) * offset + 1;
+            if constexpr (Vec::Dimension == 3)
+            {
+                result[i] = Vec(x, y, z);
+            }
+            else
+            {
+                result[i] = Vec(x, y, z, offset);
+            }
+        }
+        return result;
+    }
+
+    template <typename Vec>
+    double Sum(const std::vector<Vec>& values)
+    {
+        f32 sum = 0;
+        for (const Vec& value : values)
+        {
+            sum += Math::Dot(value, value);
+        }
+        return Math::ToUnderlying(Math::Cast<f64>(sum));
+    }
+
+    template <typename Vec>
+    double RunVector(const char* label)
+    {
+        const std::vector<Vec> a = MakeVectors<Vec>(0.5f);
+        const std::vector<Vec> b = MakeVectors<Vec>(1.5f);
+        const std::vector<Vec> c = MakeVectors<Vec>(2.5f);
+        std::vector<Vec> out(Count);
+        std::vector<f32> dots(Count);
+
+        std::printf("%s\n", label);
+        Benchmark::Run("a * b + c", Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    out[i] = a[i] * b[i] + c[i];
+                }
+            }
+        });
+        double checksum = Sum(out);
+
+        Benchmark::Run("(a - b) / 2", Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    out[i] = (a[i] - b[i]) / 2;
+                }
+            }
+        });
+        checksum += Sum(out);
+
+        Benchmark::Run("Dot", Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    dots[i] = Math::Dot(a[i], b[i]);
+                }
+            }
+        });
+        for (f32 dot : dots)
+        {
+            checksum += Math::ToUnderlying(Math::Cast<f64>(dot));
+        }
+
+        Benchmark::Run("Normalize", Count * Rounds, [&]()
+        {
+            for (int r = 0; r < Rounds; ++r)
+            {
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    out[i] = Math::Normalize(a[i]);
+                }
+            }
+        });
+        checksum += Sum(out);
+
+        if constexpr (Vec::Dimension == 3)
+        {
+            Benchmark::Run("Cross", Count * Rounds, [&]()
+            {
+                for (int r = 0; r < Rounds; ++r)
+                {
+                    for (std::size_t i = 0; i < Count; ++i)
+                    {
+                        out[i] = Math::Cross(a[i], b[i]);
+                    }
+                }
+            });
+            checksum += Sum(out);
+        }
+        return checksum;
+    }
+}
+
+int main()
+{
+#if defined(MATH_ENABLE_SIMD)
+    std::printf("Vector arithmetic, SIMD path\n");
+#else
+    std::printf("Vector arithmetic, scalar path\n");
+#endif
+
+    double checksum = RunVector<Math::Vector3f>("Vector3f");
+    checksum += RunVector<Math::Vector4f>("Vector4f");
+    Benchmark::Checksum(checksum);
+    return 0;
+}
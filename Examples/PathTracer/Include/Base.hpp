@@ -23,7 +23,7 @@ namespace PathTracer
     using Math::Matrix4f;
     using Math::Transform3f;
 
-    using RNG = Math::Random64;
+    using RNG = Math::SobolSampler;
     using Uniform = Math::UniformUnitDistribution<f32>;
 
     using Ray = Math::Geometry::Ray<f32>;
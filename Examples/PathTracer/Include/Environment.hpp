@@ -0,0 +1,41 @@
+#ifndef MATHLIB_EXAMPLES_PATHTRACER_ENVIRONMENT_HPP
+#define MATHLIB_EXAMPLES_PATHTRACER_ENVIRONMENT_HPP
+
+#include "Base.hpp"
+
+#include <vector>
+
+namespace PathTracer
+{
+    struct EnvironmentSample
+    {
+        Vector3f Direction;
+        Vector3f Radiance;
+        f32 PDF;
+    };
+
+    // Note(3011): Latitude-longitude map around the y axis, importance
+    // sampled by luminance. There is no image loader yet, so the map holds
+    // a procedural sky with a sun, but it is sampled like an HDRI would be.
+    class Environment
+    {
+    public:
+        Environment(SizeType width, SizeType height);
+
+        EnvironmentSample Sample(RNG& rng) const;
+
+        Vector3f Evaluate(const Vector3f& direction) const;
+        f32 PDF(const Vector3f& direction) const;
+    private:
+        Vector2f ToMap(const Vector3f& direction) const;
+        Vector3f FromMap(const Vector2f& point) const;
+        const Vector3f& Texel(const Vector2f& point) const;
+
+        SizeType mWidth;
+        SizeType mHeight;
+        std::vector<Vector3f> mRadiance;
+        Math::Distribution2D<f32> mDistribution;
+    };
+}
+
+#endif //MATHLIB_EXAMPLES_PATHTRACER_ENVIRONMENT_HPP
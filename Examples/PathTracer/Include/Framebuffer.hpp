@@ -3,6 +3,8 @@
 
 #include "Base.hpp"
 
+#include <Math/SoAArray.hpp>
+
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -29,12 +31,14 @@ namespace PathTracer
 
         bool Save(const fs::path& filename, ImageEncoding encoding = ImageEncoding::HDR) const;
 
-        Vector3f& operator() (SizeType x, SizeType y);
-        const Vector3f& operator() (SizeType x, SizeType y) const;
+        // Note(3011): The pixels are stored one channel at a time, so the
+        // non-const access returns a proxy that writes through.
+        Math::SoAArray<Vector3f>::Reference operator() (SizeType x, SizeType y);
+        Vector3f operator() (SizeType x, SizeType y) const;
     private:
         SizeType mWidth;
         SizeType mHeight;
-        std::vector<Vector3f> mBuffer;
+        Math::SoAArray<Vector3f> mBuffer;
     };
 }
 
@@ -24,6 +24,7 @@ namespace PathTracer
             virtual LightSample Sample(RNG& rng, const Point3f& distantPoint) const = 0;
             virtual Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const = 0;
             virtual f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const = 0;
+            virtual f32 Power() const = 0;
             virtual ~GenericLight() {}
         };
 
@@ -49,6 +50,11 @@ namespace PathTracer
             {
                 return mLight.PDF(distantPoint, lightPoint);
             }
+
+            f32 Power() const override
+            {
+                return mLight.Power();
+            }
         private:
             LightType mLight;
         };
@@ -72,6 +78,13 @@ namespace PathTracer
         {
             return mLight->PDF(distantPoint, lightPoint);
         }
+
+        // Note(3011): Emitted power of the brightest channel, lights are
+        // picked in proportion to it.
+        f32 Power() const
+        {
+            return mLight->Power();
+        }
     private:
         std::unique_ptr<GenericLight> mLight;
     };
@@ -85,6 +98,7 @@ namespace PathTracer
 
         Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const;
         f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const;
+        f32 Power() const;
     private:
         Point3f  mPosition;
         Vector3f mEmission;
@@ -99,6 +113,7 @@ namespace PathTracer
 
         Vector3f Evaluate(const Point3f& distantPoint, const Point3f& lightPoint) const;
         f32 PDF(const Point3f& distantPoint, const Point3f& lightPoint) const;
+        f32 Power() const;
     private:
         Sphere mSphere;
         Vector3f mEmission;
@@ -3,6 +3,7 @@
 
 #include "Base.hpp"
 #include "Camera.hpp"
+#include "Environment.hpp"
 #include "Light.hpp"
 #include "Material.hpp"
 
@@ -15,6 +16,7 @@ namespace PathTracer
     {
     public:
         using Interval = Math::Geometry::Interval<f32>;
+        using LightDistribution = Math::DiscreteDistribution<f32>;
         struct Intersection
         {
             bool IsValid() const;
@@ -97,11 +99,19 @@ namespace PathTracer
         bool HasIntersection(const Ray& ray, const Interval& interval) const;
 
         const Camera& GetCamera() const;
+        const Environment& GetEnvironment() const;
         std::span<const Light> GetLights() const;
+
+        // Note(3011): Picks one of the lights in proportion to its power,
+        // LightPDF is the probability a light is picked with.
+        LightDistribution::SampleType SampleLight(RNG& rng) const;
+        f32 LightPDF(const Light& light) const;
     private:
         Camera mCamera;
+        Environment mEnvironment;
         std::vector<Object> mObjects;
         std::vector<Light> mLights;
+        LightDistribution mLightDistribution;
         std::vector<Material> mMaterials;
     };
 }
@@ -17,8 +17,10 @@ int main(int argc, char **argv)
 
     Math::Vector2sz resolution(1920, 1080);
 
-    PathTracer::RNG commonRng(15);
-    Math::UniformUnitDistribution<f32> dist;
+    // Note(3011): Every pixel scrambles its own Sobol sequence and every
+    // sample reads the point of its index, so the image doesn't depend on
+    // how the samples are split between threads.
+    const u32 seed = 15;
 
     // "Scene"
     PathTracer::Scene scene(resolution);
@@ -30,6 +32,7 @@ int main(int argc, char **argv)
     SizeType hwThreads = std::thread::hardware_concurrency();
     SizeType totalSamples = 4;
     SizeType samplesRemainder = totalSamples % hwThreads;
+    SizeType firstSample = 0;
     for (SizeType i = 0; i < hwThreads; ++i)
     {
         SizeType samples = totalSamples / hwThreads + ((samplesRemainder > 0) ? 1 : 0);
@@ -41,16 +44,16 @@ int main(int argc, char **argv)
         {
             continue;
         }
-        PathTracer::RNG rng = commonRng.Jump();
-        threads.push_back(std::thread([samples, rng, resolution, &scene, &fb, &fbMutex]() mutable {
+        threads.push_back(std::thread([samples, firstSample, seed, resolution, &scene, &fb, &fbMutex]() {
             PathTracer::Uniform dist;
             PathTracer::Framebuffer localFramebuffer(fb.Size());
-            for (SizeType sample = 0; sample < samples; ++sample)
+            for (SizeType sample = firstSample; sample < firstSample + samples; ++sample)
             {
                 for (SizeType y = 0; y < resolution.y; ++y)
                 {
                     for (SizeType x = 0; x < resolution.x; ++x)
                     {
+                        PathTracer::RNG rng(Math::Cast<u32>(y * resolution.x + x) ^ seed, Math::Cast<u32>(sample));
                         f32 xf = Math::Cast<f32>(x) + dist(rng);
                         f32 yf = Math::Cast<f32>(y) + dist(rng);
                         PathTracer::Ray ray = scene.GetCamera().GenerateRay({xf, yf});
@@ -65,7 +68,12 @@ int main(int argc, char **argv)
                         {
                             if (!intersection.IsValid())
                             {
-                                // HDRI handling goes here.
+                                // Note(3011): Later bounces see the environment
+                                // through the BRDF sampling below.
+                                if (bounce == 0)
+                                {
+                                    accumulator += scene.GetEnvironment().Evaluate(ray.Direction);
+                                }
                                 break;
                             }
 
@@ -85,17 +93,28 @@ int main(int argc, char **argv)
 
                             PathTracer::Vector3f mis(0.0f);
                             {   // Explicit lightsource sampling
-                                for (const auto& light : scene.GetLights())
+                                const auto choice = scene.SampleLight(rng);
+                                const PathTracer::Light& light = scene.GetLights()[Math::ToUnderlying(choice.Index)];
+                                PathTracer::LightSample sample = light.Sample(rng, intersectedPoint);
+                                PathTracer::Ray lightRay(intersectedPoint, sample.OutgoingDirection);
+                                PathTracer::Vector3f outgoingDirection = intersectedBase * sample.OutgoingDirection;
+                                f32 cosTheta = Math::Dot(intersection.Normal, lightRay.Direction);
+                                f32 brdfPdf = Math::Equal(sample.PDF, 1.0f) ? 0.0f : intersection.Material->PDF(incomingDirection, outgoingDirection);
+                                if (cosTheta > 0.0f && sample.Intensity.Max() > 0.0f && !scene.HasIntersection(lightRay, {Math::Constant::GeometryEpsilon<f32>, sample.Distance - 2.0f * Math::Constant::GeometryEpsilon<f32>}))
                                 {
-                                    PathTracer::LightSample sample = light.Sample(rng, intersectedPoint);
-                                    PathTracer::Ray lightRay(intersectedPoint, sample.OutgoingDirection);
-                                    PathTracer::Vector3f outgoingDirection = intersectedBase * sample.OutgoingDirection;
-                                    f32 cosTheta = Math::Dot(intersection.Normal, lightRay.Direction);
-                                    f32 brdfPdf = Math::Equal(sample.PDF, 1.0f) ? 0.0f : intersection.Material->PDF(incomingDirection, outgoingDirection);
-                                    if (cosTheta > 0.0f && sample.Intensity.Max() > 0.0f && !scene.HasIntersection(lightRay, {Math::Constant::GeometryEpsilon<f32>, sample.Distance - 2.0f * Math::Constant::GeometryEpsilon<f32>}))
-                                    {
-                                        mis += (intersection.Material->BRDF(incomingDirection, outgoingDirection) * sample.Intensity * cosTheta) / (sample.PDF + brdfPdf);
-                                    }
+                                    mis += (intersection.Material->BRDF(incomingDirection, outgoingDirection) * sample.Intensity * cosTheta) / (choice.PDF * sample.PDF + brdfPdf);
+                                }
+                            }
+                            {   // Explicit environment sampling
+                                const PathTracer::Environment& environment = scene.GetEnvironment();
+                                PathTracer::EnvironmentSample sample = environment.Sample(rng);
+                                PathTracer::Ray environmentRay(intersectedPoint, sample.Direction);
+                                PathTracer::Vector3f outgoingDirection = intersectedBase * sample.Direction;
+                                f32 cosTheta = Math::Dot(intersection.Normal, sample.Direction);
+                                if (cosTheta > 0.0f && sample.PDF > 0.0f && !scene.HasIntersection(environmentRay, {Math::Constant::GeometryEpsilon<f32>}))
+                                {
+                                    f32 brdfPdf = intersection.Material->PDF(incomingDirection, outgoingDirection);
+                                    mis += (intersection.Material->BRDF(incomingDirection, outgoingDirection) * sample.Radiance * cosTheta) / (sample.PDF + brdfPdf);
                                 }
                             }
                             {   // BRDF sampling
@@ -109,7 +128,12 @@ int main(int argc, char **argv)
                                 if (intersection.Light && cosTheta > 0.0f && sample.Intensity.Max() > 0.0f)
                                 {
                                     PathTracer::Point3f lightPoint = ray.Project(intersection.Distance);
-                                    mis += sample.Intensity * intersection.Light->Evaluate(intersectedPoint, lightPoint) * cosTheta / (sample.PDF + intersection.Light->PDF(intersectedPoint, lightPoint));
+                                    mis += sample.Intensity * intersection.Light->Evaluate(intersectedPoint, lightPoint) * cosTheta / (sample.PDF + scene.LightPDF(*intersection.Light) * intersection.Light->PDF(intersectedPoint, lightPoint));
+                                }
+                                else if (!intersection.IsValid() && cosTheta > 0.0f && sample.Intensity.Max() > 0.0f)
+                                {
+                                    const PathTracer::Environment& environment = scene.GetEnvironment();
+                                    mis += sample.Intensity * environment.Evaluate(outgoingDirection) * cosTheta / (sample.PDF + environment.PDF(outgoingDirection));
                                 }
 
                                 accumulator += throughput * mis;
@@ -141,6 +165,7 @@ int main(int argc, char **argv)
                 fb.Add(localFramebuffer);
             }
         }));
+        firstSample += samples;
     }
 
     // We need to wait for the computation in all threads to finish.
@@ -0,0 +1,93 @@
+#include "Environment.hpp"
+
+namespace PathTracer
+{
+    Environment::Environment(SizeType width, SizeType height)
+        : mWidth(width), mHeight(height), mRadiance(Math::ToUnderlying(width * height)), mDistribution()
+    {
+        const Vector3f sun = Math::Normalize(Vector3f(0.4f, 0.6f, -0.7f));
+        const Vector3f zenith(0.15f, 0.3f, 0.6f);
+        const Vector3f horizon(0.6f, 0.65f, 0.7f);
+        const Vector3f ground(0.05f, 0.045f, 0.04f);
+
+        // Note(3011): Texels are weighted by their solid angle, which
+        // shrinks towards the poles with the sine of theta.
+        std::vector<f32> luminance(mRadiance.size());
+        for (SizeType y = 0; y < height; ++y)
+        {
+            for (SizeType x = 0; x < width; ++x)
+            {
+                const Vector2f point((Math::Cast<f32>(x) + 0.5f) / Math::Cast<f32>(width), (Math::Cast<f32>(y) + 0.5f) / Math::Cast<f32>(height));
+                const Vector3f direction = FromMap(point);
+
+                Vector3f radiance = direction.y > 0.0f ? horizon + (zenith - horizon) * direction.y : ground;
+                if (Math::Dot(direction, sun) > 0.999f)
+                {
+                    radiance += Vector3f(200.0f, 180.0f, 150.0f);
+                }
+
+                const SizeType index = y * width + x;
+                mRadiance[Math::ToUnderlying(index)] = radiance;
+                luminance[Math::ToUnderlying(index)] = (0.2126f * radiance.x + 0.7152f * radiance.y + 0.0722f * radiance.z)
+                                                     * Math::Sin(point.y * Math::Constant::Pi<f32>);
+            }
+        }
+
+        mDistribution = Math::Distribution2D<f32>(luminance, width, height);
+    }
+
+    EnvironmentSample Environment::Sample(RNG& rng) const
+    {
+        const auto sample = mDistribution.SampleContinuous(rng);
+        const Vector3f direction = FromMap(sample.Value);
+        return {
+            .Direction = direction,
+            .Radiance = Texel(sample.Value),
+            .PDF = PDF(direction),
+        };
+    }
+
+    Vector3f Environment::Evaluate(const Vector3f& direction) const
+    {
+        return Texel(ToMap(direction));
+    }
+
+    f32 Environment::PDF(const Vector3f& direction) const
+    {
+        // Note(3011): From the density over the map to the density over
+        // solid angle, the map stretches [0, 1)^2 over 2 pi by pi.
+        const Vector2f point = ToMap(direction);
+        const f32 sinTheta = Math::Sin(point.y * Math::Constant::Pi<f32>);
+        if (sinTheta <= 0.0f)
+        {
+            return 0.0f;
+        }
+        return mDistribution.PDF(point) / (2.0f * Math::Squared(Math::Constant::Pi<f32>) * sinTheta);
+    }
+
+    Vector2f Environment::ToMap(const Vector3f& direction) const
+    {
+        f32 phi = Math::Atan2(direction.z, direction.x);
+        if (phi < 0.0f)
+        {
+            phi += Math::Constant::Tau<f32>;
+        }
+        const f32 theta = Math::Acos(Math::Clamp(direction.y, f32(-1.0f), f32(1.0f)));
+        return { phi / Math::Constant::Tau<f32>, theta / Math::Constant::Pi<f32> };
+    }
+
+    Vector3f Environment::FromMap(const Vector2f& point) const
+    {
+        const f32 phi = point.x * Math::Constant::Tau<f32>;
+        const f32 theta = point.y * Math::Constant::Pi<f32>;
+        const f32 sinTheta = Math::Sin(theta);
+        return { sinTheta * Math::Cos(phi), Math::Cos(theta), sinTheta * Math::Sin(phi) };
+    }
+
+    const Vector3f& Environment::Texel(const Vector2f& point) const
+    {
+        const SizeType x = Math::Min(Math::Cast<SizeType>(point.x * Math::Cast<f32>(mWidth)), mWidth - 1);
+        const SizeType y = Math::Min(Math::Cast<SizeType>(point.y * Math::Cast<f32>(mHeight)), mHeight - 1);
+        return mRadiance[Math::ToUnderlying(y * mWidth + x)];
+    }
+}
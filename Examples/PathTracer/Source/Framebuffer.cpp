@@ -6,11 +6,11 @@
 namespace PathTracer
 {
     Framebuffer::Framebuffer(SizeType width, SizeType height)
-        : mWidth(width), mHeight(height), mBuffer(Math::ToUnderlying(width * height), Vector3f(0.0f))
+        : mWidth(width), mHeight(height), mBuffer(width * height, Vector3f(0.0f))
     {}
 
     Framebuffer::Framebuffer(Vector2sz size)
-        : mWidth(size.x), mHeight(size.y), mBuffer(Math::ToUnderlying(size.x * size.y), Vector3f(0.0f))
+        : mWidth(size.x), mHeight(size.y), mBuffer(size.x * size.y, Vector3f(0.0f))
     {}
 
     Vector2sz Framebuffer::Size() const
@@ -20,18 +20,12 @@ namespace PathTracer
 
     void Framebuffer::Add(const Framebuffer& other)
     {
-        for (SizeType i = 0; i < mBuffer.size(); ++i)
-        {
-            mBuffer[Math::ToUnderlying(i)] += other.mBuffer[Math::ToUnderlying(i)];
-        }
+        mBuffer += other.mBuffer;
     }
 
     void Framebuffer::Scale(f32 scale)
     {
-        for (SizeType i = 0; i < mBuffer.size(); ++i)
-        {
-            mBuffer[Math::ToUnderlying(i)] *= scale;
-        }
+        mBuffer *= scale;
     }
 
     void Framebuffer::Flip()
@@ -40,7 +34,7 @@ namespace PathTracer
         {
             for (SizeType x = 0; x < mWidth; ++x)
             {
-                Vector3f temp = (*this)(x, y);
+                const Vector3f temp = (*this)(x, y);
                 (*this)(x, y) = (*this)(x, (mHeight - 1) - y);
                 (*this)(x, (mHeight - 1) - y) = temp;
             }
@@ -49,7 +43,7 @@ namespace PathTracer
 
     void Framebuffer::Clear()
     {
-        mBuffer.assign(mBuffer.size(), Vector3f(0.0f));
+        mBuffer.Fill(Vector3f(0.0f));
     }
 
     bool Framebuffer::Save(const fs::path& filename, ImageEncoding encoding) const
@@ -70,7 +64,7 @@ namespace PathTracer
         {
             for (SizeType i = 0; i < mWidth; ++i)
             {
-                const Vector3f& pixel = (*this)(i, j);
+                const Vector3f pixel = (*this)(i, j);
                 Math::Array<u8, 4> rgbe = { 0, 0, 0, 0 };
 
                 f32 value = Math::Max(pixel);
@@ -95,13 +89,13 @@ namespace PathTracer
         return true;
     }
 
-    Vector3f& Framebuffer::operator() (SizeType x, SizeType y)
+    Math::SoAArray<Vector3f>::Reference Framebuffer::operator() (SizeType x, SizeType y)
     {
-        return mBuffer[Math::ToUnderlying(mWidth * y + x)];
+        return mBuffer[mWidth * y + x];
     }
 
-    const Vector3f& Framebuffer::operator() (SizeType x, SizeType y) const
+    Vector3f Framebuffer::operator() (SizeType x, SizeType y) const
     {
-        return mBuffer[Math::ToUnderlying(mWidth * y + x)];
+        return mBuffer.Get(mWidth * y + x);
     }
 }
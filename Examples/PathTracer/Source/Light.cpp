@@ -12,7 +12,7 @@ namespace PathTracer
         Vector3f direction = mPosition - distantPoint;
         return {
             .OutgoingDirection = Math::Normalize(direction),
-            .Intensity = (mEmission / (4.0f * Math::Constant::Pi<f32>)) / direction.LenSqr(),
+            .Intensity = mEmission / direction.LenSqr(),
             .Distance = direction.Length(),
             .PDF = 1.0f
         };
@@ -28,6 +28,13 @@ namespace PathTracer
         return 1.0f;
     }
 
+    // Note(3011): mEmission is an intensity, it is emitted over the 4 Pi
+    // steradians around the light.
+    f32 PointLight::Power() const
+    {
+        return mEmission.Max() * 4.0f * Math::Constant::Pi<f32>;
+    }
+
 
     SphericalLight::SphericalLight(const Sphere& sphere, const Vector3f& emission)
         : mSphere(sphere), mEmission(emission)
@@ -57,4 +64,9 @@ namespace PathTracer
     {
         return 1.0f / (4.0f * Math::Constant::Pi<f32> * Math::Squared(mSphere.Radius));
     }
+
+    f32 SphericalLight::Power() const
+    {
+        return mEmission.Max() * 4.0f * Math::Squared(Math::Constant::Pi<f32> * mSphere.Radius);
+    }
 }
@@ -30,8 +30,10 @@ namespace PathTracer
 
     Scene::Scene(const Vector2sz& resolution)
         : mCamera({0.0f, 0.5f, -2.0f}, {0.0f, 0.0f, 1.0f}, resolution, Math::ToRadians<f32>(90.0f)),
+          mEnvironment(512, 256),
           mObjects{},
           mLights{},
+          mLightDistribution{},
           mMaterials{Material({0.99f, 0.1f, 0.1f}), Material({0.1f, 0.1f, 0.99f}), Material({0.99f, 0.99f, 0.99f}), Material({0.1f, 0.89f, 0.1f})}
     {
         // Note(3011): I really don't like this but it doesn't matter much because it's just init code anyway.
@@ -44,11 +46,18 @@ namespace PathTracer
         mObjects.push_back({Triangle({1.5f, 0.0f, 0.0f}, {1.5f, 0.0f, 1.0f}, {1.5f, 2.0f, 1.0f}), 1});
 
         // Point light
-        // mLights.push_back({PointLight({0.8f, 0.8f, 0.0f}, Vector3f(15.0f))});
+        // mLights.push_back({PointLight({0.8f, 0.8f, 0.0f}, Vector3f(1.2f))});
 
         // (Spherical) Area light.
         mObjects.push_back({Sphere({{0.8f, 0.8f, 0.0f}, 0.2f}), 1000});
         mLights.push_back({SphericalLight({{0.8f, 0.8f, 0.0f}, 0.2f}, Vector3f(15.0f))});
+
+        std::vector<f32> powers;
+        for (const Light& light : mLights)
+        {
+            powers.push_back(light.Power());
+        }
+        mLightDistribution.Rebuild(powers);
     }
 
     Scene::Intersection Scene::Intersect(const Ray& ray, const Interval& interval) const
@@ -92,8 +101,23 @@ namespace PathTracer
         return mCamera;
     }
 
+    const Environment& Scene::GetEnvironment() const
+    {
+        return mEnvironment;
+    }
+
     std::span<const Light> Scene::GetLights() const
     {
         return mLights;
     }
+
+    Scene::LightDistribution::SampleType Scene::SampleLight(RNG& rng) const
+    {
+        return mLightDistribution.Sample(rng);
+    }
+
+    f32 Scene::LightPDF(const Light& light) const
+    {
+        return mLightDistribution.PDF(Math::Cast<SizeType>(&light - mLights.data()));
+    }
 }
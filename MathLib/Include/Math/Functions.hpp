@@ -10,5 +10,6 @@
 #include "Implementation/Functions/Angles.hpp"
 #include "Implementation/Functions/IntUtils.hpp"
 #include "Implementation/Functions/FloatUtils.hpp"
+#include "Implementation/Functions/FastFunctions.hpp"
 
 #endif //MATHLIB_FUNCTIONS_HPP
@@ -281,6 +281,43 @@ namespace Math::Concept
         requires ArithmeticType<T>;
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    // Packet concepts
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    concept Packet = requires (T p, T q)
+    {
+        typename T::ValueType;
+        typename T::MaskType;
+        { T::Size } -> IsSameBaseType<SizeType>;
+
+        requires StrongType<typename T::ValueType>;
+        requires ArithmeticType<T>;
+        requires BinaryArithmetic<T, typename T::ValueType>;
+
+        requires requires (SizeType i)
+        {
+            { p[i] } -> IsSameBaseType<typename T::ValueType>;
+        };
+
+        { p < q } -> IsSame<typename T::MaskType>;
+        { p.Sum() } -> IsSame<typename T::ValueType>;
+    };
+
+    // Note(3011): A generator that runs several streams side by side and
+    // returns one value per stream in a packet.
+    template <typename T>
+    concept PacketRandomNumberGenerator = requires(T rng)
+    {
+        requires Packet<typename T::ValueType>;
+        requires UnsignedIntegralType<typename T::ValueType::ValueType>;
+
+        { rng()          } -> IsSame<typename T::ValueType>;
+        { rng.Jump()     } -> IsSame<T>;
+        { rng.LongJump() } -> IsSame<T>;
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // Vector concepts
     //////////////////////////////////////////////////////////////////////////
@@ -384,6 +421,16 @@ namespace Math::Concept
         requires FloatingPointType<typename T::ScalarType>;
     };
 
+    // Note(3011): Packet vectors are regular vectors whose scalar type is a
+    // Packet, so they satisfy the concepts above as well. The refinements
+    // below are used to pick lane-wise overloads where the scalar code
+    // would branch on a comparison.
+    template <typename T>
+    concept PacketVector = Vector<T> && Packet<typename T::ScalarType>;
+
+    template <typename T>
+    concept PacketVector3 = Vector3<T> && Packet<typename T::ScalarType>;
+
     //////////////////////////////////////////////////////////////////////////
     // Point concepts
     //////////////////////////////////////////////////////////////////////////
@@ -471,6 +518,13 @@ namespace Math::Concept
               || Point3<T>;
     };
 
+    // Note(3011): Vectors and points of plain strong scalars, which can be
+    // split into one stream per component (see SoAArray).
+    template <typename T>
+    concept SoAElement = (BasicVector<T> || BasicPoint<T>)
+                      && StrongType<typename T::ScalarType>
+                      && std::is_trivially_copyable_v<typename T::ScalarType>;
+
     //////////////////////////////////////////////////////////////////////////
     // Matrix concepts
     //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+#ifndef MATHLIB_IMPLEMENTATION_BASE_LANES_HPP
+#define MATHLIB_IMPLEMENTATION_BASE_LANES_HPP
+
+#include "Types.hpp"
+
+#include <type_traits>
+
+// Note(3011): Helpers for function kernels that are written once against a
+// generic value type, which is either a scalar or a Packet. The kernels
+// must not branch on the argument, lanes are blended with Select instead.
+// Packets are recognized by their mask type, so this header doesn't depend
+// on Packet.hpp.
+
+namespace Math::Implementation
+{
+    template <typename V>
+    struct ScalarOf
+    {
+        using Type = V;
+    };
+
+    template <typename V>
+        requires requires { typename V::MaskType; }
+    struct ScalarOf<V>
+    {
+        using Type = typename V::ValueType;
+    };
+
+    template <typename V>
+    inline constexpr bool IsSinglePrecision = std::is_same_v<Math::UnderlyingType<typename ScalarOf<V>::Type>, float>;
+
+    // Note(3011): Scalar counterpart of Math::Select for packets. Kernels
+    // call Select unqualified, packets find theirs through ADL.
+    template <typename V>
+    [[nodiscard]] constexpr
+    V Select(bool mask, V a, V b) noexcept
+    {
+        return mask ? a : b;
+    }
+
+    // Note(3011): Scalar counterpart of PacketMask::Any, for the rare
+    // paths of a kernel that only run when one of the lanes needs them.
+    [[nodiscard]] constexpr
+    bool AnyLane(bool mask) noexcept
+    {
+        return mask;
+    }
+
+    template <typename M>
+        requires requires (const M& mask) { mask.Any(); }
+    [[nodiscard]] constexpr
+    bool AnyLane(const M& mask) noexcept
+    {
+        return mask.Any();
+    }
+
+    // Note(3011): Applies a scalar operation to every lane, used for the
+    // parts of a kernel that work on the bit representation.
+    template <typename V, typename Op>
+    [[nodiscard]] constexpr
+    V MapLanes(V val, Op op) noexcept
+    {
+        if constexpr (requires { typename V::MaskType; })
+        {
+            for (SizeType i = 0; i < V::Size; ++i)
+            {
+                val[i] = op(val[i]);
+            }
+            return val;
+        }
+        else
+        {
+            return op(val);
+        }
+    }
+
+    // Note(3011): Adding and subtracting 1.5 * 2^(digits - 1) rounds to the
+    // nearest integer in the current rounding mode for |val| below
+    // 2^(digits - 2), without converting to an integer type.
+    template <typename V>
+    [[nodiscard]] constexpr
+    V RoundToInteger(V val) noexcept
+    {
+        const V shifter = IsSinglePrecision<V> ? V(12582912.0) : V(6755399441055744.0);
+        return (val + shifter) - shifter;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_BASE_LANES_HPP
@@ -0,0 +1,87 @@
+#ifndef MATHLIB_IMPLEMENTATION_BASE_PARALLEL_HPP
+#define MATHLIB_IMPLEMENTATION_BASE_PARALLEL_HPP
+
+#include "Types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Math::Implementation
+{
+    // Note(3011): Splits [0, count) into one contiguous range per hardware
+    // thread and calls func(begin, end) for each of them. Ranges are never
+    // smaller than minRange, so small inputs stay on the calling thread,
+    // which always processes the first range itself. Every started range
+    // runs to completion, the first exception thrown by func (lowest range
+    // first) is rethrown on the calling thread after all of them finished.
+    template <typename Func>
+    void ParallelFor(std::size_t count, std::size_t minRange, Func&& func)
+    {
+        std::size_t threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        threads = std::min(threads, count / std::max<std::size_t>(minRange, 1));
+        if (threads <= 1)
+        {
+            func(std::size_t(0), count);
+            return;
+        }
+
+        const std::size_t range = (count + threads - 1) / threads;
+        std::vector<std::exception_ptr> errors(threads);
+
+        {
+            // Note(3011): jthread joins on destruction, so the workers are
+            // also joined when starting one of them throws.
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+            for (std::size_t begin = range, index = 1; begin < count; begin += range, ++index)
+            {
+                workers.emplace_back([&func, &error = errors[index], begin, end = std::min(begin + range, count)]()
+                {
+                    try
+                    {
+                        func(begin, end);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                    }
+                });
+            }
+
+            try
+            {
+                func(std::size_t(0), std::min(range, count));
+            }
+            catch (...)
+            {
+                errors[0] = std::current_exception();
+            }
+        }
+
+        for (const std::exception_ptr& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    template <Execution Policy, typename Func>
+    void ForRange(std::size_t count, std::size_t minRange, Func&& func)
+    {
+        if constexpr (Policy == Execution::Parallel)
+        {
+            ParallelFor(count, minRange, func);
+        }
+        else
+        {
+            func(std::size_t(0), count);
+        }
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_BASE_PARALLEL_HPP
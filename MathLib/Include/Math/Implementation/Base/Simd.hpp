@@ -0,0 +1,300 @@
+#ifndef MATHLIB_IMPLEMENTATION_BASE_SIMD_HPP
+#define MATHLIB_IMPLEMENTATION_BASE_SIMD_HPP
+
+// Note(3011):
+// The SIMD backend is opt-in. Define MATH_ENABLE_SIMD (or configure CMake
+// with MATHLIB_ENABLE_SIMD=ON) to let the arithmetic on the supported types
+// use intrinsics. The instruction set is picked at compile time based on the
+// target flags (e.g. -mavx2), the scalar code stays as the fallback and is
+// always used during constant evaluation.
+
+#if defined(MATH_ENABLE_SIMD)
+#   if defined(__AVX2__)
+#       define MATH_SIMD_AVX2 1
+#   endif
+#   if defined(__AVX__)
+#       define MATH_SIMD_AVX 1
+#   endif
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define MATH_SIMD_SSE2 1
+#   endif
+#   if defined(__FMA__)
+#       define MATH_SIMD_FMA 1
+#   endif
+#   if defined(__ARM_NEON) || defined(_M_ARM64)
+#       define MATH_SIMD_NEON 1
+#   endif
+#endif
+
+#if defined(MATH_SIMD_SSE2) || defined(MATH_SIMD_AVX)
+#   include <immintrin.h>
+#endif
+
+#if defined(MATH_SIMD_NEON)
+#   include <arm_neon.h>
+#endif
+
+#include "Types.hpp"
+
+namespace Math::Implementation::Simd
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Register wrappers
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Each specialization wraps a single four lane register.
+    // Three lane loads fill the last lane with a caller supplied value, so
+    // that e.g. a division does not produce a NaN in the unused lane.
+    template <typename T>
+    struct Register4
+    {
+        static constexpr bool Enabled = false;
+    };
+
+#if defined(MATH_SIMD_SSE2)
+    template <>
+    struct Register4<float>
+    {
+        static constexpr bool Enabled = true;
+        static constexpr bool HasShuffle = true;
+        using Type = __m128;
+
+        static Type Load4(const float* p) noexcept { return _mm_loadu_ps(p); }
+        static Type Load3(const float* p, float w) noexcept
+        {
+            // Note(3011): __m64 may alias anything, a double would not.
+            __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+            __m128 zw = _mm_setr_ps(p[2], w, 0.0f, 0.0f);
+            return _mm_movelh_ps(xy, zw);
+        }
+
+        static void Store4(float* p, Type v) noexcept { _mm_storeu_ps(p, v); }
+        static void Store3(float* p, Type v) noexcept
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+            _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+        }
+
+        // Non-temporal store, p has to be StreamAlignment aligned. Streamed
+        // data is only ordered with other stores after StreamFence.
+        static constexpr std::size_t StreamAlignment = 16;
+        static void Stream4(float* p, Type v) noexcept { _mm_stream_ps(p, v); }
+        static void StreamFence() noexcept { _mm_sfence(); }
+
+        static Type Broadcast(float s) noexcept { return _mm_set1_ps(s); }
+
+        static Type Add(Type a, Type b) noexcept { return _mm_add_ps(a, b); }
+        static Type Sub(Type a, Type b) noexcept { return _mm_sub_ps(a, b); }
+        static Type Mul(Type a, Type b) noexcept { return _mm_mul_ps(a, b); }
+        static Type Div(Type a, Type b) noexcept { return _mm_div_ps(a, b); }
+        static Type Neg(Type a)         noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+        static Type Sqrt(Type a)        noexcept { return _mm_sqrt_ps(a); }
+
+        // a * b + c, fused when the target supports it.
+#   if defined(MATH_SIMD_FMA)
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm_fmadd_ps(a, b, c); }
+#   else
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+#   endif
+
+        static Type Min(Type a, Type b) noexcept { return _mm_min_ps(a, b); }
+        static Type Max(Type a, Type b) noexcept { return _mm_max_ps(a, b); }
+
+        // [x, y, z, w] -> [y, z, x, w]
+        static Type ShuffleYZX(Type a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); }
+
+        // Sum of all lanes, broadcast into every lane.
+        static Type HorizontalSum(Type a) noexcept
+        {
+            __m128 shuf = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(a, shuf);
+            shuf = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2));
+            return _mm_add_ps(sums, shuf);
+        }
+
+        static float First(Type a) noexcept { return _mm_cvtss_f32(a); }
+    };
+#elif defined(MATH_SIMD_NEON)
+    template <>
+    struct Register4<float>
+    {
+        static constexpr bool Enabled = true;
+        static constexpr bool HasShuffle = true;
+        using Type = float32x4_t;
+
+        static Type Load4(const float* p) noexcept { return vld1q_f32(p); }
+        static Type Load3(const float* p, float w) noexcept
+        {
+            float32x2_t zw = vset_lane_f32(p[2], vdup_n_f32(w), 0);
+            return vcombine_f32(vld1_f32(p), zw);
+        }
+
+        static void Store4(float* p, Type v) noexcept { vst1q_f32(p, v); }
+        static void Store3(float* p, Type v) noexcept
+        {
+            vst1_f32(p, vget_low_f32(v));
+            vst1q_lane_f32(p + 2, v, 2);
+        }
+
+        // Note(3011): NEON has no non-temporal hint, streaming is a plain store.
+        static constexpr std::size_t StreamAlignment = 16;
+        static void Stream4(float* p, Type v) noexcept { vst1q_f32(p, v); }
+        static void StreamFence() noexcept {}
+
+        static Type Broadcast(float s) noexcept { return vdupq_n_f32(s); }
+
+        static Type Add(Type a, Type b) noexcept { return vaddq_f32(a, b); }
+        static Type Sub(Type a, Type b) noexcept { return vsubq_f32(a, b); }
+        static Type Mul(Type a, Type b) noexcept { return vmulq_f32(a, b); }
+        static Type Neg(Type a)         noexcept { return vnegq_f32(a); }
+        static Type Min(Type a, Type b) noexcept { return vminq_f32(a, b); }
+        static Type Max(Type a, Type b) noexcept { return vmaxq_f32(a, b); }
+
+#   if defined(__aarch64__) || defined(_M_ARM64)
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return vfmaq_f32(c, a, b); }
+        static Type Div(Type a, Type b) noexcept { return vdivq_f32(a, b); }
+        static Type Sqrt(Type a)        noexcept { return vsqrtq_f32(a); }
+#   else
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return vmlaq_f32(c, a, b); }
+
+        // Note(3011): ARMv7 NEON has no IEEE division or square root, so we
+        // go lane by lane to keep the results identical to the scalar code.
+        static Type Div(Type a, Type b) noexcept
+        {
+            float lhs[4], rhs[4];
+            vst1q_f32(lhs, a);
+            vst1q_f32(rhs, b);
+            for (int i = 0; i < 4; ++i) { lhs[i] /= rhs[i]; }
+            return vld1q_f32(lhs);
+        }
+
+        static Type Sqrt(Type a) noexcept
+        {
+            float lanes[4];
+            vst1q_f32(lanes, a);
+            for (int i = 0; i < 4; ++i) { lanes[i] = __builtin_sqrtf(lanes[i]); }
+            return vld1q_f32(lanes);
+        }
+#   endif
+
+        // [x, y, z, w] -> [y, z, x, y], the last lane is only used by Vector3T.
+        static Type ShuffleYZX(Type a) noexcept
+        {
+            float32x2_t lo = vget_low_f32(a);
+            return vcombine_f32(vext_f32(lo, vget_high_f32(a), 1), lo);
+        }
+
+        static Type HorizontalSum(Type a) noexcept
+        {
+            float32x2_t pair = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+            return vdupq_n_f32(vget_lane_f32(vpadd_f32(pair, pair), 0));
+        }
+
+        static float First(Type a) noexcept { return vgetq_lane_f32(a, 0); }
+    };
+#endif
+
+#if defined(MATH_SIMD_AVX)
+    template <>
+    struct Register4<double>
+    {
+        static constexpr bool Enabled = true;
+#   if defined(MATH_SIMD_AVX2)
+        static constexpr bool HasShuffle = true;
+#   else
+        static constexpr bool HasShuffle = false;
+#   endif
+        using Type = __m256d;
+
+        static Type Load4(const double* p) noexcept { return _mm256_loadu_pd(p); }
+        static Type Load3(const double* p, double w) noexcept
+        {
+            __m128d xy = _mm_loadu_pd(p);
+            __m128d zw = _mm_setr_pd(p[2], w);
+            return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1);
+        }
+
+        static void Store4(double* p, Type v) noexcept { _mm256_storeu_pd(p, v); }
+        static void Store3(double* p, Type v) noexcept
+        {
+            _mm_storeu_pd(p, _mm256_castpd256_pd128(v));
+            _mm_store_sd(p + 2, _mm256_extractf128_pd(v, 1));
+        }
+
+        static constexpr std::size_t StreamAlignment = 32;
+        static void Stream4(double* p, Type v) noexcept { _mm256_stream_pd(p, v); }
+        static void StreamFence() noexcept { _mm_sfence(); }
+
+        static Type Broadcast(double s) noexcept { return _mm256_set1_pd(s); }
+
+        static Type Add(Type a, Type b) noexcept { return _mm256_add_pd(a, b); }
+        static Type Sub(Type a, Type b) noexcept { return _mm256_sub_pd(a, b); }
+        static Type Mul(Type a, Type b) noexcept { return _mm256_mul_pd(a, b); }
+        static Type Div(Type a, Type b) noexcept { return _mm256_div_pd(a, b); }
+        static Type Neg(Type a)         noexcept { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+        static Type Sqrt(Type a)        noexcept { return _mm256_sqrt_pd(a); }
+
+#   if defined(MATH_SIMD_FMA)
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+#   else
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#   endif
+
+        static Type Min(Type a, Type b) noexcept { return _mm256_min_pd(a, b); }
+        static Type Max(Type a, Type b) noexcept { return _mm256_max_pd(a, b); }
+
+#   if defined(MATH_SIMD_AVX2)
+        static Type ShuffleYZX(Type a) noexcept { return _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1)); }
+#   endif
+
+        static Type HorizontalSum(Type a) noexcept
+        {
+            __m256d swapped = _mm256_permute2f128_pd(a, a, 1);
+            __m256d sums = _mm256_add_pd(a, swapped);
+            return _mm256_add_pd(sums, _mm256_shuffle_pd(sums, sums, 0b0101));
+        }
+
+        static double First(Type a) noexcept { return _mm256_cvtsd_f64(a); }
+    };
+#endif
+
+    // Note(3011): Eight lane registers, only used by packets whose width is
+    // a multiple of eight. Vector types stay on Register4.
+    template <typename T>
+    struct Register8
+    {
+        static constexpr bool Enabled = false;
+    };
+
+#if defined(MATH_SIMD_AVX)
+    template <>
+    struct Register8<float>
+    {
+        static constexpr bool Enabled = true;
+        using Type = __m256;
+
+        static Type Load8(const float* p) noexcept { return _mm256_loadu_ps(p); }
+        static void Store8(float* p, Type v) noexcept { _mm256_storeu_ps(p, v); }
+
+        static Type Broadcast(float s) noexcept { return _mm256_set1_ps(s); }
+
+        static Type Add(Type a, Type b) noexcept { return _mm256_add_ps(a, b); }
+        static Type Sub(Type a, Type b) noexcept { return _mm256_sub_ps(a, b); }
+        static Type Mul(Type a, Type b) noexcept { return _mm256_mul_ps(a, b); }
+        static Type Div(Type a, Type b) noexcept { return _mm256_div_ps(a, b); }
+        static Type Neg(Type a)         noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+        static Type Sqrt(Type a)        noexcept { return _mm256_sqrt_ps(a); }
+
+#   if defined(MATH_SIMD_FMA)
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+#   else
+        static Type MulAdd(Type a, Type b, Type c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#   endif
+
+        static Type Min(Type a, Type b) noexcept { return _mm256_min_ps(a, b); }
+        static Type Max(Type a, Type b) noexcept { return _mm256_max_ps(a, b); }
+    };
+#endif
+}
+
+#endif //MATHLIB_IMPLEMENTATION_BASE_SIMD_HPP
@@ -73,6 +73,12 @@ namespace Math
         Right
     };
 
+    enum class Execution
+    {
+        Sequential,
+        Parallel
+    };
+
     //////////////////////////////////////////////////////////////////////////
     // StrongTypes
     //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,328 @@
+#ifndef MATHLIB_IMPLEMENTATION_FUNCTIONS_FAST_FUNCTIONS_HPP
+#define MATHLIB_IMPLEMENTATION_FUNCTIONS_FAST_FUNCTIONS_HPP
+
+#include "../../Base.hpp"
+#include "../Base/Lanes.hpp"
+
+#include <bit>
+#include <cstdint>
+
+// Note(3011): Approximations for code that doesn't need correctly rounded
+// results, e.g. shading or noise. Exp and Log are built on Exp2 and Log2,
+// which split the argument into its exponent and a mantissa evaluated with
+// a minimax polynomial. RSqrt and Reciprocal refine a bit-level estimate
+// with Newton steps. The precision level picks the polynomial degree or
+// the number of steps, the kernels are shared with the packet overloads in
+// PacketUtilities.hpp.
+//
+// Maximum relative error, measured in Tests/Functions/FastFunctionsTests.cpp.
+// The High column is for f64, f32 results don't get below about 4e-7.
+//
+//                     Low       Medium    High
+//   Exp2, Exp         8e-5      1e-7      5e-11
+//   Log2, Log         3e-5      2e-7      5e-12
+//   RSqrt             2e-3      5e-6      4e-11
+//   Reciprocal        3e-3      7e-6      5e-11
+//
+// Pow(x, y) is Exp2(y * Log2(x)), its error grows with |y * Log2(x)|.
+//
+// The arguments aren't checked: Log2, Log, Pow, RSqrt and Reciprocal need a
+// positive normal number, and NaN isn't supported. Exp2 returns 0 below
+// -127 (f32) or -1023 (f64) and infinity above the largest exponent.
+
+namespace Math::Fast
+{
+    enum class Precision
+    {
+        Low,
+        Medium,
+        High
+    };
+}
+
+namespace Math::Implementation::Fast
+{
+    using Math::Fast::Precision;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Bit level helpers
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Returns 2^n for an integral n within the exponent range.
+    template <typename S>
+    [[nodiscard]] constexpr
+    S PowerOfTwo(S n) noexcept
+    {
+        if constexpr (std::is_same_v<Math::UnderlyingType<S>, float>)
+        {
+            auto exponent = static_cast<std::uint32_t>(static_cast<std::int32_t>(ToUnderlying(n)) + 127);
+            return S(std::bit_cast<float>(exponent << 23));
+        }
+        else
+        {
+            auto exponent = static_cast<std::uint64_t>(static_cast<std::int64_t>(ToUnderlying(n)) + 1023);
+            return S(std::bit_cast<double>(exponent << 52));
+        }
+    }
+
+    // Note(3011): Splits val into 2^exponent * mantissa with the mantissa in
+    // [sqrt(1/2), sqrt(2)). Subtracting the bits of sqrt(1/2) first moves
+    // the exponent boundary there.
+    template <typename S>
+    [[nodiscard]] constexpr
+    S Exponent(S val) noexcept
+    {
+        if constexpr (std::is_same_v<Math::UnderlyingType<S>, float>)
+        {
+            auto bits = std::bit_cast<std::int32_t>(ToUnderlying(val)) - std::int32_t(0x3F3504F3);
+            return S(static_cast<float>(bits >> 23));
+        }
+        else
+        {
+            auto bits = std::bit_cast<std::int64_t>(ToUnderlying(val)) - std::int64_t(0x3FE6A09E667F3BCD);
+            return S(static_cast<double>(bits >> 52));
+        }
+    }
+
+    template <typename S>
+    [[nodiscard]] constexpr
+    S Mantissa(S val) noexcept
+    {
+        if constexpr (std::is_same_v<Math::UnderlyingType<S>, float>)
+        {
+            auto bits = std::bit_cast<std::int32_t>(ToUnderlying(val));
+            auto exponent = (bits - std::int32_t(0x3F3504F3)) >> 23;
+            return S(std::bit_cast<float>(static_cast<std::int32_t>(static_cast<std::uint32_t>(bits) - (static_cast<std::uint32_t>(exponent) << 23))));
+        }
+        else
+        {
+            auto bits = std::bit_cast<std::int64_t>(ToUnderlying(val));
+            auto exponent = (bits - std::int64_t(0x3FE6A09E667F3BCD)) >> 52;
+            return S(std::bit_cast<double>(static_cast<std::int64_t>(static_cast<std::uint64_t>(bits) - (static_cast<std::uint64_t>(exponent) << 52))));
+        }
+    }
+
+    // Note(3011): The classic magic constant estimates, within 3.5% for
+    // RSqrt and 5% for Reciprocal.
+    template <typename S>
+    [[nodiscard]] constexpr
+    S RSqrtEstimate(S val) noexcept
+    {
+        if constexpr (std::is_same_v<Math::UnderlyingType<S>, float>)
+        {
+            return S(std::bit_cast<float>(std::uint32_t(0x5F375A86) - (std::bit_cast<std::uint32_t>(ToUnderlying(val)) >> 1)));
+        }
+        else
+        {
+            return S(std::bit_cast<double>(std::uint64_t(0x5FE6EB50C7B537A9) - (std::bit_cast<std::uint64_t>(ToUnderlying(val)) >> 1)));
+        }
+    }
+
+    template <typename S>
+    [[nodiscard]] constexpr
+    S ReciprocalEstimate(S val) noexcept
+    {
+        if constexpr (std::is_same_v<Math::UnderlyingType<S>, float>)
+        {
+            return S(std::bit_cast<float>(std::uint32_t(0x7EF311C3) - std::bit_cast<std::uint32_t>(ToUnderlying(val))));
+        }
+        else
+        {
+            return S(std::bit_cast<double>(std::uint64_t(0x7FDE623822FC16E6) - std::bit_cast<std::uint64_t>(ToUnderlying(val))));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Kernels
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Computes 2^n * 2^f for an integral n and |f| <= 0.5 with
+    // minimax polynomials for 2^f, relative error 7.5e-5, 7.5e-8 and 4e-11.
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V Exp2Kernel(V n, V f) noexcept
+    {
+        using S = typename ScalarOf<V>::Type;
+
+        V p;
+        if constexpr (Level == Precision::Low)
+        {
+            p = ((V(0.055171669074864) * f + V(0.2426111221943308)) * f + V(0.6932609854573362)) * f + V(0.9999280735404956);
+        }
+        else if constexpr (Level == Precision::Medium)
+        {
+            p = ((((V(0.0013276471979286704) * f + V(0.009675541334209831)) * f + V(0.05550713273543075)) * f
+                + V(0.2402211972384865)) * f + V(0.693146967064733)) * f + V(1.0000000716546822);
+        }
+        else
+        {
+            p = ((((((V(1.5201921954160421e-05) * f + V(0.00015469291145413393)) * f + V(0.0013333922561883363)) * f
+                + V(0.00961802725365909)) * f + V(0.05550410353450194)) * f + V(0.2402265119815761)) * f
+                + V(0.6931471807284463)) * f + V(0.9999999999616821);
+        }
+
+        return p * MapLanes(n, [](S lane) { return PowerOfTwo(lane); });
+    }
+
+    // Note(3011): Arguments are clamped so 2^n stays representable, from 0
+    // at the lowest exponent to infinity above the highest.
+    template <typename V>
+    [[nodiscard]] constexpr
+    V ClampExponent(V val) noexcept
+    {
+        const V lowest  = IsSinglePrecision<V> ? V(-127) : V(-1023);
+        const V highest = IsSinglePrecision<V> ? V(128)  : V(1024);
+        return Select(val < lowest, lowest, Select(val > highest, highest, val));
+    }
+
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V Exp2(V val) noexcept
+    {
+        val = ClampExponent(val);
+        V n = RoundToInteger(val);
+        return Exp2Kernel<Level>(n, val - n);
+    }
+
+    // Note(3011): Rounding val * log2(e) would cost up to 2^-24 * 128 in
+    // f32, so val - n * ln(2) is evaluated with ln(2) split in two parts
+    // (Cody-Waite) before it is converted to base 2. val is clamped to the
+    // exponent range in base e first, clamping only n would leave a huge r
+    // for the polynomial and turn -1e30 into infinity * 0.
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V Exp(V val) noexcept
+    {
+        const V lowest  = IsSinglePrecision<V> ? V(-88.02969193111305) : V(-709.0895657128241);
+        const V highest = IsSinglePrecision<V> ? V(88.72283905206835)  : V(709.782712893384);
+        val = Select(val < lowest, lowest, Select(val > highest, highest, val));
+
+        V n = ClampExponent(RoundToInteger(val * V(1.44269504088896340735992468100189214)));
+        V r;
+        if constexpr (IsSinglePrecision<V>)
+        {
+            r = (val - n * V(0.693359375)) - n * V(-2.12194440e-4);
+        }
+        else
+        {
+            r = (val - n * V(6.93147180369123816490e-01)) - n * V(1.90821492927058770002e-10);
+        }
+        return Exp2Kernel<Level>(n, r * V(1.44269504088896340735992468100189214));
+    }
+
+    // Note(3011): With m = 2^-e * val and t = (m - 1) / (m + 1), log2(m) is
+    // t * Q(t^2) for the odd series of atanh. Q is a minimax polynomial on
+    // |t| <= 0.1716 with relative error 2.2e-5, 1.2e-7 and 4.2e-12.
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V Log2(V val) noexcept
+    {
+        using S = typename ScalarOf<V>::Type;
+        V e = MapLanes(val, [](S lane) { return Exponent(lane); });
+        V m = MapLanes(val, [](S lane) { return Mantissa(lane); });
+
+        V t = (m - V(1)) / (m + V(1));
+        V u = t * t;
+
+        V q;
+        if constexpr (Level == Precision::Low)
+        {
+            q = V(0.9791280648911782) * u + V(2.885325866489148);
+        }
+        else if constexpr (Level == Precision::Medium)
+        {
+            q = (V(0.5957807233959401) * u + V(0.9615883259636834)) * u + V(2.885390424236259);
+        }
+        else
+        {
+            q = (((V(0.3407259138185983) * u + V(0.4116729637870369)) * u + V(0.5770835802959324)) * u
+                + V(0.9617966733738674)) * u + V(2.885390081790029);
+        }
+
+        return e + t * q;
+    }
+
+    template <Precision Level>
+    inline constexpr int NewtonSteps = (Level == Precision::Low) ? 1 : ((Level == Precision::Medium) ? 2 : 3);
+
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V RSqrt(V val) noexcept
+    {
+        using S = typename ScalarOf<V>::Type;
+        V result = MapLanes(val, [](S lane) { return RSqrtEstimate(lane); });
+        V half = V(0.5) * val;
+        for (int i = 0; i < NewtonSteps<Level>; ++i)
+        {
+            result = result * (V(1.5) - half * result * result);
+        }
+        return result;
+    }
+
+    template <Precision Level, typename V>
+    [[nodiscard]] constexpr
+    V Reciprocal(V val) noexcept
+    {
+        using S = typename ScalarOf<V>::Type;
+        V result = MapLanes(val, [](S lane) { return ReciprocalEstimate(lane); });
+        for (int i = 0; i < NewtonSteps<Level>; ++i)
+        {
+            result = result * (V(2) - val * result);
+        }
+        return result;
+    }
+}
+
+namespace Math::Fast
+{
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Exp2(T val) noexcept
+    {
+        return Implementation::Fast::Exp2<Level>(val);
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Exp(T val) noexcept
+    {
+        return Implementation::Fast::Exp<Level>(val);
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Log2(T val) noexcept
+    {
+        return Implementation::Fast::Log2<Level>(val);
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Log(T val) noexcept
+    {
+        return Implementation::Fast::Log2<Level>(val) * T(0.693147180559945309417232121458176568);
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Pow(T val, T exponent) noexcept
+    {
+        return Implementation::Fast::Exp2<Level>(exponent * Implementation::Fast::Log2<Level>(val));
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T RSqrt(T val) noexcept
+    {
+        return Implementation::Fast::RSqrt<Level>(val);
+    }
+
+    template <Precision Level = Precision::Medium, Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Reciprocal(T val) noexcept
+    {
+        return Implementation::Fast::Reciprocal<Level>(val);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_FUNCTIONS_FAST_FUNCTIONS_HPP
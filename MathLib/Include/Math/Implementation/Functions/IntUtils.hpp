@@ -34,6 +34,60 @@ namespace Math
     {
         return std::countr_zero(val);
     }
+
+    // Note(3011): Swaps neighbouring groups of 1, 2, 4, ... bits, the masks
+    // 0x55.., 0x33.., 0x0F.., ... are Max / (2^shift + 1).
+    template <Concept::UnsignedIntegralType Int>
+    [[nodiscard]] constexpr
+    Int ReverseBits(Int val) noexcept
+    {
+        for (SizeType shift = 1; shift < sizeof(Int) * 8; shift *= 2)
+        {
+            const Int mask = Int::Max() / ((Int(1) << shift) + 1);
+            val = ((val >> shift) & mask) | ((val & mask) << shift);
+        }
+        return val;
+    }
+
+    // Note(3011): Returns the low half of the full product of a and b and
+    // writes the high half to high. 64 bit operands use the 128 bit type
+    // where the compiler has one and four partial products otherwise.
+    template <Concept::UnsignedIntegralType Int>
+    [[nodiscard]] constexpr
+    Int MultiplyExtended(Int a, Int b, Int& high) noexcept
+    {
+        constexpr SizeType Bits = sizeof(Int) * 8;
+
+        if constexpr (sizeof(Int) < 8)
+        {
+            using Wide = UnsignedIntegerSelector<sizeof(Int) * 2>;
+            const Wide product = Cast<Wide>(a) * Cast<Wide>(b);
+            high = Cast<Int>(product >> Bits);
+            return Cast<Int>(product);
+        }
+        else
+        {
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 Wide;
+            const Wide product = static_cast<Wide>(ToUnderlying(a)) * ToUnderlying(b);
+            high = Cast<Int>(static_cast<UnderlyingType<Int>>(product >> 64));
+            return Cast<Int>(static_cast<UnderlyingType<Int>>(product));
+#else
+            constexpr Int Mask = 0xFFFFFFFF;
+            const Int aLow = a & Mask;
+            const Int aHigh = a >> 32;
+            const Int bLow = b & Mask;
+            const Int bHigh = b >> 32;
+
+            const Int low = aLow * bLow;
+            const Int middle = aHigh * bLow + (low >> 32);
+            const Int cross = aLow * bHigh + (middle & Mask);
+
+            high = aHigh * bHigh + (middle >> 32) + (cross >> 32);
+            return (cross << 32) | (low & Mask);
+#endif
+        }
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_FUNCTIONS_INT_UTILS_HPP
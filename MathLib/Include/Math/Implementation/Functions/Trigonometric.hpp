@@ -3,92 +3,423 @@
 
 #include "../../Base.hpp"
 #include "../../Constants.hpp"
-#include "Equal.hpp"
+#include "BasicFunctions.hpp"
+#include "../Base/Lanes.hpp"
 
-// TODO(3011): Add custom implementation and remove this include later.
+#include <bit>
 #include <cmath>
+#include <cstdint>
+
+// Note(3011): The functions below are evaluated with minimax polynomials
+// (fdlibm for double precision, Cephes for single precision) instead of
+// <cmath>, so they are usable in constant expressions and inline into
+// vector loops. Every kernel is written once against a generic value type,
+// which is either a scalar or a Packet (see Base/Lanes.hpp), so the packet
+// overloads in PacketUtilities.hpp share them.
+//
+// Maximum error against the exact result, measured over the documented
+// domain in Tests/Functions/TrigonometricTests.cpp (0.5 ulp would be
+// correctly rounded):
+//
+//               f32        f64
+//   Sin, Cos    2.5 ulp    2.5 ulp
+//   Tan         4 ulp      4 ulp
+//   Asin        2.5 ulp    2.5 ulp
+//   Acos        1.5 ulp    1.5 ulp
+//   Atan        3 ulp      1 ulp
+//   Atan2       3.5 ulp    2 ulp
+//
+// Sin, Cos and Tan use a Cody-Waite range reduction, which keeps these
+// bounds for |x| < 8192 (f32) and |x| < 2^20 (f64). Larger arguments are
+// passed on to <cmath>, which reduces them with the full bits of 2/Pi, so
+// they only work in constant expressions where the compiler evaluates
+// std::sin and std::cos. Infinities and NaNs produce NaN. The odd
+// functions keep the sign of zero, Atan2 follows the signed zero rules of
+// std::atan2.
 
 namespace Math
 {
-    template <Concept::StrongFloatType T>
-    [[nodiscard]] constexpr
-    T Sin(T val) noexcept
+    namespace Implementation::Trig
     {
-        if (val != val)
+        //////////////////////////////////////////////////////////////////////////
+        // Range reduction
+        //////////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Reduces val to r in [-Pi/4, Pi/4] so val = r + k * Pi/2
+        // and returns k modulo 4 as a value in {0, 1, 2, 3}. Pi/2 is split
+        // into parts with trailing zeros, so the products with k are exact.
+        template <typename V>
+        [[nodiscard]] constexpr
+        V ReduceQuadrant(V val, V& r) noexcept
+        {
+            V k = RoundToInteger(val * V(0.636619772367581343075535053490057448));
+            if constexpr (IsSinglePrecision<V>)
+            {
+                r = (((val - k * V(1.5703125))
+                           - k * V(4.837512969970703125e-4))
+                           - k * V(7.549533620476723e-08))
+                           - k * V(2.5633440682570896e-12);
+            }
+            else
+            {
+                r = (((val - k * V(1.57079632673412561417e+00))
+                           - k * V(6.07710050630396597660e-11))
+                           - k * V(2.02226624871116645580e-21))
+                           - k * V(8.47842766036889956997e-32);
+            }
+            return k - V(4) * RoundToInteger(k * V(0.25) - V(0.375));
+        }
+
+        // Note(3011): Recomputes the lanes outside the range of
+        // ReduceQuadrant with op, which gets and returns underlying scalars.
+        // Small arguments cost one comparison per call, NaNs already are
+        // NaN and stay as they are.
+        template <typename V, typename Op>
+        [[nodiscard]] constexpr
+        V ReplaceLargeArguments(V val, V result, Op op) noexcept
+        {
+            auto large = Abs(val) >= (IsSinglePrecision<V> ? V(8192) : V(1048576));
+            if (AnyLane(large))
+            {
+                using S = typename ScalarOf<V>::Type;
+                result = Select(large, MapLanes(val, [op](S lane) { return S(op(ToUnderlying(lane))); }), result);
+            }
+            return result;
+        }
+
+        // Note(3011): Magnitude of a with the sign bit of b. Select can't
+        // tell -0 from +0, since they compare equal.
+        template <typename V>
+        [[nodiscard]] constexpr
+        V CopySign(V a, V b) noexcept
         {
-            return T::NaN();
+            if constexpr (requires { typename V::MaskType; })
+            {
+                for (SizeType i = 0; i < V::Size; ++i)
+                {
+                    a[i] = CopySign(a[i], b[i]);
+                }
+                return a;
+            }
+            else
+            {
+                using Raw = Math::UnderlyingType<V>;
+                using Bits = std::conditional_t<sizeof(Raw) == 4, std::uint32_t, std::uint64_t>;
+                constexpr Bits sign = Bits(1) << (sizeof(Raw) * 8 - 1);
+
+                Bits bits = (std::bit_cast<Bits>(Raw(ToUnderlying(a))) & ~sign) | (std::bit_cast<Bits>(Raw(ToUnderlying(b))) & sign);
+                return V(std::bit_cast<Raw>(bits));
+            }
         }
 
-        if (Equal(T(0), Abs(val), T::Epsilon()) || Equal(Constant::Pi<T>, Abs(val), T::Epsilon()))
+        //////////////////////////////////////////////////////////////////////////
+        // Kernels on [-Pi/4, Pi/4]
+        //////////////////////////////////////////////////////////////////////////
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V SinKernel(V r) noexcept
         {
-            return T(0);
+            V z = r * r;
+            if constexpr (IsSinglePrecision<V>)
+            {
+                return ((V(-1.9515295891e-4) * z + V(8.3321608736e-3)) * z + V(-1.6666654611e-1)) * z * r + r;
+            }
+            else
+            {
+                V p = V(8.33333333332248946124e-03) + z * (V(-1.98412698298579493134e-04) + z * (V(2.75573137070700676789e-06)
+                    + z * (V(-2.50507602534068634195e-08) + z * V(1.58969099521155010221e-10))));
+                return r + z * r * (V(-1.66666666666666324348e-01) + z * p);
+            }
         }
-        else if (Equal(Constant::PiDiv2<T>, Abs(val), T::Epsilon()))
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V CosKernel(V r) noexcept
         {
-            return T(1);
+            V z = r * r;
+            if constexpr (IsSinglePrecision<V>)
+            {
+                return ((V(2.443315711809948e-5) * z + V(-1.388731625493765e-3)) * z + V(4.166664568298827e-2)) * z * z - V(0.5) * z + V(1);
+            }
+            else
+            {
+                // Note(3011): 1 - z/2 is evaluated in two parts, so the
+                // rounding error of the leading term is carried along.
+                V p = z * (V(4.16666666666666019037e-02) + z * (V(-1.38888888888741095749e-03) + z * (V(2.48015872894767294178e-05)
+                    + z * (V(-2.75573143513906633035e-07) + z * (V(2.08757232129817482790e-09) + z * V(-1.13596475577881948265e-11))))));
+                V hz = V(0.5) * z;
+                V w = V(1) - hz;
+                return w + (((V(1) - w) - hz) + z * p);
+            }
         }
 
-        return std::sin(ToUnderlying(val));
+        // Note(3011): Computes asin on [0, 1] and its complement Pi/2 - asin
+        // from a shared rational approximation. For a >= 0.5 the argument is
+        // reduced with asin(a) = Pi/2 - 2 * asin(sqrt((1 - a) / 2)).
+        template <typename V>
+        constexpr
+        void AsinKernel(V a, V& asin, V& twiceReduced) noexcept
+        {
+            auto small = a < V(0.5);
+            V t = Select(small, a * a, (V(1) - a) * V(0.5));
+            V s = Select(small, a, Sqrt(t));
+
+            V r;
+            if constexpr (IsSinglePrecision<V>)
+            {
+                r = t * ((((V(4.2163199048e-2) * t + V(2.4181311049e-2)) * t + V(4.5470025998e-2)) * t
+                        + V(7.4953002686e-2)) * t + V(1.6666752422e-1));
+            }
+            else
+            {
+                V p = t * (V(1.66666666666666657415e-01) + t * (V(-3.25565818622400915405e-01) + t * (V(2.01212532134862925881e-01)
+                    + t * (V(-4.00555345006794114027e-02) + t * (V(7.91534994289814532176e-04) + t * V(3.47933107596021167570e-05))))));
+                V q = V(1) + t * (V(-2.40339491173441421878e+00) + t * (V(2.02094576023350569471e+00)
+                    + t * (V(-6.88283971605453293030e-01) + t * V(7.70381505559019352791e-02))));
+                r = p / q;
+            }
+
+            // Note(3011): asin(s) = s + s * r, Pi/2 keeps its low part so the
+            // subtraction below stays accurate.
+            twiceReduced = V(2) * (s + s * r);
+            asin = Select(small, s + s * r,
+                          V(1.57079632679489655800e+00) - (twiceReduced - V(6.12323399573676603587e-17)));
+        }
     }
 
-    template <Concept::FloatingPointType T>
-    [[nodiscard]] constexpr
-    T Cos(T val) noexcept
+    //////////////////////////////////////////////////////////////////////////
+    // Sin, Cos, Tan
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Implementation::Trig
     {
-        if (val != val)
+        template <typename V>
+        constexpr
+        void SinCos(V val, V& sin, V& cos) noexcept
         {
-            return T::NaN();
+            V r;
+            V quadrant = ReduceQuadrant(val, r);
+            V s = SinKernel(r);
+            V c = CosKernel(r);
+
+            // Note(3011): Quadrants 1 and 3 swap sin and cos, sin is negated
+            // in quadrants 2 and 3 and cos in quadrants 1 and 2.
+            auto swap = Abs(quadrant - V(2)) == V(1);
+            V baseSin = Select(swap, c, s);
+            V baseCos = Select(swap, s, c);
+
+            // Note(3011): The reduction turns -0 into +0, so zeros are
+            // passed through.
+            sin = Select(val == V(0), val, Select(quadrant >= V(2), -baseSin, baseSin));
+            cos = Select(Abs(quadrant - V(1.5)) < V(1), -baseCos, baseCos);
+
+            sin = ReplaceLargeArguments(val, sin, [](auto x) { return std::sin(x); });
+            cos = ReplaceLargeArguments(val, cos, [](auto x) { return std::cos(x); });
         }
 
-        if (Equal(T(0), Abs(val), T::Epsilon()))
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Sin(V val) noexcept
         {
-            return T(1);
+            V r;
+            V quadrant = ReduceQuadrant(val, r);
+            V base = Select(Abs(quadrant - V(2)) == V(1), CosKernel(r), SinKernel(r));
+            V result = Select(val == V(0), val, Select(quadrant >= V(2), -base, base));
+            return ReplaceLargeArguments(val, result, [](auto x) { return std::sin(x); });
         }
-        else if (Equal(Constant::PiDiv2<T>, Abs(val), T::Epsilon()))
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Cos(V val) noexcept
         {
-            return T(0);
+            V r;
+            V quadrant = ReduceQuadrant(val, r);
+            V base = Select(Abs(quadrant - V(2)) == V(1), SinKernel(r), CosKernel(r));
+            V result = Select(Abs(quadrant - V(1.5)) < V(1), -base, base);
+            return ReplaceLargeArguments(val, result, [](auto x) { return std::cos(x); });
         }
-        else if (Equal(Constant::Pi<T>, Abs(val), T::Epsilon()))
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Tan(V val) noexcept
         {
-            return T(-1);
+            V sin;
+            V cos;
+            SinCos(val, sin, cos);
+            return sin / cos;
         }
+    }
 
-        return std::cos(ToUnderlying(val));
+    template <Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Sin(T val) noexcept
+    {
+        return Implementation::Trig::Sin(val);
+    }
+
+    template <Concept::FloatingPointType T>
+    [[nodiscard]] constexpr
+    T Cos(T val) noexcept
+    {
+        return Implementation::Trig::Cos(val);
     }
 
     template <Concept::FloatingPointType T>
     [[nodiscard]] constexpr
     T Tan(T val) noexcept
     {
-        return std::tan(ToUnderlying(val));
+        return Implementation::Trig::Tan(val);
+    }
+
+    // Note(3011): Computes both values with a single range reduction.
+    template <Concept::FloatingPointType T>
+    constexpr
+    void SinCos(T val, T& sin, T& cos) noexcept
+    {
+        Implementation::Trig::SinCos(val, sin, cos);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Inverse functions
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Asin and Acos call Sqrt, so they can only be used in
+    // constant expressions where the compiler evaluates std::sqrt.
+    namespace Implementation::Trig
+    {
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Asin(V val) noexcept
+        {
+            V asin;
+            V twiceReduced;
+            AsinKernel(Abs(val), asin, twiceReduced);
+            return Select(val == V(0), val, Select(val < V(0), -asin, asin));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Acos(V val) noexcept
+        {
+            V asin;
+            V twiceReduced;
+            AsinKernel(Abs(val), asin, twiceReduced);
+
+            // Note(3011): For |val| >= 0.5 the reduced form gives acos
+            // directly, which avoids cancellation close to val = 1.
+            V signedAsin = Select(val < V(0), -asin, asin);
+            V small = V(1.57079632679489655800e+00) - (signedAsin - V(6.12323399573676603587e-17));
+            V negative = V(3.14159265358979311600e+00) - (twiceReduced - V(1.22464679914735317720e-16));
+            return Select(Abs(val) < V(0.5), small, Select(val < V(0), negative, twiceReduced));
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Atan(V val) noexcept
+        {
+            V a = Abs(val);
+
+            // Note(3011): The argument is mapped to a small interval with
+            // atan(a) = atan(c) + atan((a - c) / (1 + a * c)), which is
+            // written as one quotient (a * u + v) / (a * w + d) whose
+            // coefficients are picked per lane. The largest interval uses
+            // -1 / a, its numerator is picked separately so a = inf works.
+            if constexpr (IsSinglePrecision<V>)
+            {
+                auto large  = a > V(2.414213562373095);
+                auto medium = a > V(0.4142135623730950);
+                V v = Select(medium, V(-1), V(0));
+                V w = Select(medium, V(1), V(0));
+                V d = Select(large, V(0), V(1));
+                V x = Select(large, V(-1), a + v) / (a * w + d);
+                V hi = Select(large, V(1.5707963267948966), Select(medium, V(0.7853981633974483), V(0)));
+
+                V z2 = x * x;
+                V result = (((V(8.05374449538e-2) * z2 + V(-1.38776856032e-1)) * z2 + V(1.99777106478e-1)) * z2
+                           + V(-3.33329491539e-1)) * z2 * x + x;
+                result = hi + result;
+                return Select(val == V(0), val, Select(val < V(0), -result, result));
+            }
+            else
+            {
+                auto id0 = a >= V(0.4375);
+                auto id1 = a >= V(0.6875);
+                auto id2 = a >= V(1.1875);
+                auto id3 = a >= V(2.4375);
+
+                V u = Select(id2, V(1),    Select(id1, V(1),  Select(id0, V(2),  V(1))));
+                V v = Select(id3, V(-1), Select(id2, V(-1.5), Select(id1, V(-1), Select(id0, V(-1), V(0)))));
+                V w = Select(id3, V(1),  Select(id2, V(1.5),  Select(id1, V(1),  Select(id0, V(1),  V(0)))));
+                V d = Select(id3, V(0),  Select(id2, V(1),    Select(id1, V(1),  Select(id0, V(2),  V(1)))));
+                V x = Select(id3, V(-1), a * u + v) / (a * w + d);
+
+                V hi = Select(id3, V(1.57079632679489655800e+00), Select(id2, V(9.82793723247329054082e-01),
+                     Select(id1, V(7.85398163397448278999e-01), Select(id0, V(4.63647609000806093515e-01), V(0)))));
+                V lo = Select(id3, V(6.12323399573676603587e-17), Select(id2, V(1.39033110312309984516e-17),
+                     Select(id1, V(3.06161699786838301793e-17), Select(id0, V(2.26987774529616870924e-17), V(0)))));
+
+                V z2 = x * x;
+                V w2 = z2 * z2;
+                V s1 = z2 * (V(3.33333333333329318027e-01) + w2 * (V(1.42857142725034663711e-01) + w2 * (V(9.09088713343650656196e-02)
+                     + w2 * (V(6.66107313738753120669e-02) + w2 * (V(4.97687799461593236017e-02) + w2 * V(1.62858201153657823623e-02))))));
+                V s2 = w2 * (V(-1.99999999998764832476e-01) + w2 * (V(-1.11111104054623557880e-01) + w2 * (V(-7.69187620504482999495e-02)
+                     + w2 * (V(-5.83357013379057348645e-02) + w2 * V(-3.65315727442169155270e-02)))));
+                V result = hi - ((x * (s1 + s2) - lo) - x);
+                return Select(val == V(0), val, Select(val < V(0), -result, result));
+            }
+        }
+
+        template <typename V>
+        [[nodiscard]] constexpr
+        V Atan2(V y, V x) noexcept
+        {
+            // Note(3011): atan(|y / x|) already handles x = 0 through the
+            // infinite quotient, the angle only needs to be mirrored into
+            // the left half-plane for negative x and gets the sign of y.
+            // Constant evaluation rejects that division, so x = 0 only works
+            // at runtime. For y = 0 the sign bits decide between 0 and Pi.
+            V pi = V(3.14159265358979323846264338327950288);
+            V result = Atan(Abs(y / x));
+            result = Select(x < V(0), pi - result, result);
+            result = Select(y < V(0), -result, result);
+
+            auto zero = y == V(0);
+            if (AnyLane(zero))
+            {
+                V angle = Select(CopySign(V(1), x) < V(0), pi, V(0));
+                result = Select(zero, CopySign(angle, y), result);
+            }
+            return result;
+        }
     }
 
     template <Concept::FloatingPointType T>
     [[nodiscard]] constexpr
     T Asin(T val) noexcept
     {
-        return std::asin(ToUnderlying(val));
+        return Implementation::Trig::Asin(val);
     }
 
     template <Concept::FloatingPointType T>
     [[nodiscard]] constexpr
     T Acos(T val) noexcept
     {
-        return std::acos(ToUnderlying(val));
+        return Implementation::Trig::Acos(val);
     }
 
     template <Concept::FloatingPointType T>
     [[nodiscard]] constexpr
     T Atan(T val) noexcept
     {
-        return std::atan(ToUnderlying(val));
+        return Implementation::Trig::Atan(val);
     }
 
     template <Concept::FloatingPointType T>
     [[nodiscard]] constexpr
     T Atan2(T y, T x) noexcept
     {
-        return std::atan2(ToUnderlying(y), ToUnderlying(x));
+        return Implementation::Trig::Atan2(y, x);
     }
 }
 
@@ -183,14 +183,21 @@ namespace Math
         constexpr explicit MatrixNT(T diag) noexcept
             : rows{}
         {
-            rows.ForEach([diag](SizeType i, ScalarType& row){ row[i] = diag; });
+            for (SizeType i = 0; i < N; ++i) { rows[i][i] = diag; }
         }
 
+        template <typename... Rows>
+            requires (sizeof...(Rows) == ToUnderlying(N)
+                  && (Concept::IsConvertible<Rows, VectorType> && ...))
+        constexpr explicit MatrixNT(const Rows&... rowValues) noexcept
+            : rows(rowValues...)
+        {}
+
         constexpr       VectorType& operator[] (SizeType index)       { return rows[index]; }
         constexpr const VectorType& operator[] (SizeType index) const { return rows[index]; }
 
-        constexpr T Min() const { T min = T::Max(); rows.ForEach([&min](T& row){ if (row.Min() < min) { min = row.Min(); } }); return min; }
-        constexpr T Max() const { T max = T::Min(); rows.ForEach([&max](T& row){ if (row.Max() > max) { max = row.Max(); } }); return max; }
+        constexpr T Min() const { T min = rows[0].Min(); rows.ForEach([&min](const VectorType& row){ if (row.Min() < min) { min = row.Min(); } }); return min; }
+        constexpr T Max() const { T max = rows[0].Max(); rows.ForEach([&max](const VectorType& row){ if (row.Max() > max) { max = row.Max(); } }); return max; }
 
         static constexpr MatrixNT<N, T> Identity() noexcept { return MatrixNT<N, T>(Cast<T>(1)); }
     private:
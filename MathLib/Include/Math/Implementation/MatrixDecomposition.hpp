@@ -0,0 +1,494 @@
+#ifndef MATHLIB_IMPLEMENTATION_MATRIX_DECOMPOSITION_HPP
+#define MATHLIB_IMPLEMENTATION_MATRIX_DECOMPOSITION_HPP
+
+#include "Base/Concepts.hpp"
+#include "Base/Array.hpp"
+#include "../Functions.hpp"
+#include "MatrixOperators.hpp"
+#include "VectorOperators.hpp"
+
+#include <type_traits>
+#include <utility>
+
+// Note(3011): All decompositions factorize once in the constructor and keep
+// the factors by value, so they never allocate. The Solve functions can then
+// be called for any number of right-hand sides. A right-hand side is either
+// a vector or a matrix whose columns are solved for at the same time. Solve
+// assumes the factorization succeeded, TrySolve checks it first and leaves
+// the right-hand side untouched when it did not.
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // LU decomposition with partial pivoting, P * A = L * U
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::MatrixN Mat>
+        requires Concept::StrongFloatType<typename Mat::ScalarType>
+    class LUDecomposition final
+    {
+    public:
+        using MatrixType = Mat;
+        using VectorType = typename Mat::VectorType;
+        using ScalarType = typename Mat::ScalarType;
+        static constexpr SizeType Dimension = Mat::Dimension;
+
+        constexpr explicit LUDecomposition(const Mat& m) noexcept
+            : mLU(m)
+        {
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                mPivots[i] = i;
+            }
+
+            for (SizeType k = 0; k < Dimension; ++k)
+            {
+                SizeType pivot = k;
+                ScalarType largest = Abs(mLU[k][k]);
+                for (SizeType i = k + 1; i < Dimension; ++i)
+                {
+                    if (Abs(mLU[i][k]) > largest)
+                    {
+                        largest = Abs(mLU[i][k]);
+                        pivot = i;
+                    }
+                }
+
+                if (!(largest > Cast<ScalarType>(0)))
+                {
+                    mSingular = true;
+                    continue;
+                }
+
+                if (pivot != k)
+                {
+                    std::swap(mLU[k], mLU[pivot]);
+                    std::swap(mPivots[k], mPivots[pivot]);
+                    mOddPermutation = !mOddPermutation;
+                }
+
+                ScalarType inverse = Cast<ScalarType>(1) / mLU[k][k];
+                for (SizeType i = k + 1; i < Dimension; ++i)
+                {
+                    ScalarType factor = mLU[i][k] * inverse;
+                    mLU[i][k] = factor;
+                    for (SizeType j = k + 1; j < Dimension; ++j)
+                    {
+                        mLU[i][j] -= factor * mLU[k][j];
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr bool IsSingular() const noexcept { return mSingular; }
+
+        [[nodiscard]] constexpr
+        ScalarType Determinant() const noexcept
+        {
+            ScalarType result = mOddPermutation ? Cast<ScalarType>(-1) : Cast<ScalarType>(1);
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                result *= mLU[i][i];
+            }
+            return result;
+        }
+
+        constexpr void SolveInPlace(VectorType& b) const noexcept { Substitute(b); }
+        constexpr void SolveInPlace(Mat& b)        const noexcept { Substitute(b); }
+
+        [[nodiscard]] constexpr VectorType Solve(VectorType b) const noexcept { Substitute(b); return b; }
+        [[nodiscard]] constexpr Mat        Solve(Mat b)        const noexcept { Substitute(b); return b; }
+
+        [[nodiscard]] constexpr bool TrySolve(VectorType& b) const noexcept { if (mSingular) { return false; } Substitute(b); return true; }
+        [[nodiscard]] constexpr bool TrySolve(Mat& b)        const noexcept { if (mSingular) { return false; } Substitute(b); return true; }
+
+        [[nodiscard]] constexpr Mat Invert() const noexcept { return Solve(Mat::Identity()); }
+
+        // Note(3011): Unit lower triangle holds L, upper triangle holds U.
+        [[nodiscard]] constexpr const Mat& Factors() const noexcept { return mLU; }
+    private:
+        template <typename Rhs>
+        constexpr
+        void Substitute(Rhs& b) const noexcept
+        {
+            Rhs x = b;
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                b[i] = x[mPivots[i]];
+            }
+
+            for (SizeType i = 1; i < Dimension; ++i)
+            {
+                for (SizeType j = 0; j < i; ++j)
+                {
+                    b[i] -= mLU[i][j] * b[j];
+                }
+            }
+
+            for (SizeType i = Dimension; i-- > 0;)
+            {
+                for (SizeType j = i + 1; j < Dimension; ++j)
+                {
+                    b[i] -= mLU[i][j] * b[j];
+                }
+                b[i] /= mLU[i][i];
+            }
+        }
+
+        Mat mLU;
+        Array<SizeType, Dimension> mPivots;
+        bool mOddPermutation = false;
+        bool mSingular = false;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Cholesky decomposition, A = L * L^T
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Only the lower triangle of the input is read, the matrix
+    // is assumed to be symmetric.
+    template <Concept::MatrixN Mat>
+        requires Concept::StrongFloatType<typename Mat::ScalarType>
+    class CholeskyDecomposition final
+    {
+    public:
+        using MatrixType = Mat;
+        using VectorType = typename Mat::VectorType;
+        using ScalarType = typename Mat::ScalarType;
+        static constexpr SizeType Dimension = Mat::Dimension;
+
+        constexpr explicit CholeskyDecomposition(const Mat& m) noexcept
+            : mL()
+        {
+            for (SizeType j = 0; j < Dimension; ++j)
+            {
+                ScalarType diagonal = m[j][j];
+                for (SizeType k = 0; k < j; ++k)
+                {
+                    diagonal -= mL[j][k] * mL[j][k];
+                }
+
+                if (!(diagonal > Cast<ScalarType>(0)))
+                {
+                    mPositiveDefinite = false;
+                    return;
+                }
+
+                mL[j][j] = Sqrt(diagonal);
+                ScalarType inverse = Cast<ScalarType>(1) / mL[j][j];
+                for (SizeType i = j + 1; i < Dimension; ++i)
+                {
+                    ScalarType sum = m[i][j];
+                    for (SizeType k = 0; k < j; ++k)
+                    {
+                        sum -= mL[i][k] * mL[j][k];
+                    }
+                    mL[i][j] = sum * inverse;
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr bool IsPositiveDefinite() const noexcept { return mPositiveDefinite; }
+
+        [[nodiscard]] constexpr
+        ScalarType Determinant() const noexcept
+        {
+            ScalarType result = Cast<ScalarType>(1);
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                result *= mL[i][i];
+            }
+            return result * result;
+        }
+
+        constexpr void SolveInPlace(VectorType& b) const noexcept { Substitute(b); }
+        constexpr void SolveInPlace(Mat& b)        const noexcept { Substitute(b); }
+
+        [[nodiscard]] constexpr VectorType Solve(VectorType b) const noexcept { Substitute(b); return b; }
+        [[nodiscard]] constexpr Mat        Solve(Mat b)        const noexcept { Substitute(b); return b; }
+
+        [[nodiscard]] constexpr bool TrySolve(VectorType& b) const noexcept { if (!mPositiveDefinite) { return false; } Substitute(b); return true; }
+        [[nodiscard]] constexpr bool TrySolve(Mat& b)        const noexcept { if (!mPositiveDefinite) { return false; } Substitute(b); return true; }
+
+        [[nodiscard]] constexpr const Mat& Factor() const noexcept { return mL; }
+    private:
+        template <typename Rhs>
+        constexpr
+        void Substitute(Rhs& b) const noexcept
+        {
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                for (SizeType k = 0; k < i; ++k)
+                {
+                    b[i] -= mL[i][k] * b[k];
+                }
+                b[i] /= mL[i][i];
+            }
+
+            for (SizeType i = Dimension; i-- > 0;)
+            {
+                for (SizeType k = i + 1; k < Dimension; ++k)
+                {
+                    b[i] -= mL[k][i] * b[k];
+                }
+                b[i] /= mL[i][i];
+            }
+        }
+
+        Mat mL;
+        bool mPositiveDefinite = true;
+    };
+
+    namespace Implementation
+    {
+        // Note(3011): Householder QR shared by QRDecomposition and
+        // LeastSquaresQR. The storage is indexed as qr[row][column] for
+        // Rows >= Columns. The Householder vectors are kept below and on the
+        // diagonal, R is kept above the diagonal and in the diagonal array. A
+        // column whose remaining norm is within rounding of zero compared to
+        // the largest input column gets no reflection, its diagonal entry of
+        // R is zero and false is returned.
+        template <SizeType Rows, SizeType Columns, typename Storage, typename Scalar>
+        [[nodiscard]] constexpr
+        bool HouseholderFactorize(Storage& qr, Array<Scalar, Columns>& diagonal) noexcept
+        {
+            bool fullRank = true;
+
+            Scalar largest = {};
+            for (SizeType j = 0; j < Columns; ++j)
+            {
+                Scalar column = {};
+                for (SizeType i = 0; i < Rows; ++i)
+                {
+                    column += qr[i][j] * qr[i][j];
+                }
+                largest = Max(largest, Sqrt(column));
+            }
+            const Scalar threshold = largest * Scalar::Epsilon() * Cast<Scalar>(Rows);
+
+            for (SizeType k = 0; k < Columns; ++k)
+            {
+                Scalar norm = {};
+                for (SizeType i = k; i < Rows; ++i)
+                {
+                    norm += qr[i][k] * qr[i][k];
+                }
+                norm = Sqrt(norm);
+
+                if (norm > threshold)
+                {
+                    if (qr[k][k] < Cast<Scalar>(0))
+                    {
+                        norm = -norm;
+                    }
+
+                    for (SizeType i = k; i < Rows; ++i)
+                    {
+                        qr[i][k] /= norm;
+                    }
+                    qr[k][k] += Cast<Scalar>(1);
+
+                    for (SizeType j = k + 1; j < Columns; ++j)
+                    {
+                        Scalar s = {};
+                        for (SizeType i = k; i < Rows; ++i)
+                        {
+                            s += qr[i][k] * qr[i][j];
+                        }
+                        s = -s / qr[k][k];
+                        for (SizeType i = k; i < Rows; ++i)
+                        {
+                            qr[i][j] += s * qr[i][k];
+                        }
+                    }
+                }
+                else
+                {
+                    fullRank = false;
+                    norm = {};
+                    for (SizeType i = k; i < Rows; ++i)
+                    {
+                        qr[i][k] = {};
+                    }
+                }
+
+                diagonal[k] = -norm;
+            }
+
+            return fullRank;
+        }
+
+        // Note(3011): b = Q^T * b, columns without a reflection are skipped.
+        template <SizeType Rows, SizeType Columns, typename Storage, typename Rhs>
+        constexpr
+        void HouseholderApplyTranspose(const Storage& qr, Rhs& b) noexcept
+        {
+            using Scalar = std::remove_cvref_t<decltype(qr[0][0])>;
+
+            for (SizeType k = 0; k < Columns; ++k)
+            {
+                if (qr[k][k] == Cast<Scalar>(0))
+                {
+                    continue;
+                }
+
+                auto s = qr[k][k] * b[k];
+                for (SizeType i = k + 1; i < Rows; ++i)
+                {
+                    s += qr[i][k] * b[i];
+                }
+                s *= -Cast<Scalar>(1) / qr[k][k];
+                for (SizeType i = k; i < Rows; ++i)
+                {
+                    b[i] += qr[i][k] * s;
+                }
+            }
+        }
+
+        // Note(3011): R * x = b on the first Columns entries of b.
+        template <SizeType Columns, typename Storage, typename Scalar, typename Rhs>
+        constexpr
+        void HouseholderBackSubstitute(const Storage& qr, const Array<Scalar, Columns>& diagonal, Rhs& b) noexcept
+        {
+            for (SizeType k = Columns; k-- > 0;)
+            {
+                b[k] /= diagonal[k];
+                for (SizeType i = 0; i < k; ++i)
+                {
+                    b[i] -= qr[i][k] * b[k];
+                }
+            }
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // QR decomposition by Householder reflections, A = Q * R
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::MatrixN Mat>
+        requires Concept::StrongFloatType<typename Mat::ScalarType>
+    class QRDecomposition final
+    {
+    public:
+        using MatrixType = Mat;
+        using VectorType = typename Mat::VectorType;
+        using ScalarType = typename Mat::ScalarType;
+        static constexpr SizeType Dimension = Mat::Dimension;
+
+        constexpr explicit QRDecomposition(const Mat& m) noexcept
+            : mQR(m)
+            , mFullRank(Implementation::HouseholderFactorize<Dimension, Dimension>(mQR, mDiagonal))
+        {
+        }
+
+        [[nodiscard]] constexpr bool IsFullRank() const noexcept { return mFullRank; }
+
+        constexpr void SolveInPlace(VectorType& b) const noexcept { Substitute(b); }
+        constexpr void SolveInPlace(Mat& b)        const noexcept { Substitute(b); }
+
+        [[nodiscard]] constexpr VectorType Solve(VectorType b) const noexcept { Substitute(b); return b; }
+        [[nodiscard]] constexpr Mat        Solve(Mat b)        const noexcept { Substitute(b); return b; }
+
+        [[nodiscard]] constexpr bool TrySolve(VectorType& b) const noexcept { if (!mFullRank) { return false; } Substitute(b); return true; }
+        [[nodiscard]] constexpr bool TrySolve(Mat& b)        const noexcept { if (!mFullRank) { return false; } Substitute(b); return true; }
+
+        // Note(3011): Only the absolute value, the sign of Q is not tracked.
+        [[nodiscard]] constexpr
+        ScalarType AbsDeterminant() const noexcept
+        {
+            ScalarType result = Cast<ScalarType>(1);
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                result *= mDiagonal[i];
+            }
+            return Abs(result);
+        }
+    private:
+        template <typename Rhs>
+        constexpr
+        void Substitute(Rhs& b) const noexcept
+        {
+            Implementation::HouseholderApplyTranspose<Dimension, Dimension>(mQR, b);
+            Implementation::HouseholderBackSubstitute<Dimension>(mQR, mDiagonal, b);
+        }
+
+        Mat mQR;
+        Array<ScalarType, Dimension> mDiagonal;
+        bool mFullRank = true;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Least squares by Householder reflections, min |A * x - b|
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): A is given as Rows row vectors of Columns entries each, with
+    // Rows >= Columns. The reflections are applied to b directly, so unlike
+    // the normal equations A^T * A the condition number is not squared.
+    template <SizeType Rows, Concept::VectorN Vec>
+        requires Concept::StrongFloatType<typename Vec::ScalarType>
+              && (Rows >= Vec::Dimension)
+    class LeastSquaresQR final
+    {
+    public:
+        using VectorType = Vec;
+        using ScalarType = typename Vec::ScalarType;
+        using MatrixType = Array<Vec, Rows>;
+        using RhsType = Array<ScalarType, Rows>;
+        static constexpr SizeType Columns = Vec::Dimension;
+
+        constexpr explicit LeastSquaresQR(const MatrixType& rows) noexcept
+            : mQR(rows)
+            , mFullRank(Implementation::HouseholderFactorize<Rows, Columns>(mQR, mDiagonal))
+        {
+        }
+
+        [[nodiscard]] constexpr bool IsFullRank() const noexcept { return mFullRank; }
+
+        [[nodiscard]] constexpr
+        VectorType Solve(RhsType b) const noexcept
+        {
+            Implementation::HouseholderApplyTranspose<Rows, Columns>(mQR, b);
+            Implementation::HouseholderBackSubstitute<Columns>(mQR, mDiagonal, b);
+
+            VectorType x;
+            for (SizeType i = 0; i < Columns; ++i)
+            {
+                x[i] = b[i];
+            }
+            return x;
+        }
+
+        [[nodiscard]] constexpr
+        bool TrySolve(const RhsType& b, VectorType& x) const noexcept
+        {
+            if (!mFullRank)
+            {
+                return false;
+            }
+
+            x = Solve(b);
+            return true;
+        }
+
+        // Note(3011): |A * x - b| of the least squares solution x, read from
+        // the entries of Q^T * b that R cannot reach.
+        [[nodiscard]] constexpr
+        ScalarType ResidualNorm(RhsType b) const noexcept
+        {
+            Implementation::HouseholderApplyTranspose<Rows, Columns>(mQR, b);
+
+            ScalarType result = {};
+            for (SizeType i = Columns; i < Rows; ++i)
+            {
+                result += b[i] * b[i];
+            }
+            return Sqrt(result);
+        }
+    private:
+        MatrixType mQR;
+        Array<ScalarType, Columns> mDiagonal;
+        bool mFullRank = true;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_MATRIX_DECOMPOSITION_HPP
@@ -2,6 +2,8 @@
 #define MATHLIB_IMPLEMENTATION_MATRIX_OPERATORS_HPP
 
 #include "Base/Concepts.hpp"
+#include "MatrixSimd.hpp"
+#include "VectorOperators.hpp"
 
 namespace Math
 {
@@ -39,22 +41,84 @@ namespace Math
         return c;
     }
 
+    namespace Implementation
+    {
+        // Note(3011): Row vector times matrix as a sum of scaled rows,
+        // row[0] * m[0] + row[1] * m[1] + ... This walks the rows of m
+        // contiguously and uses the (possibly SIMD) vector operators.
+        template <Concept::BasicMatrix Mat>
+        [[nodiscard]] constexpr
+        typename Mat::VectorType MultiplyRow(const typename Mat::VectorType& row, const Mat& m) noexcept
+        {
+            typename Mat::VectorType result = m[0] * row[0];
+            for (SizeType k = 1; k < Mat::Dimension; ++k)
+            {
+                result += m[k] * row[k];
+            }
+            return result;
+        }
+
+        // Note(3011): Tiled i-k-j product for the general NxN matrices. A
+        // tile of b is reused for every row of a while it is still in the
+        // L1 cache, the innermost loop walks rows of b and c contiguously.
+        inline constexpr SizeType MultiplyBlockSize = 16;
+
+        template <Concept::BasicMatrix Mat>
+        [[nodiscard]] constexpr
+        Mat MultiplyBlocked(const Mat& a, const Mat& b) noexcept
+        {
+            constexpr SizeType N = Mat::Dimension;
+            constexpr SizeType Block = MultiplyBlockSize;
+
+            Mat c;
+            for (SizeType kk = 0; kk < N; kk += Block)
+            {
+                const SizeType kEnd = Min(kk + Block, N);
+                for (SizeType jj = 0; jj < N; jj += Block)
+                {
+                    const SizeType jEnd = Min(jj + Block, N);
+                    for (SizeType i = 0; i < N; ++i)
+                    {
+                        for (SizeType k = kk; k < kEnd; ++k)
+                        {
+                            const typename Mat::ScalarType aik = a[i][k];
+                            for (SizeType j = jj; j < jEnd; ++j)
+                            {
+                                c[i][j] += aik * b[k][j];
+                            }
+                        }
+                    }
+                }
+            }
+            return c;
+        }
+    }
+
     template <Concept::BasicMatrix Mat>
     [[nodiscard]] constexpr
     Mat operator* (const Mat& a, const Mat& b) noexcept
     {
-        Mat c;
-        for (SizeType i = 0; i < Mat::Dimension; ++i)
+        if constexpr (Mat::Dimension > 4)
         {
-            for (SizeType j = 0; j < Mat::Dimension; ++j)
+            return Implementation::MultiplyBlocked(a, b);
+        }
+        else
+        {
+            if constexpr (Implementation::Simd::IsMatrixAccelerated<Mat>)
             {
-                for (SizeType k = 0; k < Mat::Dimension; ++k)
+                if (!std::is_constant_evaluated())
                 {
-                    c[i][j] += a[i][k] * b[k][j];
+                    return Implementation::Simd::Multiply(a, b);
                 }
             }
+
+            Mat c;
+            for (SizeType i = 0; i < Mat::Dimension; ++i)
+            {
+                c[i] = Implementation::MultiplyRow(a[i], b);
+            }
+            return c;
         }
-        return c;
     }
 
 
@@ -0,0 +1,272 @@
+#ifndef MATHLIB_IMPLEMENTATION_MATRIX_SIMD_HPP
+#define MATHLIB_IMPLEMENTATION_MATRIX_SIMD_HPP
+
+#include "Base/Simd.hpp"
+#include "Matrix.hpp"
+
+namespace Math::Implementation::Simd
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Matrix selection
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Mat>
+    struct MatrixRegister
+    {
+        static constexpr bool Enabled = false;
+    };
+
+    // Note(3011): Only 4x4 matrices get a dedicated kernel, every row maps
+    // onto exactly one register. Smaller matrices go through the vector
+    // operators, which are accelerated on their own.
+    template <typename T>
+    struct MatrixRegister<Matrix4T<StrongFloatType<T>>>
+    {
+        using Register = Register4<T>;
+        using Scalar = T;
+        static constexpr bool Enabled = Register::Enabled;
+    };
+
+    template <typename Mat>
+    inline constexpr bool IsMatrixAccelerated = MatrixRegister<Mat>::Enabled;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Kernels
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Row-broadcast formulation, row i of the product is
+    // a[i][0] * b[0] + a[i][1] * b[1] + a[i][2] * b[2] + a[i][3] * b[3].
+    // The rows of b stay in registers for the whole product.
+    template <typename Reg, typename Scalar>
+    [[nodiscard]] inline
+    typename Reg::Type MultiplyRow(const Scalar* row, const typename Reg::Type (&b)[4]) noexcept
+    {
+        typename Reg::Type result = Reg::Mul(Reg::Broadcast(row[0]), b[0]);
+        result = Reg::MulAdd(Reg::Broadcast(row[1]), b[1], result);
+        result = Reg::MulAdd(Reg::Broadcast(row[2]), b[2], result);
+        result = Reg::MulAdd(Reg::Broadcast(row[3]), b[3], result);
+        return result;
+    }
+
+    template <typename Mat>
+    [[nodiscard]] inline
+    Mat Multiply(const Mat& a, const Mat& b) noexcept
+    {
+        using Reg = typename MatrixRegister<Mat>::Register;
+        using Scalar = typename MatrixRegister<Mat>::Scalar;
+
+        const Scalar* lhs = reinterpret_cast<const Scalar*>(&a[0]);
+        const Scalar* rhs = reinterpret_cast<const Scalar*>(&b[0]);
+
+        const typename Reg::Type rows[4] = {
+            Reg::Load4(rhs +  0),
+            Reg::Load4(rhs +  4),
+            Reg::Load4(rhs +  8),
+            Reg::Load4(rhs + 12),
+        };
+
+        Mat c;
+        Scalar* out = reinterpret_cast<Scalar*>(&c[0]);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            Reg::Store4(out + 4 * i, MultiplyRow<Reg>(lhs + 4 * i, rows));
+        }
+        return c;
+    }
+
+    template <typename Mat>
+    [[nodiscard]] inline
+    Mat MultiplyTransposed(const Mat& a, const Mat& b) noexcept
+    {
+        using Reg = typename MatrixRegister<Mat>::Register;
+        using Scalar = typename MatrixRegister<Mat>::Scalar;
+
+        const Scalar* lhs = reinterpret_cast<const Scalar*>(&a[0]);
+        const Scalar* rhs = reinterpret_cast<const Scalar*>(&b[0]);
+
+        Scalar transposed[16];
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                transposed[4 * j + i] = rhs[4 * i + j];
+            }
+        }
+
+        const typename Reg::Type rows[4] = {
+            Reg::Load4(transposed +  0),
+            Reg::Load4(transposed +  4),
+            Reg::Load4(transposed +  8),
+            Reg::Load4(transposed + 12),
+        };
+
+        Mat c;
+        Scalar* out = reinterpret_cast<Scalar*>(&c[0]);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            Reg::Store4(out + 4 * i, MultiplyRow<Reg>(lhs + 4 * i, rows));
+        }
+        return c;
+    }
+
+    // Note(3011): a * b * c without materializing a * b, every row of a is
+    // pushed through both products while it is still in a register.
+    template <typename Mat>
+    [[nodiscard]] inline
+    Mat Multiply(const Mat& a, const Mat& b, const Mat& c) noexcept
+    {
+        using Reg = typename MatrixRegister<Mat>::Register;
+        using Scalar = typename MatrixRegister<Mat>::Scalar;
+
+        const Scalar* lhs = reinterpret_cast<const Scalar*>(&a[0]);
+        const Scalar* mid = reinterpret_cast<const Scalar*>(&b[0]);
+        const Scalar* rhs = reinterpret_cast<const Scalar*>(&c[0]);
+
+        const typename Reg::Type midRows[4] = {
+            Reg::Load4(mid +  0),
+            Reg::Load4(mid +  4),
+            Reg::Load4(mid +  8),
+            Reg::Load4(mid + 12),
+        };
+
+        const typename Reg::Type rhsRows[4] = {
+            Reg::Load4(rhs +  0),
+            Reg::Load4(rhs +  4),
+            Reg::Load4(rhs +  8),
+            Reg::Load4(rhs + 12),
+        };
+
+        Mat d;
+        Scalar* out = reinterpret_cast<Scalar*>(&d[0]);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            Scalar row[4];
+            Reg::Store4(row, MultiplyRow<Reg>(lhs + 4 * i, midRows));
+            Reg::Store4(out + 4 * i, MultiplyRow<Reg>(row, rhsRows));
+        }
+        return d;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Inverse
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Mat>
+    inline constexpr bool IsInverseAccelerated = false;
+
+    // Note(3011): Only defined for the accelerated matrices below, the
+    // declaration keeps the dispatch in Invert well-formed everywhere.
+    template <typename Mat>
+    [[nodiscard]] inline
+    Mat Invert(const Mat& m, typename Mat::ScalarType& determinant) noexcept;
+
+#if defined(MATH_SIMD_SSE2)
+    // Note(3011): Block-wise inverse, the matrix is split into the 2x2
+    // blocks A B / C D, each held in one register. The inverse is built from
+    // the adjugates of the blocks, which only needs lane shuffles and no
+    // scalar round trips. Lanes of a block are stored as (00, 01, 10, 11).
+    template <>
+    inline constexpr bool IsInverseAccelerated<Matrix4T<f32>> = true;
+
+    namespace Inverse
+    {
+        template <int X, int Y, int Z, int W>
+        [[nodiscard]] inline
+        __m128 Swizzle(__m128 a) noexcept
+        {
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        template <int X, int Y, int Z, int W>
+        [[nodiscard]] inline
+        __m128 Shuffle(__m128 a, __m128 b) noexcept
+        {
+            return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        // Note(3011): a * b
+        [[nodiscard]] inline
+        __m128 Multiply(__m128 a, __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // Note(3011): Adjugate(a) * b
+        [[nodiscard]] inline
+        __m128 AdjugateMultiply(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                              _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // Note(3011): a * Adjugate(b)
+        [[nodiscard]] inline
+        __m128 MultiplyAdjugate(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+    }
+
+    template <>
+    [[nodiscard]] inline
+    Matrix4T<f32> Invert(const Matrix4T<f32>& m, f32& determinant) noexcept
+    {
+        using namespace Inverse;
+
+        const float* in = reinterpret_cast<const float*>(&m[0]);
+        const __m128 row0 = _mm_loadu_ps(in +  0);
+        const __m128 row1 = _mm_loadu_ps(in +  4);
+        const __m128 row2 = _mm_loadu_ps(in +  8);
+        const __m128 row3 = _mm_loadu_ps(in + 12);
+
+        const __m128 a = _mm_movelh_ps(row0, row1);
+        const __m128 b = _mm_movehl_ps(row1, row0);
+        const __m128 c = _mm_movelh_ps(row2, row3);
+        const __m128 d = _mm_movehl_ps(row3, row2);
+
+        // Note(3011): Determinants of the blocks as (|A|, |B|, |C|, |D|).
+        const __m128 blockDeterminants = _mm_sub_ps(
+            _mm_mul_ps(Shuffle<0, 2, 0, 2>(row0, row2), Shuffle<1, 3, 1, 3>(row1, row3)),
+            _mm_mul_ps(Shuffle<1, 3, 1, 3>(row0, row2), Shuffle<0, 2, 0, 2>(row1, row3)));
+        const __m128 detA = Swizzle<0, 0, 0, 0>(blockDeterminants);
+        const __m128 detB = Swizzle<1, 1, 1, 1>(blockDeterminants);
+        const __m128 detC = Swizzle<2, 2, 2, 2>(blockDeterminants);
+        const __m128 detD = Swizzle<3, 3, 3, 3>(blockDeterminants);
+
+        const __m128 dc = AdjugateMultiply(d, c);
+        const __m128 ab = AdjugateMultiply(a, b);
+
+        // Note(3011): Adjugates of the blocks of the inverse, scaled by |M|.
+        __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Multiply(b, dc));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Multiply(c, ab));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), MultiplyAdjugate(d, ab));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), MultiplyAdjugate(a, dc));
+
+        // Note(3011): |M| = |A||D| + |B||C| - tr(Adjugate(A) B Adjugate(D) C)
+        const __m128 trace = Register4<float>::HorizontalSum(_mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc)));
+        const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+        const __m128 scale = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        x = _mm_mul_ps(x, scale);
+        y = _mm_mul_ps(y, scale);
+        z = _mm_mul_ps(z, scale);
+        w = _mm_mul_ps(w, scale);
+
+        // Note(3011): The shuffles apply the final adjugate of every block
+        // and interleave the blocks back into rows.
+        Matrix4T<f32> result;
+        float* out = reinterpret_cast<float*>(&result[0]);
+        _mm_storeu_ps(out +  0, Shuffle<3, 1, 3, 1>(x, y));
+        _mm_storeu_ps(out +  4, Shuffle<2, 0, 2, 0>(x, y));
+        _mm_storeu_ps(out +  8, Shuffle<3, 1, 3, 1>(z, w));
+        _mm_storeu_ps(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+
+        determinant = f32(_mm_cvtss_f32(det));
+        return result;
+    }
+#endif
+}
+
+#endif //MATHLIB_IMPLEMENTATION_MATRIX_SIMD_HPP
@@ -2,6 +2,10 @@
 #define MATHLIB_IMPLEMENTATION_MATRIX_UTILITIES_HPP
 
 #include "Base/Concepts.hpp"
+#include "MatrixDecomposition.hpp"
+#include "MatrixOperators.hpp"
+#include "MatrixSimd.hpp"
+#include "VectorUtilities.hpp"
 
 namespace Math
 {
@@ -20,6 +24,71 @@ namespace Math
         return result;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Products
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Computes a * Transpose(b) without building the transpose,
+    // every element is a dot product of two rows.
+    template <Concept::Matrix Mat>
+    [[nodiscard]] constexpr
+    Mat MultiplyTransposed(const Mat& a, const Mat& b) noexcept
+    {
+        if constexpr (Implementation::Simd::IsMatrixAccelerated<Mat>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::MultiplyTransposed(a, b);
+            }
+        }
+
+        Mat c;
+        for (SizeType i = 0; i < Mat::Dimension; ++i)
+        {
+            for (SizeType j = 0; j < Mat::Dimension; ++j)
+            {
+                c[i][j] = Dot(a[i], b[j]);
+            }
+        }
+        return c;
+    }
+
+    // Note(3011): Chained product a * b * ... evaluated row by row, each row
+    // of a is pushed through all the remaining matrices, so no intermediate
+    // matrix is ever stored.
+    template <Concept::Matrix Mat, Concept::IsSame<Mat>... Mats>
+    [[nodiscard]] constexpr
+    Mat Multiply(const Mat& a, const Mat& b, const Mats&... rest) noexcept
+    {
+        if constexpr (sizeof...(Mats) == 0)
+        {
+            return a * b;
+        }
+        else
+        {
+            if constexpr (Implementation::Simd::IsMatrixAccelerated<Mat> && sizeof...(Mats) == 1)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    return Implementation::Simd::Multiply(a, b, rest...);
+                }
+            }
+
+            Mat result;
+            for (SizeType i = 0; i < Mat::Dimension; ++i)
+            {
+                typename Mat::VectorType row = Implementation::MultiplyRow(a[i], b);
+                ((row = Implementation::MultiplyRow(row, rest)), ...);
+                result[i] = row;
+            }
+            return result;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Determinant, Adjugate, Invert
+    //////////////////////////////////////////////////////////////////////////
+
     template <Concept::Matrix2 Mat>
     [[nodiscard]] constexpr
     typename Mat::ScalarType Determinant(const Mat& m) noexcept
@@ -40,34 +109,59 @@ namespace Math
              - (m[0][0] * m[1][2] * m[2][1]);
     }
 
+    namespace Implementation
+    {
+        // Note(3011): The twelve 2x2 sub-determinants shared by the 4x4
+        // determinant and inverse. Lower holds the minors of the top two rows,
+        // upper the minors of the bottom two rows.
+        template <Concept::Matrix4 Mat>
+        struct Minors4 final
+        {
+            using Scalar = typename Mat::ScalarType;
+
+            Scalar Lower[6];
+            Scalar Upper[6];
+
+            [[nodiscard]] constexpr
+            explicit Minors4(const Mat& m) noexcept
+                : Lower{ m[0][0] * m[1][1] - m[1][0] * m[0][1],
+                         m[0][0] * m[1][2] - m[1][0] * m[0][2],
+                         m[0][0] * m[1][3] - m[1][0] * m[0][3],
+                         m[0][1] * m[1][2] - m[1][1] * m[0][2],
+                         m[0][1] * m[1][3] - m[1][1] * m[0][3],
+                         m[0][2] * m[1][3] - m[1][2] * m[0][3] }
+                , Upper{ m[2][0] * m[3][1] - m[3][0] * m[2][1],
+                         m[2][0] * m[3][2] - m[3][0] * m[2][2],
+                         m[2][0] * m[3][3] - m[3][0] * m[2][3],
+                         m[2][1] * m[3][2] - m[3][1] * m[2][2],
+                         m[2][1] * m[3][3] - m[3][1] * m[2][3],
+                         m[2][2] * m[3][3] - m[3][2] * m[2][3] }
+            {}
+
+            [[nodiscard]] constexpr
+            Scalar Determinant() const noexcept
+            {
+                return Lower[0] * Upper[5] - Lower[1] * Upper[4] + Lower[2] * Upper[3]
+                     + Lower[3] * Upper[2] - Lower[4] * Upper[1] + Lower[5] * Upper[0];
+            }
+        };
+    }
+
     template <Concept::Matrix4 Mat>
     [[nodiscard]] constexpr
     typename Mat::ScalarType Determinant(const Mat& m) noexcept
     {
-        return (m[0][0] * m[1][1] * m[2][2] * m[3][3])
-             + (m[0][0] * m[1][2] * m[2][3] * m[3][1])
-             + (m[0][0] * m[1][3] * m[2][1] * m[3][2])
-             - (m[0][0] * m[1][3] * m[2][2] * m[3][1])
-             - (m[0][0] * m[1][2] * m[2][1] * m[3][3])
-             - (m[0][0] * m[1][1] * m[2][3] * m[3][2])
-             - (m[0][1] * m[1][0] * m[2][2] * m[3][3])
-             - (m[0][2] * m[1][0] * m[2][3] * m[3][1])
-             - (m[0][3] * m[1][0] * m[2][1] * m[3][2])
-             + (m[0][3] * m[1][0] * m[2][2] * m[3][1])
-             + (m[0][2] * m[1][0] * m[2][1] * m[3][3])
-             + (m[0][1] * m[1][0] * m[2][3] * m[3][2])
-             + (m[0][1] * m[1][2] * m[2][0] * m[3][3])
-             + (m[0][2] * m[1][3] * m[2][0] * m[3][1])
-             + (m[0][3] * m[1][1] * m[2][0] * m[3][2])
-             - (m[0][3] * m[1][2] * m[2][0] * m[3][1])
-             - (m[0][2] * m[1][1] * m[2][0] * m[3][3])
-             - (m[0][1] * m[1][3] * m[2][0] * m[3][2])
-             - (m[0][1] * m[1][2] * m[2][3] * m[3][0])
-             - (m[0][2] * m[1][3] * m[2][1] * m[3][0])
-             - (m[0][3] * m[1][1] * m[2][2] * m[3][0])
-             + (m[0][3] * m[1][2] * m[2][1] * m[3][0])
-             + (m[0][2] * m[1][1] * m[2][3] * m[3][0])
-             + (m[0][1] * m[1][3] * m[2][2] * m[3][0]);
+        return Implementation::Minors4<Mat>(m).Determinant();
+    }
+
+    // Note(3011): Cofactor expansion grows factorially, larger matrices go
+    // through an LU decomposition instead.
+    template <Concept::MatrixN Mat>
+        requires (Mat::Dimension > 4)
+    [[nodiscard]] constexpr
+    typename Mat::ScalarType Determinant(const Mat& m) noexcept
+    {
+        return LUDecomposition<Mat>(m).Determinant();
     }
 
     template <Concept::Matrix2 Mat>
@@ -121,11 +215,134 @@ namespace Math
         return result;
     }
 
+    namespace Implementation
+    {
+        // Note(3011): Returns the adjugate and stores the determinant, both
+        // are computed from the same set of minors.
+        template <Concept::Matrix Mat>
+        [[nodiscard]] constexpr
+        Mat AdjugateAndDeterminant(const Mat& m, typename Mat::ScalarType& determinant) noexcept
+        {
+            if constexpr (Concept::Matrix4<Mat>)
+            {
+                Minors4<Mat> minors(m);
+                const auto* s = minors.Lower;
+                const auto* c = minors.Upper;
+
+                Mat result;
+                result[0][0] =  m[1][1] * c[5] - m[1][2] * c[4] + m[1][3] * c[3];
+                result[0][1] = -m[0][1] * c[5] + m[0][2] * c[4] - m[0][3] * c[3];
+                result[0][2] =  m[3][1] * s[5] - m[3][2] * s[4] + m[3][3] * s[3];
+                result[0][3] = -m[2][1] * s[5] + m[2][2] * s[4] - m[2][3] * s[3];
+                result[1][0] = -m[1][0] * c[5] + m[1][2] * c[2] - m[1][3] * c[1];
+                result[1][1] =  m[0][0] * c[5] - m[0][2] * c[2] + m[0][3] * c[1];
+                result[1][2] = -m[3][0] * s[5] + m[3][2] * s[2] - m[3][3] * s[1];
+                result[1][3] =  m[2][0] * s[5] - m[2][2] * s[2] + m[2][3] * s[1];
+                result[2][0] =  m[1][0] * c[4] - m[1][1] * c[2] + m[1][3] * c[0];
+                result[2][1] = -m[0][0] * c[4] + m[0][1] * c[2] - m[0][3] * c[0];
+                result[2][2] =  m[3][0] * s[4] - m[3][1] * s[2] + m[3][3] * s[0];
+                result[2][3] = -m[2][0] * s[4] + m[2][1] * s[2] - m[2][3] * s[0];
+                result[3][0] = -m[1][0] * c[3] + m[1][1] * c[1] - m[1][2] * c[0];
+                result[3][1] =  m[0][0] * c[3] - m[0][1] * c[1] + m[0][2] * c[0];
+                result[3][2] = -m[3][0] * s[3] + m[3][1] * s[1] - m[3][2] * s[0];
+                result[3][3] =  m[2][0] * s[3] - m[2][1] * s[1] + m[2][2] * s[0];
+
+                determinant = minors.Determinant();
+                return result;
+            }
+            else
+            {
+                // Note(3011): Expansion along the first row, the cofactors
+                // are the first column of the adjugate.
+                Mat result = Adjugate(m);
+                determinant = {};
+                for (SizeType i = 0; i < Mat::Dimension; ++i)
+                {
+                    determinant += m[0][i] * result[i][0];
+                }
+                return result;
+            }
+        }
+    }
+
+    template <Concept::Matrix Mat>
+        requires (Mat::Dimension <= 4)
+    [[nodiscard]] constexpr
+    Mat Invert(const Mat& m) noexcept
+    {
+        using Scalar = typename Mat::ScalarType;
+
+        if constexpr (Implementation::Simd::IsInverseAccelerated<Mat>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Scalar determinant;
+                return Implementation::Simd::Invert(m, determinant);
+            }
+        }
+
+        Scalar determinant;
+        Mat adjugate = Implementation::AdjugateAndDeterminant(m, determinant);
+        return adjugate * (Cast<Scalar>(1) / determinant);
+    }
+
+    // Note(3011): Same as Invert, but leaves inverse untouched and returns
+    // false when the absolute value of the determinant is not above epsilon.
     template <Concept::Matrix Mat>
+        requires (Mat::Dimension <= 4)
+    [[nodiscard]] constexpr
+    bool TryInvert(const Mat& m, Mat& inverse, typename Mat::ScalarType epsilon = 0) noexcept
+    {
+        using Scalar = typename Mat::ScalarType;
+
+        if constexpr (Implementation::Simd::IsInverseAccelerated<Mat>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                Scalar determinant;
+                Mat result = Implementation::Simd::Invert(m, determinant);
+                if (!(Abs(determinant) > epsilon))
+                {
+                    return false;
+                }
+
+                inverse = result;
+                return true;
+            }
+        }
+
+        Scalar determinant;
+        Mat adjugate = Implementation::AdjugateAndDeterminant(m, determinant);
+        if (!(Abs(determinant) > epsilon))
+        {
+            return false;
+        }
+
+        inverse = adjugate * (Cast<Scalar>(1) / determinant);
+        return true;
+    }
+
+    template <Concept::MatrixN Mat>
+        requires (Mat::Dimension > 4)
     [[nodiscard]] constexpr
     Mat Invert(const Mat& m) noexcept
     {
-        return Adjugate(m) / Determinant(m);
+        return LUDecomposition<Mat>(m).Invert();
+    }
+
+    template <Concept::MatrixN Mat>
+        requires (Mat::Dimension > 4)
+    [[nodiscard]] constexpr
+    bool TryInvert(const Mat& m, Mat& inverse, typename Mat::ScalarType epsilon = 0) noexcept
+    {
+        LUDecomposition<Mat> lu(m);
+        if (lu.IsSingular() || !(Abs(lu.Determinant()) > epsilon))
+        {
+            return false;
+        }
+
+        inverse = lu.Invert();
+        return true;
     }
 }
 
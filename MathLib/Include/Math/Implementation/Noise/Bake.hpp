@@ -0,0 +1,139 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
+
+#include "../Base/Parallel.hpp"
+#include "../../Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace Math
+{
+    namespace Implementation
+    {
+        // Note(3011): Smallest number of texels a thread is handed with
+        // Execution::Parallel. A noise sample costs tens of nanoseconds, so
+        // this is far below the threshold of the batched transforms.
+        inline constexpr std::size_t BakeRange = std::size_t(1) << 12;
+
+        // Note(3011): Same contract as the FillGrid member of the noises,
+        // falls back to point-wise sampling for noises without one.
+        template <typename NoiseType, typename Vec, typename Dims, typename Float>
+        void SampleGrid(const NoiseType& noise, const Vec& origin, const Vec& step, const Dims& dims, std::span<Float> out) noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            if constexpr (requires { noise.FillGrid(origin, step, dims, out); })
+            {
+                noise.FillGrid(origin, step, dims, out);
+            }
+            else
+            {
+                SizeType rows = 1;
+                for (SizeType a = 1; a < D; ++a)
+                {
+                    rows *= dims[a];
+                }
+
+                Vec point;
+                Float* result = out.data();
+                for (SizeType row = 0; row < rows; ++row)
+                {
+                    SizeType index = row;
+                    for (SizeType a = 1; a < D; ++a)
+                    {
+                        point[a] = origin[a] + Cast<Float>(index % dims[a]) * step[a];
+                        index /= dims[a];
+                    }
+
+                    for (SizeType i = 0; i < dims[0]; ++i)
+                    {
+                        point[0] = origin[0] + Cast<Float>(i) * step[0];
+                        *result++ = noise(point);
+                    }
+                }
+            }
+        }
+
+        // Note(3011): Fills the rows [begin, end) of the texture, one grid
+        // of a single row at a time.
+        template <typename NoiseType, typename Vec, typename Dims, typename Float>
+        void BakeRows(const NoiseType& noise, const Vec& step, const Dims& dims, std::span<Float> out,
+                      std::size_t begin, std::size_t end) noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            const std::size_t width = ToUnderlying(dims[0]);
+
+            Dims rowDims = dims;
+            for (SizeType a = 1; a < D; ++a)
+            {
+                rowDims[a] = SizeType(1);
+            }
+
+            Vec origin = step / Float(2);
+            for (std::size_t row = begin; row < end; ++row)
+            {
+                SizeType index = Cast<SizeType>(row);
+                for (SizeType a = 1; a < D; ++a)
+                {
+                    origin[a] = (Cast<Float>(index % dims[a]) + Float(0.5)) * step[a];
+                    index /= dims[a];
+                }
+
+                SampleGrid(noise, origin, step, rowDims, out.subspan(row * width, width));
+            }
+        }
+
+        template <Execution Policy, typename NoiseType, typename Vec, typename Dims, typename Float>
+        void Bake(const NoiseType& noise, const Vec& extent, const Dims& dims, std::span<Float> out)
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            Vec step;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                step[a] = extent[a] / Cast<Float>(dims[a]);
+            }
+
+            std::size_t rows = 1;
+            for (SizeType a = 1; a < D; ++a)
+            {
+                rows *= ToUnderlying(dims[a]);
+            }
+
+            const std::size_t width = std::max<std::size_t>(ToUnderlying(dims[0]), 1);
+            ForRange<Policy>(rows, BakeRange / width, [&](std::size_t begin, std::size_t end)
+            {
+                BakeRows(noise, step, dims, out, begin, end);
+            });
+        }
+    }
+
+    namespace Noise
+    {
+        // Note(3011): Bakes the box [0, extent) of a noise into a texture of
+        // dims texels, written with x varying fastest, so out must hold the
+        // product of dims. Texels are sampled at their centers. When extent
+        // is a multiple of the period of a periodic noise, the texture tiles
+        // seamlessly. Execution::Parallel splits the rows across threads.
+        // Noises with a FillGrid API are baked a row at a time through it.
+        template <Execution Policy = Execution::Parallel, typename NoiseType, Concept::FloatingPointType Float>
+        void Bake(const NoiseType& noise, const Vector2T<Float>& extent, const Vector2sz& dims, std::span<std::type_identity_t<Float>> out)
+        noexcept(Policy == Execution::Sequential)
+        {
+            Implementation::Bake<Policy>(noise, extent, dims, out);
+        }
+
+        template <Execution Policy = Execution::Parallel, typename NoiseType, Concept::FloatingPointType Float>
+        void Bake(const NoiseType& noise, const Vector3T<Float>& extent, const Vector3sz& dims, std::span<std::type_identity_t<Float>> out)
+        noexcept(Policy == Execution::Sequential)
+        {
+            Implementation::Bake<Policy>(noise, extent, dims, out);
+        }
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_BAKE_HPP
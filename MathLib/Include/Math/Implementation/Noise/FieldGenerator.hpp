@@ -0,0 +1,325 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_FIELD_GENERATOR_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_FIELD_GENERATOR_HPP
+
+#include "Bake.hpp"
+#include "../Base/Parallel.hpp"
+#include "../Random/Splitmix.hpp"
+#include "../../Vector.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Note(3011): Evaluates a noise over 3D volumes of the integer sample
+// lattice, for streaming worlds that request overlapping regions as the
+// camera moves. A volume is split into cubic chunks, chunks missing from
+// the cache are generated across threads, and the most recently used
+// chunks are kept in memory. Sample i of LOD l lies at i * Spacing * 2^l,
+// so every LOD halves the resolution of the previous one.
+
+namespace Math::Noise
+{
+    template <Concept::FloatingPointType Float>
+    struct FieldSettings
+    {
+        // Note(3011): Samples along every axis of a chunk.
+        SizeType ChunkSize = 32;
+
+        // Note(3011): Number of chunks kept in the cache.
+        SizeType Capacity = 256;
+
+        // Note(3011): Distance between neighbouring samples at LOD 0.
+        Float Spacing = Float(1);
+    };
+
+    // Note(3011): NoiseType is any noise that is callable with a Vector3T,
+    // like Perlin or Layer. The factory builds the noise of a seed, so it
+    // carries everything else the noise is configured with, e.g. layer
+    // settings or a period, and it is called from several threads at once.
+    // Every call names the seed it wants, so one generator serves several
+    // fields. Without a factory the noise is constructed from the seed
+    // alone.
+    template <typename NoiseType>
+    class FieldGenerator final
+    {
+    public:
+        using ValueType = typename NoiseType::ValueType;
+        using SettingsType = FieldSettings<ValueType>;
+        using ChunkType = std::shared_ptr<const std::vector<ValueType>>;
+        using FactoryType = std::function<NoiseType(u64)>;
+
+        // Note(3011): The step of a LOD is Spacing * 2^lod, computed with a
+        // 64 bit shift.
+        static constexpr SizeType MaxLod = 63;
+
+        [[nodiscard]] explicit
+        FieldGenerator(const SettingsType& settings = SettingsType())
+            requires std::is_constructible_v<NoiseType, u64>
+            : FieldGenerator([](u64 seed) { return NoiseType(seed); }, settings)
+        {}
+
+        [[nodiscard]] explicit
+        FieldGenerator(FactoryType factory, const SettingsType& settings = SettingsType())
+            : mSettings(settings), mFactory(std::move(factory))
+        {}
+
+        // Note(3011): Writes the samples begin + index for all indices below
+        // dims at the given LOD, with x varying fastest, so out must hold
+        // the product of dims.
+        void Generate(u64 seed, const Vector3l& begin, const Vector3sz& dims, SizeType lod, std::span<ValueType> out)
+        {
+            assert(lod <= MaxLod);
+            if (dims[0] == 0 || dims[1] == 0 || dims[2] == 0)
+            {
+                return;
+            }
+
+            const i64 size = Cast<i64>(mSettings.ChunkSize);
+
+            Vector3l first;
+            Vector3sz count;
+            for (SizeType a = 0; a < 3; ++a)
+            {
+                first[a] = FloorDivide(begin[a], size);
+                count[a] = Cast<SizeType>(FloorDivide(begin[a] + Cast<i64>(dims[a]) - 1, size) - first[a] + 1);
+            }
+
+            std::vector<Key> keys;
+            keys.reserve(ToUnderlying(count[0] * count[1] * count[2]));
+            for (SizeType z = 0; z < count[2]; ++z)
+            {
+                for (SizeType y = 0; y < count[1]; ++y)
+                {
+                    for (SizeType x = 0; x < count[0]; ++x)
+                    {
+                        keys.push_back(Key{ seed, first + Vector3l(Cast<i64>(x), Cast<i64>(y), Cast<i64>(z)), lod });
+                    }
+                }
+            }
+
+            const std::vector<ChunkType> chunks = Acquire(keys);
+
+            for (std::size_t c = 0; c < keys.size(); ++c)
+            {
+                CopyChunk(*chunks[c], keys[c].Chunk * size, begin, dims, out);
+            }
+        }
+
+        // Note(3011): Returns a single chunk, generating it when it is not
+        // cached. The chunk stays valid after it is evicted.
+        [[nodiscard]]
+        ChunkType Chunk(u64 seed, const Vector3l& chunk, SizeType lod)
+        {
+            assert(lod <= MaxLod);
+            return Acquire(std::vector<Key>{ Key{ seed, chunk, lod } })[0];
+        }
+
+        [[nodiscard]]
+        u64 Hits() const
+        {
+            std::lock_guard lock(mMutex);
+            return mHits;
+        }
+
+        [[nodiscard]]
+        u64 Misses() const
+        {
+            std::lock_guard lock(mMutex);
+            return mMisses;
+        }
+
+        [[nodiscard]]
+        SizeType Size() const
+        {
+            std::lock_guard lock(mMutex);
+            return Cast<SizeType>(mEntries.size());
+        }
+
+        void Clear()
+        {
+            std::lock_guard lock(mMutex);
+            mEntries.clear();
+            mLookup.clear();
+        }
+
+        [[nodiscard]]
+        const SettingsType& Settings() const noexcept
+        {
+            return mSettings;
+        }
+
+    private:
+        struct Key
+        {
+            u64 Seed;
+            Vector3l Chunk;
+            SizeType Lod;
+
+            [[nodiscard]]
+            bool operator==(const Key& other) const noexcept
+            {
+                return Seed == other.Seed && Lod == other.Lod
+                    && Chunk[0] == other.Chunk[0] && Chunk[1] == other.Chunk[1] && Chunk[2] == other.Chunk[2];
+            }
+        };
+
+        struct KeyHash
+        {
+            [[nodiscard]]
+            std::size_t operator()(const Key& key) const noexcept
+            {
+                u64 hash = Implementation::Splitmix64(key.Seed ^ Cast<u64>(key.Lod))();
+                for (SizeType a = 0; a < 3; ++a)
+                {
+                    hash = Implementation::Splitmix64(hash ^ Cast<u64>(key.Chunk[a]))();
+                }
+                return static_cast<std::size_t>(ToUnderlying(hash));
+            }
+        };
+
+        using Entry = std::pair<Key, ChunkType>;
+
+        [[nodiscard]] static constexpr
+        i64 FloorDivide(i64 val, i64 size) noexcept
+        {
+            const i64 result = val / size;
+            return (val % size < 0) ? result - 1 : result;
+        }
+
+        // Note(3011): Looks the keys up, generates the missing chunks and
+        // inserts them. The lock is not held while generating, so other
+        // threads can be served from the cache in the meantime. Missing
+        // chunks are handed out one at a time from a shared counter, which
+        // keeps all threads busy when chunks differ in cost.
+        [[nodiscard]]
+        std::vector<ChunkType> Acquire(const std::vector<Key>& keys)
+        {
+            std::vector<ChunkType> result(keys.size());
+            std::vector<std::size_t> missing;
+            {
+                std::lock_guard lock(mMutex);
+                for (std::size_t i = 0; i < keys.size(); ++i)
+                {
+                    const auto it = mLookup.find(keys[i]);
+                    if (it == mLookup.end())
+                    {
+                        missing.push_back(i);
+                        continue;
+                    }
+
+                    mEntries.splice(mEntries.begin(), mEntries, it->second);
+                    result[i] = it->second->second;
+                }
+
+                mHits += Cast<u64>(keys.size() - missing.size());
+                mMisses += Cast<u64>(missing.size());
+            }
+
+            std::atomic<std::size_t> next = 0;
+            Implementation::ParallelFor(missing.size(), 1, [&](std::size_t, std::size_t)
+            {
+                for (std::size_t i = next++; i < missing.size(); i = next++)
+                {
+                    const Key& key = keys[missing[i]];
+                    result[missing[i]] = MakeChunk(key);
+                }
+            });
+
+            std::lock_guard lock(mMutex);
+            for (std::size_t i : missing)
+            {
+                Insert(keys[i], result[i]);
+            }
+            return result;
+        }
+
+        [[nodiscard]]
+        ChunkType MakeChunk(const Key& key) const
+        {
+            const SizeType size = mSettings.ChunkSize;
+            const ValueType step = mSettings.Spacing * Cast<ValueType>(u64(1) << key.Lod);
+
+            Vector3T<ValueType> origin;
+            for (SizeType a = 0; a < 3; ++a)
+            {
+                origin[a] = Cast<ValueType>(key.Chunk[a] * Cast<i64>(size)) * step;
+            }
+
+            auto chunk = std::make_shared<std::vector<ValueType>>(ToUnderlying(size * size * size));
+            Implementation::SampleGrid(mFactory(key.Seed), origin, Vector3T<ValueType>(step), Vector3sz(size),
+                                       std::span<ValueType>(*chunk));
+            return chunk;
+        }
+
+        // Note(3011): Called with the lock held. A chunk generated by two
+        // threads at once is kept only once.
+        void Insert(const Key& key, const ChunkType& chunk)
+        {
+            if (mLookup.contains(key))
+            {
+                return;
+            }
+
+            mEntries.emplace_front(key, chunk);
+            mLookup.emplace(key, mEntries.begin());
+
+            while (Cast<SizeType>(mEntries.size()) > mSettings.Capacity)
+            {
+                mLookup.erase(mEntries.back().first);
+                mEntries.pop_back();
+            }
+        }
+
+        // Note(3011): Copies the part of a chunk starting at sample
+        // chunkBegin that overlaps the requested volume, one x run at a time.
+        void CopyChunk(const std::vector<ValueType>& chunk, const Vector3l& chunkBegin,
+                       const Vector3l& begin, const Vector3sz& dims, std::span<ValueType> out) const noexcept
+        {
+            const i64 size = Cast<i64>(mSettings.ChunkSize);
+
+            Vector3l lo;
+            Vector3l hi;
+            for (SizeType a = 0; a < 3; ++a)
+            {
+                lo[a] = std::max(chunkBegin[a], begin[a]);
+                hi[a] = std::min(chunkBegin[a] + size, begin[a] + Cast<i64>(dims[a]));
+            }
+
+            const std::size_t width = static_cast<std::size_t>(ToUnderlying(hi[0] - lo[0]));
+            for (i64 z = lo[2]; z < hi[2]; ++z)
+            {
+                for (i64 y = lo[1]; y < hi[1]; ++y)
+                {
+                    const i64 source = ((z - chunkBegin[2]) * size + (y - chunkBegin[1])) * size + (lo[0] - chunkBegin[0]);
+                    const i64 target = ((z - begin[2]) * Cast<i64>(dims[1]) + (y - begin[1])) * Cast<i64>(dims[0]) + (lo[0] - begin[0]);
+
+                    const auto from = chunk.begin() + static_cast<std::ptrdiff_t>(ToUnderlying(source));
+                    std::copy(from, from + static_cast<std::ptrdiff_t>(width),
+                              out.begin() + static_cast<std::ptrdiff_t>(ToUnderlying(target)));
+                }
+            }
+        }
+
+        SettingsType mSettings;
+        FactoryType mFactory;
+
+        mutable std::mutex mMutex;
+        std::list<Entry> mEntries;
+        std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> mLookup;
+        u64 mHits = 0;
+        u64 mMisses = 0;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_FIELD_GENERATOR_HPP
@@ -0,0 +1,105 @@
+#ifndef MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HASH_HPP
+#define MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HASH_HPP
+
+#include "Permutation.hpp"
+#include "../Base/Array.hpp"
+#include "../Random/Splitmix.hpp"
+
+// Note(3011): Hash policies for the corners of a lattice cell. A policy is
+// constructed from a seed and maps the corners of a cell to hashes, where
+// corner c lies at next[a] along axis a when bit a of c is set and at
+// cell[a] otherwise. Classic policies expect the lattice of Ken Perlin's
+// reference implementation, which is mirrored at the origin, for axes
+// without a period.
+
+namespace Math::Noise
+{
+    // Note(3011): Chains byte lookups into a permutation from x to w, so
+    // corners that agree on the leading axes share a prefix of the chain
+    // and every prefix is looked up only once. Repeats every 256 cells.
+    class PermutationHash final
+    {
+    public:
+        static constexpr bool Classic = true;
+
+        [[nodiscard]] constexpr explicit
+        PermutationHash(u64 seed = 0) noexcept
+            : mPermutation(Implementation::MakePermutation(seed))
+        {}
+
+        template <SizeType D, SizeType N>
+        constexpr
+        void operator()(const Array<u32, D>& cell, const Array<u32, D>& next, Array<u32, N>& hashes) const noexcept
+        {
+            hashes[0] = 0;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                const SizeType count = SizeType(1) << a;
+                for (SizeType c = 0; c < count; ++c)
+                {
+                    const u32 hash = hashes[c];
+                    hashes[c]         = Cast<u32>(mPermutation[Cast<SizeType>((cell[a] + hash) & 255)]);
+                    hashes[c + count] = Cast<u32>(mPermutation[Cast<SizeType>((next[a] + hash) & 255)]);
+                }
+            }
+        }
+
+    private:
+        Array<u8, 256> mPermutation;
+    };
+
+    // Note(3011): Multiplies every coordinate with its own odd constant,
+    // combines the axes with the seed and mixes the result. The corners
+    // are independent of each other and need no memory, so the loop over
+    // them is plain integer arithmetic the compiler can vectorize. Only
+    // repeats at 2^32 cells or at the period of the noise.
+    class IntegerHash final
+    {
+    public:
+        static constexpr bool Classic = false;
+
+        [[nodiscard]] constexpr explicit
+        IntegerHash(u64 seed = 0) noexcept
+            : mSeed(Cast<u32>(Implementation::Splitmix64(seed)() >> 32))
+        {}
+
+        template <SizeType D, SizeType N>
+        constexpr
+        void operator()(const Array<u32, D>& cell, const Array<u32, D>& next, Array<u32, N>& hashes) const noexcept
+        {
+            Array<u32, D> low;
+            Array<u32, D> high;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                low[a]  = cell[a] * sMultipliers[a];
+                high[a] = next[a] * sMultipliers[a];
+            }
+
+            for (SizeType c = 0; c < N; ++c)
+            {
+                u32 hash = mSeed;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    hash ^= ToUnderlying((c >> a) & 1) ? high[a] : low[a];
+                }
+                hashes[c] = Mix(hash);
+            }
+        }
+
+    private:
+        // Note(3011): The finalizer of Splitmix32.
+        [[nodiscard]] static constexpr
+        u32 Mix(u32 val) noexcept
+        {
+            val = (val ^ (val >> 16)) * 0x21F0AAAD;
+            val = (val ^ (val >> 13)) * 0x735A2D97;
+            return val ^ (val >> 16);
+        }
+
+        static constexpr Array<u32, 4> sMultipliers = Array<u32, 4>(0x9E3779B1u, 0x85EBCA77u, 0xC2B2AE3Du, 0x27D4EB2Fu);
+
+        u32 mSeed;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_NOISE_LATTICE_HASH_HPP
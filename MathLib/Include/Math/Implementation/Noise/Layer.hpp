@@ -2,40 +2,318 @@
 #define MATHLIB_IMPLEMENTATION_NOISE_LAYER_HPP
 
 #include "../Base/Array.hpp"
+#include "../../Functions.hpp"
 #include "../../Vector.hpp"
 
+#include <algorithm>
+#include <span>
+
+// Note(3011): Sums octaves of a base noise (Perlin, Simplex, Worley) at
+// increasing frequencies. Every octave multiplies the frequency by the
+// lacunarity and the amplitude by the gain. Base noise values are expected
+// in [0, 1] and mapped to [-1, 1] before they are shaped:
+//
+//   FBm:        sum of the octaves.
+//   Ridged:     Musgrave's ridged multifractal, (1 - |n|)^2 per octave,
+//               weighted by the previous octave so ridges stay sharp.
+//   Billow:     sum of |n|, which folds every octave at its zero crossings.
+//   Turbulence: |sum of the octaves|, which folds the fBm result once.
+//
+// The sum is divided by the sum of the amplitudes, so every mode returns
+// values in [0, 1] for base noises that do.
+
 namespace Math::Noise
 {
+    enum class Fractal
+    {
+        FBm,
+        Ridged,
+        Billow,
+        Turbulence
+    };
+
+    template <Concept::FloatingPointType Float>
+    struct LayerSettings
+    {
+        SizeType Octaves = 6;
+        Float Frequency = Float(1);
+        Float Lacunarity = Float(2);
+        Float Gain = Float(0.5);
+        Fractal Mode = Fractal::FBm;
+
+        // Note(3011): Displaces the input by this many lattice units along
+        // a vector read from the base noise at the base frequency, before
+        // the octaves are evaluated. Zero disables domain warping.
+        Float Warp = Float(0);
+    };
+
     template <Concept::FloatingPointType Float, template <typename> typename BaseNoise>
     class Layer final
     {
     public:
         using ValueType = Float;
+        using SettingsType = LayerSettings<Float>;
 
         [[nodiscard]] constexpr explicit
-        Layer(u64 seed = 0) noexcept
-            : mBaseNoise(seed)
+        Layer(u64 seed = 0, const SettingsType& settings = SettingsType()) noexcept
+            : mBaseNoise(seed), mSettings(settings)
         {}
 
+        // Note(3011): footprint is the size of the area a sample stands for,
+        // for example a pixel projected into noise space. Octaves whose
+        // wavelength is shorter than about two footprints would only alias,
+        // they are faded out and then skipped. Zero evaluates every octave.
         [[nodiscard]] constexpr
-        Float operator()(const Vector2T<Float>& in) const noexcept
+        Float operator()(const Vector2T<Float>& in, Float footprint = Float(0)) const noexcept
         {
-            return Float(0);
+            return Sample(in, footprint);
         }
 
         [[nodiscard]] constexpr
-        Float operator()(const Vector3T<Float>& in) const noexcept
+        Float operator()(const Vector3T<Float>& in, Float footprint = Float(0)) const noexcept
         {
-            return Float(0);
+            return Sample(in, footprint);
         }
 
         [[nodiscard]] constexpr
-        Float operator()(const Vector4T<Float>& in) const noexcept
+        Float operator()(const Vector4T<Float>& in, Float footprint = Float(0)) const noexcept
         {
-            return Float(0);
+            return Sample(in, footprint);
         }
+
+        //////////////////////////////////////////////////////////////////////
+        // Batch evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Writes the noise value of in[i] to out[i], out must be
+        // at least as large as in. The points are processed in blocks, one
+        // octave at a time, and each octave of a block goes through the
+        // batch API of the base noise when it has one. This keeps the
+        // octave setup out of the inner loop and lets the base noise reuse
+        // its lattice lookups between neighbouring points.
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> in, std::span<Float> out, Float footprint = Float(0)) const noexcept
+        {
+            EvaluateBatch(in, out, footprint);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> in, std::span<Float> out, Float footprint = Float(0)) const noexcept
+        {
+            EvaluateBatch(in, out, footprint);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> in, std::span<Float> out, Float footprint = Float(0)) const noexcept
+        {
+            EvaluateBatch(in, out, footprint);
+        }
+
     private:
+        static constexpr std::size_t BlockSize = 64;
+
+        //////////////////////////////////////////////////////////////////////
+        // Octaves
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Every octave is shifted by a different amount, so the
+        // octaves don't line up at the origin of the lattice.
+        [[nodiscard]] static constexpr
+        Float OctaveShift(SizeType octave) noexcept
+        {
+            return Cast<Float>(octave) * Float(19.19);
+        }
+
+        // Note(3011): A sample covering footprint resolves frequencies up to
+        // the Nyquist limit 0.5 / footprint. The weight is 1 up to half of
+        // the limit (frequency * footprint = 0.25) and fades to 0 at the
+        // limit (frequency * footprint = 0.5).
+        [[nodiscard]] static constexpr
+        Float OctaveWeight(Float frequency, Float footprint) noexcept
+        {
+            return Clamp(2 - 4 * frequency * footprint);
+        }
+
+        [[nodiscard]] constexpr
+        Float Shape(Float val, Float& weight) const noexcept
+        {
+            const Float n = 2 * val - 1;
+            switch (mSettings.Mode)
+            {
+            case Fractal::Ridged:
+            {
+                Float signal = 1 - Abs(n);
+                signal *= signal * weight;
+                weight = Clamp(2 * signal);
+                return signal;
+            }
+            case Fractal::Billow:
+                return Abs(n);
+            default:
+                return n;
+            }
+        }
+
+        [[nodiscard]] constexpr
+        Float Finish(Float sum, Float total) const noexcept
+        {
+            const Float val = (total > 0) ? sum / total : Float(0);
+            switch (mSettings.Mode)
+            {
+            case Fractal::FBm:        return (val + 1) / 2;
+            case Fractal::Turbulence: return Abs(val);
+            default:                  return val;
+            }
+        }
+
+        // Note(3011): Each axis of the displacement reads the base noise at
+        // its own shift, so the axes are uncorrelated.
+        template <typename Vec>
+        [[nodiscard]] constexpr
+        Vec WarpShift(SizeType axis) const noexcept
+        {
+            return Vec(Cast<Float>(axis + 1) * Float(57.31));
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename Vec>
+        [[nodiscard]] constexpr
+        Float Sample(Vec in, Float footprint) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            if (mSettings.Warp != 0)
+            {
+                Vec displacement;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    displacement[a] = 2 * mBaseNoise(in * mSettings.Frequency + WarpShift<Vec>(a)) - 1;
+                }
+                in += displacement * mSettings.Warp;
+            }
+
+            Float frequency = mSettings.Frequency;
+            Float amplitude = 1;
+            Float weight = 1;
+            Float sum = 0;
+            Float total = 0;
+            for (SizeType octave = 0; octave < mSettings.Octaves; ++octave)
+            {
+                const Float fade = OctaveWeight(frequency, footprint) * amplitude;
+                if (fade <= 0)
+                {
+                    break;
+                }
+
+                sum += fade * Shape(mBaseNoise(in * frequency + OctaveShift(octave)), weight);
+                total += fade;
+
+                frequency *= mSettings.Lacunarity;
+                amplitude *= mSettings.Gain;
+            }
+            return Finish(sum, total);
+        }
+
+        template <typename Vec>
+        constexpr
+        void EvaluateBase(std::span<const Vec> in, std::span<Float> out) const noexcept
+        {
+            if constexpr (requires { mBaseNoise.Evaluate(in, out); })
+            {
+                mBaseNoise.Evaluate(in, out);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < in.size(); ++i)
+                {
+                    out[i] = mBaseNoise(in[i]);
+                }
+            }
+        }
+
+        template <typename Vec>
+        constexpr
+        void EvaluateBatch(std::span<const Vec> in, std::span<Float> out, Float footprint) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            Array<Vec, BlockSize> positions;
+            Array<Vec, BlockSize> scaled;
+            Array<Float, BlockSize> values;
+            Array<Float, BlockSize> weights;
+            Array<Float, BlockSize> sums;
+
+            for (std::size_t begin = 0; begin < in.size(); begin += BlockSize)
+            {
+                const std::size_t count = std::min(BlockSize, in.size() - begin);
+                const std::span<const Vec> block(scaled.Data(), count);
+                const std::span<Float> result(values.Data(), count);
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    positions[i] = in[begin + i];
+                    weights[i] = 1;
+                    sums[i] = 0;
+                }
+
+                if (mSettings.Warp != 0)
+                {
+                    for (SizeType a = 0; a < D; ++a)
+                    {
+                        const Vec shift = WarpShift<Vec>(a);
+                        for (std::size_t i = 0; i < count; ++i)
+                        {
+                            scaled[i] = in[begin + i] * mSettings.Frequency + shift;
+                        }
+
+                        EvaluateBase(block, result);
+                        for (std::size_t i = 0; i < count; ++i)
+                        {
+                            positions[i][a] += (2 * values[i] - 1) * mSettings.Warp;
+                        }
+                    }
+                }
+
+                Float frequency = mSettings.Frequency;
+                Float amplitude = 1;
+                Float total = 0;
+                for (SizeType octave = 0; octave < mSettings.Octaves; ++octave)
+                {
+                    const Float fade = OctaveWeight(frequency, footprint) * amplitude;
+                    if (fade <= 0)
+                    {
+                        break;
+                    }
+
+                    const Float shift = OctaveShift(octave);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        scaled[i] = positions[i] * frequency + shift;
+                    }
+
+                    EvaluateBase(block, result);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        sums[i] += fade * Shape(values[i], weights[i]);
+                    }
+                    total += fade;
+
+                    frequency *= mSettings.Lacunarity;
+                    amplitude *= mSettings.Gain;
+                }
+
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[begin + i] = Finish(sums[i], total);
+                }
+            }
+        }
+
         BaseNoise<Float> mBaseNoise;
+        SettingsType mSettings;
     };
 }
 
@@ -1,165 +1,416 @@
 #ifndef MATHLIB_IMPLEMENTATION_NOISE_PERLIN_HPP
 #define MATHLIB_IMPLEMENTATION_NOISE_PERLIN_HPP
 
+#include "LatticeHash.hpp"
 #include "../Base/Array.hpp"
 #include "../../Functions.hpp"
 #include "../../Random.hpp"
 #include "../../Vector.hpp"
 
+#include <span>
+
 namespace Math::Noise
 {
-    template <Concept::FloatingPointType Float>
+    // Note(3011): Hash is the policy that hashes the corners of a cell, see
+    // LatticeHash.hpp. PermutationHash reproduces the reference noise,
+    // IntegerHash avoids the dependent table lookups and the repetition
+    // every 256 cells.
+    template <Concept::FloatingPointType Float, typename Hash = PermutationHash>
     class Perlin final
     {
     public:
         using ValueType = Float;
+        using HashType = Hash;
 
         [[nodiscard]] constexpr explicit
         Perlin(u64 seed = 0) noexcept
-            : mPermutation(sDefaultPermutation)
+            : Perlin(seed, Array<SizeType, 4>(0, 0, 0, 0))
+        {}
+
+        // Note(3011): Wraps the lattice every period[a] cells along axis a,
+        // so the noise repeats with that period and a texture that covers
+        // whole periods tiles seamlessly. A period of 0 leaves the axis
+        // unwrapped, with PermutationHash that is the classic lattice, which
+        // repeats every 256 cells and is mirrored at the origin. Axes beyond
+        // the given ones use 0.
+        [[nodiscard]] constexpr
+        Perlin(u64 seed, const Vector2sz& period) noexcept
+            : Perlin(seed, Array<SizeType, 4>(period[0], period[1], 0, 0))
+        {}
+
+        [[nodiscard]] constexpr
+        Perlin(u64 seed, const Vector3sz& period) noexcept
+            : Perlin(seed, Array<SizeType, 4>(period[0], period[1], period[2], 0))
+        {}
+
+        [[nodiscard]] constexpr
+        Perlin(u64 seed, const Vector4sz& period) noexcept
+            : Perlin(seed, Array<SizeType, 4>(period[0], period[1], period[2], period[3]))
+        {}
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            if (ToUnderlying(seed))
-            {
-                Random64 rng(seed);
-                mPermutation.Shuffle<Random64, UniformDistribution>(rng);
-            }
+            return Sample(in);
         }
 
         [[nodiscard]] constexpr
-        Float operator()(const Vector2T<Float>& in) const noexcept
+        Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            using Int = SignedIntegerSelector<sizeof(Float)>;
+            return Sample(in);
+        }
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector4T<Float>& in) const noexcept
+        {
+            return Sample(in);
+        }
 
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
+        //////////////////////////////////////////////////////////////////////
+        // Batch evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Writes the noise value of in[i] to out[i], out must be
+        // at least as large as in. Consecutive points in the same lattice
+        // cell share the corner hashes, so coherent inputs like mesh
+        // vertices or paths are cheaper than random ones.
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
 
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
 
-            Float u = Smootherstep(xf, Float(0), Float(1));
-            Float v = Smootherstep(yf, Float(0), Float(1));
+        // Note(3011): Samples the regular grid origin + index * step for all
+        // indices below dims and writes the values with x varying fastest,
+        // so out must hold the product of dims. The lattice cell is hashed
+        // and collapsed to its x edge once per row, see CollapseCell, which
+        // leaves only a few multiply-adds per sample. Results match the
+        // point-wise evaluation up to rounding.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
 
-            Float v1 = Grad(Hash2(xi, yi, 0, 0), xf,     yf    );
-            Float v2 = Grad(Hash2(xi, yi, 1, 0), xf - 1, yf    );
-            Float v3 = Grad(Hash2(xi, yi, 0, 1), xf,     yf - 1);
-            Float v4 = Grad(Hash2(xi, yi, 1, 1), xf - 1, yf - 1);
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
 
-            return (Lerp(v, Lerp(u, v1, v2),
-                            Lerp(u, v3, v4)) + 2) / 4;
+        constexpr
+        void FillGrid(const Vector4T<Float>& origin, const Vector4T<Float>& step, const Vector4sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
         }
 
+    private:
+        template <SizeType D>
+        static constexpr SizeType Corners = SizeType(1) << D;
+
         [[nodiscard]] constexpr
-        Float operator()(const Vector3T<Float>& in) const noexcept
+        Perlin(u64 seed, const Array<SizeType, 4>& period) noexcept
+            : mHash(seed), mPeriod(period)
+        {}
+
+        //////////////////////////////////////////////////////////////////////
+        // Lattice
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Finds the cell of val along axis, the cell of the
+        // next corner and the offset into the cell.
+        constexpr
+        void Locate(Float val, SizeType axis, u32& cell, u32& next, Float& frac) const noexcept
         {
             using Int = SignedIntegerSelector<sizeof(Float)>;
 
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
-            u8 zi = Cast<u8>(Abs(Floor<Int>(in.z)) & 255);
+            const Int floor = Floor<Int>(val);
+            if (mPeriod[axis] == 0)
+            {
+                if constexpr (Hash::Classic)
+                {
+                    cell = Cast<u32>(Abs(floor));
+                    frac = Frac(val);
+                }
+                else
+                {
+                    cell = Cast<u32>(floor);
+                    frac = val - Cast<Float>(floor);
+                }
+                next = cell + 1;
+                return;
+            }
 
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
-            Float zf = Frac(in.z);
+            const Int period = Cast<Int>(mPeriod[axis]);
+            Int wrapped = floor % period;
+            wrapped += (wrapped < 0) ? period : Int(0);
 
-            Float u = Smootherstep(xf, Float(0), Float(1));
-            Float v = Smootherstep(yf, Float(0), Float(1));
-            Float w = Smootherstep(zf, Float(0), Float(1));
+            cell = Cast<u32>(wrapped);
+            next = (wrapped + 1 == period) ? u32(0) : cell + 1;
+            frac = val - Cast<Float>(floor);
+        }
 
-            Float v1 = Grad(Hash3(xi, yi, zi, 0, 0, 0), xf,     yf,     zf    );
-            Float v2 = Grad(Hash3(xi, yi, zi, 1, 0, 0), xf - 1, yf,     zf    );
-            Float v3 = Grad(Hash3(xi, yi, zi, 0, 1, 0), xf,     yf - 1, zf    );
-            Float v4 = Grad(Hash3(xi, yi, zi, 1, 1, 0), xf - 1, yf - 1, zf    );
-            Float v5 = Grad(Hash3(xi, yi, zi, 0, 0, 1), xf,     yf,     zf - 1);
-            Float v6 = Grad(Hash3(xi, yi, zi, 1, 0, 1), xf - 1, yf,     zf - 1);
-            Float v7 = Grad(Hash3(xi, yi, zi, 0, 1, 1), xf,     yf - 1, zf - 1);
-            Float v8 = Grad(Hash3(xi, yi, zi, 1, 1, 1), xf - 1, yf - 1, zf - 1);
+        // Note(3011): The contribution of a corner is the dot product of its
+        // gradient with the offset from the corner to the sample, first is
+        // the axis the dot product starts at.
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Float CornerValue(u32 hash, SizeType corner, const Array<Float, D>& frac, SizeType first = 0) noexcept
+        {
+            const Array<Float, D>& gradient = sGradients<D>[Cast<SizeType>(hash) & 31];
 
-            return (Lerp(w, Lerp(v, Lerp(u, v1, v2),
-                                    Lerp(u, v3, v4)),
-                            Lerp(v, Lerp(u, v5, v6),
-                                    Lerp(u, v7, v8))) + 1) / 2;
+            Float result = 0;
+            for (SizeType a = first; a < D; ++a)
+            {
+                result += gradient[a] * (ToUnderlying((corner >> a) & 1) ? frac[a] - 1 : frac[a]);
+            }
+            return result;
         }
 
-        [[nodiscard]] constexpr
-        Float operator()(const Vector4T<Float>& in) const noexcept
+        //////////////////////////////////////////////////////////////////////
+        // Interpolation
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Smootherstep on [0, 1], without the division by the
+        // length of the interval.
+        [[nodiscard]] static constexpr
+        Float Fade(Float val) noexcept
         {
-            using Int = SignedIntegerSelector<sizeof(Float)>;
+            val = Clamp(val);
+            return ((6 * val - 15) * val + 10) * Cubed(val);
+        }
 
-            u8 xi = Cast<u8>(Abs(Floor<Int>(in.x)) & 255);
-            u8 yi = Cast<u8>(Abs(Floor<Int>(in.y)) & 255);
-            u8 zi = Cast<u8>(Abs(Floor<Int>(in.z)) & 255);
-            u8 wi = Cast<u8>(Abs(Floor<Int>(in.w)) & 255);
-
-            Float xf = Frac(in.x);
-            Float yf = Frac(in.y);
-            Float zf = Frac(in.z);
-            Float wf = Frac(in.w);
-
-            Float u = Smootherstep(xf, Float(0), Float(1));
-            Float v = Smootherstep(yf, Float(0), Float(1));
-            Float s = Smootherstep(zf, Float(0), Float(1));
-            Float t = Smootherstep(wf, Float(0), Float(1));
-
-            Float v1  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 0, 0), xf,     yf,     zf,     wf    );
-            Float v2  = Grad(Hash4(xi, yi, zi, wi, 1, 0, 0, 0), xf - 1, yf,     zf,     wf    );
-            Float v3  = Grad(Hash4(xi, yi, zi, wi, 0, 1, 0, 0), xf,     yf - 1, zf,     wf    );
-            Float v4  = Grad(Hash4(xi, yi, zi, wi, 1, 1, 0, 0), xf - 1, yf - 1, zf,     wf    );
-            Float v5  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 1, 0), xf,     yf,     zf - 1, wf    );
-            Float v6  = Grad(Hash4(xi, yi, zi, wi, 1, 0, 1, 0), xf - 1, yf,     zf - 1, wf    );
-            Float v7  = Grad(Hash4(xi, yi, zi, wi, 0, 1, 1, 0), xf,     yf - 1, zf - 1, wf    );
-            Float v8  = Grad(Hash4(xi, yi, zi, wi, 1, 1, 1, 0), xf - 1, yf - 1, zf - 1, wf    );
-            Float v9  = Grad(Hash4(xi, yi, zi, wi, 0, 0, 0, 1), xf,     yf,     zf,     wf - 1);
-            Float v10 = Grad(Hash4(xi, yi, zi, wi, 1, 0, 0, 1), xf - 1, yf,     zf,     wf - 1);
-            Float v11 = Grad(Hash4(xi, yi, zi, wi, 0, 1, 0, 1), xf,     yf - 1, zf,     wf - 1);
-            Float v12 = Grad(Hash4(xi, yi, zi, wi, 1, 1, 0, 1), xf - 1, yf - 1, zf,     wf - 1);
-            Float v13 = Grad(Hash4(xi, yi, zi, wi, 0, 0, 1, 1), xf,     yf,     zf - 1, wf - 1);
-            Float v14 = Grad(Hash4(xi, yi, zi, wi, 1, 0, 1, 1), xf - 1, yf,     zf - 1, wf - 1);
-            Float v15 = Grad(Hash4(xi, yi, zi, wi, 0, 1, 1, 1), xf,     yf - 1, zf - 1, wf - 1);
-            Float v16 = Grad(Hash4(xi, yi, zi, wi, 1, 1, 1, 1), xf - 1, yf - 1, zf - 1, wf - 1);
-
-            return (Lerp(t, Lerp(s, Lerp(v, Lerp(u,  v1,  v2),
-                                            Lerp(u,  v3,  v4)),
-                                    Lerp(v, Lerp(u,  v5,  v6),
-                                            Lerp(u,  v7,  v8))),
-                            Lerp(s, Lerp(v, Lerp(u,  v9, v10),
-                                            Lerp(u, v11, v12)),
-                                    Lerp(v, Lerp(u, v13, v14),
-                                            Lerp(u, v15, v16)))) + 1) / 2;
+        // Note(3011): Lerps neighbouring pairs with fades[0], the results
+        // with fades[1] and so on, which collapses the corners of a cell one
+        // axis at a time, starting with x.
+        template <SizeType N>
+        [[nodiscard]] static constexpr
+        Float Blend(Array<Float, N> values, const Float* fades) noexcept
+        {
+            for (SizeType count = N >> 1; count > 0; count = count >> 1)
+            {
+                for (SizeType i = 0; i < count; ++i)
+                {
+                    values[i] = Lerp(*fades, values[2 * i], values[2 * i + 1]);
+                }
+                ++fades;
+            }
+            return values[0];
         }
 
-    private:
-        [[nodiscard]] constexpr
-        u8 Hash2(u8 x, u8 y, u8 i = 0, u8 j = 0) const noexcept
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Float Normalize(Float val) noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            return Cast<u8>(hash);
+            if constexpr (D == 2)
+            {
+                return (val + 2) / 4;
+            }
+            else
+            {
+                return (val + 1) / 2;
+            }
         }
 
-        [[nodiscard]] constexpr
-        u8 Hash3(u8 x, u8 y, u8 z, u8 i = 0, u8 j = 0, u8 k = 0) const noexcept
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Float Interpolate(const Array<u32, Corners<D>>& hashes, const Array<Float, D>& frac) noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(z) + Cast<u16>(k) + hash) & 255]);
-            return Cast<u8>(hash);
+            Array<Float, Corners<D>> values;
+            for (SizeType c = 0; c < Corners<D>; ++c)
+            {
+                values[c] = CornerValue<D>(hashes[c], c, frac);
+            }
+
+            Array<Float, D> fades;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                fades[a] = Fade(frac[a]);
+            }
+            return Normalize<D>(Blend(values, fades.Data()));
         }
 
+        //////////////////////////////////////////////////////////////////////
+        // Evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename Vec>
         [[nodiscard]] constexpr
-        u8 Hash4(u8 x, u8 y, u8 z, u8 w, u8 i = 0, u8 j = 0, u8 k = 0, u8 l = 0) const noexcept
+        Float Sample(const Vec& in) const noexcept
         {
-            u16 hash = 0;
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(x) + Cast<u16>(i)) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(y) + Cast<u16>(j) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(z) + Cast<u16>(k) + hash) & 255]);
-            hash = Cast<u16>(mPermutation[Cast<SizeType>(Cast<u16>(w) + Cast<u16>(l) + hash) & 255]);
-            return Cast<u8>(hash);
+            constexpr SizeType D = Vec::Dimension;
+
+            Array<u32, D> cell;
+            Array<u32, D> next;
+            Array<Float, D> frac;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                Locate(in[a], a, cell[a], next[a], frac[a]);
+            }
+
+            Array<u32, Corners<D>> hashes;
+            mHash(cell, next, hashes);
+            return Interpolate<D>(hashes, frac);
         }
 
+        template <typename Vec>
+        constexpr
+        void EvaluateBatch(std::span<const Vec> in, std::span<Float> out) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            Array<u32, D> cell;
+            Array<u32, D> next;
+            Array<Float, D> frac;
+            Array<u32, Corners<D>> hashes;
+            bool cached = false;
+
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                bool same = cached;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    u32 ai;
+                    Locate(in[i][a], a, ai, next[a], frac[a]);
+                    same = same && (ai == cell[a]);
+                    cell[a] = ai;
+                }
+
+                if (!same)
+                {
+                    cached = true;
+                    mHash(cell, next, hashes);
+                }
+                out[i] = Interpolate<D>(hashes, frac);
+            }
+        }
+
+        // Note(3011): Within a cell the corner values are linear in the x
+        // fraction, and along a row the fades of the other axes are constant.
+        // So the other axes are blended once per cell, separately for the
+        // offsets and the x slopes of the corner values, which leaves the
+        // two ends of the x edge as (offset0, slope0, offset1, slope1).
+        template <SizeType D>
         [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y) const noexcept
+        Array<Float, 4> CollapseCell(const Array<u32, D>& cell, const Array<u32, D>& next, const Array<Float, D>& frac, const Array<Float, D>& fades) const noexcept
+        {
+            constexpr SizeType Half = Corners<D> >> 1;
+
+            Array<u32, Corners<D>> hashes;
+            mHash(cell, next, hashes);
+
+            Array<Float, 4> result;
+            for (SizeType end = 0; end < 2; ++end)
+            {
+                Array<Float, Half> offsets;
+                Array<Float, Half> slopes;
+                for (SizeType c = 0; c < Half; ++c)
+                {
+                    const SizeType corner = 2 * c + end;
+                    offsets[c] = CornerValue<D>(hashes[corner], corner, frac, 1);
+                    slopes[c] = sGradients<D>[Cast<SizeType>(hashes[corner]) & 31][0];
+                }
+
+                result[2 * end]     = Blend(offsets, fades.Data() + 1);
+                result[2 * end + 1] = Blend(slopes,  fades.Data() + 1);
+            }
+            return result;
+        }
+
+        template <typename Vec, typename Dims>
+        constexpr
+        void FillGridBatch(const Vec& origin, const Vec& step, const Dims& dims, std::span<Float> out) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            const SizeType width = dims[0];
+            SizeType rows = 1;
+            for (SizeType a = 1; a < D; ++a)
+            {
+                rows *= dims[a];
+            }
+
+            Array<u32, D> cell;
+            Array<u32, D> next;
+            Array<Float, D> frac;
+            Array<Float, D> fades;
+            Array<Float, 4> edge;
+
+            for (SizeType row = 0; row < rows; ++row)
+            {
+                SizeType index = row;
+                for (SizeType a = 1; a < D; ++a)
+                {
+                    const Float coord = origin[a] + Cast<Float>(index % dims[a]) * step[a];
+                    index /= dims[a];
+
+                    Locate(coord, a, cell[a], next[a], frac[a]);
+                    fades[a] = Fade(frac[a]);
+                }
+
+                Float* result = out.data() + ToUnderlying(row * width);
+                for (SizeType i = 0; i < width; ++i)
+                {
+                    u32 xi;
+                    Float xf;
+                    Locate(origin[0] + Cast<Float>(i) * step[0], 0, xi, next[0], xf);
+                    if (i == 0 || xi != cell[0])
+                    {
+                        cell[0] = xi;
+                        edge = CollapseCell<D>(cell, next, frac, fades);
+                    }
+
+                    result[ToUnderlying(i)] = Normalize<D>(Lerp(Fade(xf), edge[0] + edge[1] * xf,
+                                                                          edge[2] + edge[3] * (xf - 1)));
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Gradients
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Grad is linear in the offset, so evaluating it on the
+        // unit vectors yields the gradient of every hash. The kernels use
+        // these tables and take the dot product with the corner offset.
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Array<Array<Float, D>, 32> MakeGradients() noexcept
+        {
+            Array<Array<Float, D>, 32> result;
+            for (SizeType h = 0; h < 32; ++h)
+            {
+                const u8 hash = Cast<u8>(h);
+                if constexpr (D == 2)
+                {
+                    result[h] = Array<Float, D>(Grad(hash, 1, 0), Grad(hash, 0, 1));
+                }
+                else if constexpr (D == 3)
+                {
+                    result[h] = Array<Float, D>(Grad(hash, 1, 0, 0), Grad(hash, 0, 1, 0), Grad(hash, 0, 0, 1));
+                }
+                else
+                {
+                    result[h] = Array<Float, D>(Grad(hash, 1, 0, 0, 0), Grad(hash, 0, 1, 0, 0), Grad(hash, 0, 0, 1, 0), Grad(hash, 0, 0, 0, 1));
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y) noexcept
         {
             hash &= 7;
             Float u = (hash < 4) ? x : y;
@@ -168,8 +419,8 @@ namespace Math::Noise
                  + (ToUnderlying(hash & 2) ? Cast<Float>(-2) * v : Cast<Float>(2) * v);
         }
 
-        [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y, Float z) const noexcept
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y, Float z) noexcept
         {
             hash &= 15;
             Float u = (hash < 8) ? x : y;
@@ -178,8 +429,8 @@ namespace Math::Noise
                  + (!ToUnderlying(hash & 2) ? v : -v);
         }
 
-        [[nodiscard]] constexpr
-        Float Grad(u8 hash, Float x, Float y, Float z, Float w) const noexcept
+        [[nodiscard]] static constexpr
+        Float Grad(u8 hash, Float x, Float y, Float z, Float w) noexcept
         {
             hash &= 31;
             Float t = (hash < 24) ? x : y;
@@ -190,26 +441,11 @@ namespace Math::Noise
                  + (!ToUnderlying(hash & 4) ? v : -v);
         }
 
-        Array<u8, 256> mPermutation;
-
-        static constexpr Array<u8, 256> sDefaultPermutation = Array<u8, 256>(
-            151, 160, 137, 91,  90,  15,  131, 13,  201, 95,  96,  53,  194, 233, 7,   225,
-            140, 36,  103, 30,  69,  142, 8,   99,  37,  240, 21,  10,  23,  190, 6,   148,
-            247, 120, 234, 75,  0,   26,  197, 62,  94,  252, 219, 203, 117, 35,  11,  32,
-            57,  177, 33,  88,  237, 149, 56,  87,  174, 20,  125, 136, 171, 168, 68,  175,
-            74,  165, 71,  134, 139, 48,  27,  166, 77,  146, 158, 231, 83,  111, 229, 122,
-            60,  211, 133, 230, 220, 105, 92,  41,  55,  46,  245, 40,  244, 102, 143, 54,
-            65,  25,  63,  161, 1,   216, 80,  73,  209, 76, 132,  187, 208, 89,  18,  169,
-            200, 196, 135, 130, 116, 188, 159, 86,  164, 100, 109, 198, 173, 186, 3,   64,
-            52,  217, 226, 250, 124, 123, 5,   202, 38,  147, 118, 126, 255, 82,  85,  212,
-            207, 206, 59,  227, 47,  16,  58,  17,  182, 189, 28,  42,  223, 183, 170, 213,
-            119, 248, 152, 2,   44,  154, 163, 70,  221, 153, 101, 155, 167, 43,  172, 9,
-            129, 22,  39,  253, 19,  98,  108, 110, 79,  113, 224, 232, 178, 185, 112, 104,
-            218, 246, 97,  228, 251, 34,  242, 193, 238, 210, 144, 12,  191, 179, 162, 241,
-            81,  51,  145, 235, 249, 14,  239, 107, 49,  192, 214, 31,  181, 199, 106, 157,
-            184, 84,  204, 176, 115, 121, 50,  45,  127, 4,   150, 254, 138, 236, 205, 93,
-            222, 114, 67,  29,  24,  72,  243, 141, 128, 195, 78,  66,  215, 61,  156, 180
-        );
+        template <SizeType D>
+        static constexpr Array<Array<Float, D>, 32> sGradients = MakeGradients<D>();
+
+        Hash mHash;
+        Array<SizeType, 4> mPeriod;
     };
 }
 
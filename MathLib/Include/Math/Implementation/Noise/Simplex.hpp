@@ -1,10 +1,20 @@
 #ifndef MATHLIB_IMPLEMENTATION_NOISE_SIMPLEX_HPP
 #define MATHLIB_IMPLEMENTATION_NOISE_SIMPLEX_HPP
 
+#include "Permutation.hpp"
 #include "../Base/Array.hpp"
-#include "../../Random.hpp"
+#include "../../Functions.hpp"
 #include "../../Vector.hpp"
 
+#include <span>
+
+// Note(3011): Simplex noise after Gustavson's "Simplex noise demystified".
+// The skewed lattice is split into simplices, so a sample blends D + 1
+// corners instead of the 2^D corners of Perlin noise. Every corner adds
+// (r^2 - |d|^2)^4 * dot(g, d) with r^2 = 0.5, which is smooth and makes
+// the gradient cheap to compute analytically. Values are scaled to roughly
+// [0, 1] to match Perlin, the gradients are those of the scaled values.
+
 namespace Math::Noise
 {
     template <Concept::FloatingPointType Float>
@@ -15,26 +25,344 @@ namespace Math::Noise
 
         [[nodiscard]] constexpr explicit
         Simplex(u64 seed = 0) noexcept
+            : mPermutation(Implementation::MakePermutation(seed))
         {}
 
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            return Float(0);
+            Vector2T<Float> gradient;
+            return Sample<false>(in, gradient);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            return Float(0);
+            Vector3T<Float> gradient;
+            return Sample<false>(in, gradient);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector4T<Float>& in) const noexcept
         {
-            return Float(0);
+            Vector4T<Float> gradient;
+            return Sample<false>(in, gradient);
+        }
+
+        // Note(3011): Same as above, and also writes the gradient of the
+        // noise at in, which is useful for normals and flow fields.
+        [[nodiscard]] constexpr
+        Float operator()(const Vector2T<Float>& in, Vector2T<Float>& gradient) const noexcept
+        {
+            return Sample<true>(in, gradient);
+        }
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector3T<Float>& in, Vector3T<Float>& gradient) const noexcept
+        {
+            return Sample<true>(in, gradient);
+        }
+
+        [[nodiscard]] constexpr
+        Float operator()(const Vector4T<Float>& in, Vector4T<Float>& gradient) const noexcept
+        {
+            return Sample<true>(in, gradient);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Batch evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Writes the noise value of in[i] to out[i], and its
+        // gradient to gradients[i] for the overloads that take them. The
+        // output spans must be at least as large as in.
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch<false>(in, out, std::span<Vector2T<Float>>());
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch<false>(in, out, std::span<Vector3T<Float>>());
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch<false>(in, out, std::span<Vector4T<Float>>());
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> in, std::span<Float> out, std::span<Vector2T<Float>> gradients) const noexcept
+        {
+            EvaluateBatch<true>(in, out, gradients);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> in, std::span<Float> out, std::span<Vector3T<Float>> gradients) const noexcept
+        {
+            EvaluateBatch<true>(in, out, gradients);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> in, std::span<Float> out, std::span<Vector4T<Float>> gradients) const noexcept
+        {
+            EvaluateBatch<true>(in, out, gradients);
+        }
+
+        // Note(3011): Samples the regular grid origin + index * step for all
+        // indices below dims and writes the values with x varying fastest,
+        // so out must hold the product of dims.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
         }
+
+        constexpr
+        void FillGrid(const Vector4T<Float>& origin, const Vector4T<Float>& step, const Vector4sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
+
     private:
+        // Note(3011): (sqrt(D + 1) - 1) / D maps the lattice to the skewed
+        // lattice, (1 - 1 / sqrt(D + 1)) / D maps it back.
+        template <SizeType D>
+        static constexpr Float sSkew = (D == 2) ? Float(0.36602540378443865)
+                                     : (D == 3) ? Float(1.0 / 3.0)
+                                     :            Float(0.30901699437494745);
+
+        template <SizeType D>
+        static constexpr Float sUnskew = (D == 2) ? Float(0.21132486540518713)
+                                       : (D == 3) ? Float(1.0 / 6.0)
+                                       :            Float(0.13819660112501052);
+
+        // Note(3011): Brings the extrema of the sum of the corner kernels to
+        // about +-1, measured by dense sampling.
+        template <SizeType D>
+        static constexpr Float sScale = (D == 2) ? Float(70.0)
+                                      : (D == 3) ? Float(76.0)
+                                      :            Float(62.0);
+
+        static constexpr Float sRadius = Float(0.5);
+
+        template <bool Derivative, typename Vec>
+        [[nodiscard]] constexpr
+        Float Sample(const Vec& in, Vec& gradient) const noexcept
+        {
+            using Int = SignedIntegerSelector<sizeof(Float)>;
+            constexpr SizeType D = Vec::Dimension;
+
+            Float sum = 0;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                sum += in[a];
+            }
+
+            const Float skew = sum * sSkew<D>;
+
+            Array<Int, D> cell;
+            Float cellSum = 0;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                cell[a] = Floor<Int>(in[a] + skew);
+                cellSum += Cast<Float>(cell[a]);
+            }
+
+            const Float unskew = cellSum * sUnskew<D>;
+
+            Array<Float, D> first;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                first[a] = in[a] - (Cast<Float>(cell[a]) - unskew);
+            }
+
+            // Note(3011): The simplex containing the sample is found by
+            // sorting the offsets from the first corner. rank[a] counts the
+            // axes with a smaller offset, and corner k has moved one step
+            // along the k axes with the largest offsets.
+            Array<SizeType, D> rank;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                rank[a] = 0;
+            }
+            for (SizeType a = 0; a < D; ++a)
+            {
+                for (SizeType b = a + 1; b < D; ++b)
+                {
+                    ++rank[(first[a] > first[b]) ? a : b];
+                }
+            }
+
+            Float result = 0;
+            if constexpr (Derivative)
+            {
+                gradient = Vec();
+            }
+
+            for (SizeType k = 0; k <= D; ++k)
+            {
+                Array<Float, D> offset;
+                Float lengthSquared = 0;
+                u16 hash = 0;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    const SizeType step = (rank[a] + k >= D) ? 1 : 0;
+                    offset[a] = first[a] - Cast<Float>(step) + Cast<Float>(k) * sUnskew<D>;
+                    lengthSquared += offset[a] * offset[a];
+                    hash = Cast<u16>(mPermutation[(Cast<SizeType>(cell[a]) + step + Cast<SizeType>(hash)) & 255]);
+                }
+
+                const Float t = sRadius - lengthSquared;
+                if (t <= 0)
+                {
+                    continue;
+                }
+
+                const Array<Float, D>& g = sGradients<D>[Cast<SizeType>(hash) & 31];
+
+                Float dot = 0;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    dot += g[a] * offset[a];
+                }
+
+                const Float t2 = t * t;
+                const Float t4 = t2 * t2;
+                result += t4 * dot;
+
+                if constexpr (Derivative)
+                {
+                    const Float radial = -8 * t2 * t * dot;
+                    for (SizeType a = 0; a < D; ++a)
+                    {
+                        gradient[a] += radial * offset[a] + t4 * g[a];
+                    }
+                }
+            }
+
+            constexpr Float Half = sScale<D> / 2;
+            if constexpr (Derivative)
+            {
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    gradient[a] *= Half;
+                }
+            }
+            return result * Half + Float(0.5);
+        }
+
+        template <bool Derivative, typename Vec>
+        constexpr
+        void EvaluateBatch(std::span<const Vec> in, std::span<Float> out, std::span<Vec> gradients) const noexcept
+        {
+            Vec gradient;
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                if constexpr (Derivative)
+                {
+                    out[i] = Sample<true>(in[i], gradients[i]);
+                }
+                else
+                {
+                    out[i] = Sample<false>(in[i], gradient);
+                }
+            }
+        }
+
+        template <typename Vec, typename Dims>
+        constexpr
+        void FillGridBatch(const Vec& origin, const Vec& step, const Dims& dims, std::span<Float> out) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            SizeType rows = 1;
+            for (SizeType a = 1; a < D; ++a)
+            {
+                rows *= dims[a];
+            }
+
+            Vec point;
+            Vec gradient;
+            Float* result = out.data();
+            for (SizeType row = 0; row < rows; ++row)
+            {
+                SizeType index = row;
+                for (SizeType a = 1; a < D; ++a)
+                {
+                    point[a] = origin[a] + Cast<Float>(index % dims[a]) * step[a];
+                    index /= dims[a];
+                }
+
+                for (SizeType i = 0; i < dims[0]; ++i)
+                {
+                    point[0] = origin[0] + Cast<Float>(i) * step[0];
+                    *result++ = Sample<false>(point, gradient);
+                }
+            }
+        }
+
+        // Note(3011): 2D uses the 8 directions to the edges and corners of
+        // a square, 3D the 12 edges of a cube with 4 of them repeated, and
+        // 4D the 32 edges of a tesseract. The smaller sets are repeated so
+        // every table is indexed with the low 5 bits of the hash.
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Array<Array<Float, D>, 32> MakeGradients() noexcept
+        {
+            Array<Array<Float, D>, 32> result;
+            for (SizeType h = 0; h < 32; ++h)
+            {
+                if constexpr (D == 2)
+                {
+                    constexpr i8 directions[8][2] = {
+                        { 1,  1 }, { -1,  1 }, { 1, -1 }, { -1, -1 },
+                        { 1,  0 }, { -1,  0 }, { 0,  1 }, {  0, -1 }
+                    };
+                    const auto& d = directions[ToUnderlying(h & 7)];
+                    result[h] = Array<Float, D>(Cast<Float>(d[0]), Cast<Float>(d[1]));
+                }
+                else if constexpr (D == 3)
+                {
+                    constexpr i8 directions[16][3] = {
+                        { 1,  1,  0 }, { -1,  1,  0 }, { 1, -1,  0 }, { -1, -1,  0 },
+                        { 1,  0,  1 }, { -1,  0,  1 }, { 1,  0, -1 }, { -1,  0, -1 },
+                        { 0,  1,  1 }, {  0, -1,  1 }, { 0,  1, -1 }, {  0, -1, -1 },
+                        { 1,  1,  0 }, {  0, -1,  1 }, { -1, 1,  0 }, {  0, -1, -1 }
+                    };
+                    const auto& d = directions[ToUnderlying(h & 15)];
+                    result[h] = Array<Float, D>(Cast<Float>(d[0]), Cast<Float>(d[1]), Cast<Float>(d[2]));
+                }
+                else
+                {
+                    // Note(3011): One axis is zero, the other three take
+                    // every sign combination.
+                    const SizeType zero = h >> 3;
+                    Array<Float, D> direction;
+                    SizeType bit = 0;
+                    for (SizeType a = 0; a < D; ++a)
+                    {
+                        direction[a] = (a == zero) ? Float(0) : ToUnderlying((h >> bit++) & 1) ? Float(-1) : Float(1);
+                    }
+                    result[h] = direction;
+                }
+            }
+            return result;
+        }
+
+        template <SizeType D>
+        static constexpr Array<Array<Float, D>, 32> sGradients = MakeGradients<D>();
+
+        Array<u8, 256> mPermutation;
     };
 }
 
@@ -2,11 +2,36 @@
 #define MATHLIB_IMPLEMENTATION_NOISE_WORLEY_HPP
 
 #include "../Base/Array.hpp"
+#include "../../Functions.hpp"
 #include "../../Random.hpp"
 #include "../../Vector.hpp"
 
+#include <span>
+
+// Note(3011): Worley (cellular) noise. Every lattice cell holds one feature
+// point at an offset derived from a hash of the cell and the seed, so no
+// point tables are stored. A sample returns the distance to the closest
+// (F1) or second closest (F2) feature point, or their difference, in
+// lattice units. Like most implementations, only the 3^D cells around the
+// sample are searched, so F1 and F2 are very rarely overestimated. Cells
+// that cannot hold a closer point than the current candidate are skipped.
+
 namespace Math::Noise
 {
+    enum class Metric
+    {
+        Euclidean,
+        Manhattan,
+        Chebyshev
+    };
+
+    enum class Feature
+    {
+        F1,
+        F2,
+        F2MinusF1
+    };
+
     template <Concept::FloatingPointType Float>
     class Worley final
     {
@@ -14,27 +39,375 @@ namespace Math::Noise
         using ValueType = Float;
 
         [[nodiscard]] constexpr explicit
-        Worley(u64 seed = 0) noexcept
+        Worley(u64 seed = 0, Feature feature = Feature::F1, Metric metric = Metric::Euclidean) noexcept
+            : mSeed(Random64(seed)()), mFeature(feature), mMetric(metric)
         {}
 
         [[nodiscard]] constexpr
         Float operator()(const Vector2T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sample(in);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector3T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sample(in);
         }
 
         [[nodiscard]] constexpr
         Float operator()(const Vector4T<Float>& in) const noexcept
         {
-            return Float(0);
+            return Sample(in);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Batch evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Writes the noise value of in[i] to out[i], out must be
+        // at least as large as in.
+        constexpr
+        void Evaluate(std::span<const Vector2T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector3T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
+
+        constexpr
+        void Evaluate(std::span<const Vector4T<Float>> in, std::span<Float> out) const noexcept
+        {
+            EvaluateBatch(in, out);
+        }
+
+        // Note(3011): Samples the regular grid origin + index * step for all
+        // indices below dims and writes the values with x varying fastest,
+        // so out must hold the product of dims. The feature points around a
+        // cell are generated once and shared by every sample of a row that
+        // falls into that cell.
+        constexpr
+        void FillGrid(const Vector2T<Float>& origin, const Vector2T<Float>& step, const Vector2sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
+
+        constexpr
+        void FillGrid(const Vector3T<Float>& origin, const Vector3T<Float>& step, const Vector3sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
+        }
+
+        constexpr
+        void FillGrid(const Vector4T<Float>& origin, const Vector4T<Float>& step, const Vector4sz& dims, std::span<Float> out) const noexcept
+        {
+            FillGridBatch(origin, step, dims, out);
         }
+
     private:
+        using Int = SignedIntegerSelector<sizeof(Float)>;
+
+        template <SizeType D>
+        static constexpr SizeType Neighbours = (D == 2) ? 9 : (D == 3) ? 27 : 81;
+
+        template <SizeType D>
+        using Points = Array<Array<Float, D>, Neighbours<D>>;
+
+        //////////////////////////////////////////////////////////////////////
+        // Feature points
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Offset of the feature point inside the cell, in [0, 1)
+        // along every axis. Each 64 bit draw provides two axes. 24 bits per
+        // axis are exact in f32, more bits could round up to 1.
+        template <SizeType D>
+        [[nodiscard]] constexpr
+        Array<Float, D> FeaturePoint(const Array<Int, D>& cell) const noexcept
+        {
+            u64 key = mSeed;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                key = Implementation::Splitmix64(key ^ Cast<u64>(cell[a]))();
+            }
+
+            Implementation::Splitmix64 rng(key);
+
+            Array<Float, D> result;
+            u64 bits = 0;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                bits = ToUnderlying(a & 1) ? (bits << 32) : rng();
+                result[a] = Cast<Float>(bits >> 40) * Float(0x1.0p-24);
+            }
+            return result;
+        }
+
+        // Note(3011): Offsets of the cells around a sample, ordered by the
+        // number of non-zero components. Closer cells are visited first,
+        // which makes the pruning in Nearest more effective.
+        template <SizeType D>
+        [[nodiscard]] static constexpr
+        Array<Array<Int, D>, Neighbours<D>> MakeNeighbours() noexcept
+        {
+            Array<Array<Int, D>, Neighbours<D>> result;
+            SizeType count = 0;
+            for (SizeType nonZero = 0; nonZero <= D; ++nonZero)
+            {
+                for (SizeType i = 0; i < Neighbours<D>; ++i)
+                {
+                    Array<Int, D> offset;
+                    SizeType index = i;
+                    SizeType components = 0;
+                    for (SizeType a = 0; a < D; ++a)
+                    {
+                        offset[a] = Cast<Int>(index % 3) - 1;
+                        components += (offset[a] != 0) ? 1 : 0;
+                        index /= 3;
+                    }
+
+                    if (components == nonZero)
+                    {
+                        result[count++] = offset;
+                    }
+                }
+            }
+            return result;
+        }
+
+        template <SizeType D>
+        static constexpr Array<Array<Int, D>, Neighbours<D>> sNeighbours = MakeNeighbours<D>();
+
+        // Note(3011): Positions of the feature points around cell, relative
+        // to the cell, in the order of sNeighbours.
+        template <SizeType D>
+        constexpr
+        void GatherPoints(const Array<Int, D>& cell, Points<D>& points) const noexcept
+        {
+            for (SizeType n = 0; n < Neighbours<D>; ++n)
+            {
+                Array<Int, D> neighbour;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    neighbour[a] = cell[a] + sNeighbours<D>[n][a];
+                }
+
+                const Array<Float, D> offset = FeaturePoint<D>(neighbour);
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    points[n][a] = Cast<Float>(sNeighbours<D>[n][a]) + offset[a];
+                }
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Search
+        //////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Distances are compared without the square root for the
+        // Euclidean metric, Resolve applies it at the end.
+        template <Metric M>
+        [[nodiscard]] static constexpr
+        Float Accumulate(Float distance, Float delta) noexcept
+        {
+            if constexpr (M == Metric::Euclidean)
+            {
+                return distance + delta * delta;
+            }
+            else if constexpr (M == Metric::Manhattan)
+            {
+                return distance + Abs(delta);
+            }
+            else
+            {
+                return Max(distance, Abs(delta));
+            }
+        }
+
+        // Note(3011): Returns F1 and F2 for a sample at frac inside its
+        // cell. point(n) returns the feature point of neighbour n relative
+        // to the cell, which is either generated on the fly or cached.
+        template <Metric M, SizeType D, typename PointFunc>
+        [[nodiscard]] constexpr
+        Array<Float, 2> Nearest(const Array<Float, D>& frac, PointFunc&& point) const noexcept
+        {
+            Float f1 = Float::Infinity();
+            Float f2 = Float::Infinity();
+            for (SizeType n = 0; n < Neighbours<D>; ++n)
+            {
+                // Note(3011): No point in a neighbour is closer than the
+                // nearest face of that neighbour.
+                Float bound = 0;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    const Int offset = sNeighbours<D>[n][a];
+                    const Float gap = (offset > 0) ? Float(1) - frac[a] : (offset < 0) ? frac[a] : Float(0);
+                    bound = Accumulate<M>(bound, gap);
+                }
+
+                if (bound >= ((mFeature == Feature::F1) ? f1 : f2))
+                {
+                    continue;
+                }
+
+                const Array<Float, D>& position = point(n);
+
+                Float distance = 0;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    distance = Accumulate<M>(distance, position[a] - frac[a]);
+                }
+
+                if (distance < f1)
+                {
+                    f2 = f1;
+                    f1 = distance;
+                }
+                else if (distance < f2)
+                {
+                    f2 = distance;
+                }
+            }
+            return Array<Float, 2>(f1, f2);
+        }
+
+        template <Metric M>
+        [[nodiscard]] constexpr
+        Float Resolve(Array<Float, 2> features) const noexcept
+        {
+            if constexpr (M == Metric::Euclidean)
+            {
+                features[0] = Sqrt(features[0]);
+                features[1] = Sqrt(features[1]);
+            }
+
+            switch (mFeature)
+            {
+            case Feature::F1: return features[0];
+            case Feature::F2: return features[1];
+            default:          return features[1] - features[0];
+            }
+        }
+
+        template <Metric M, SizeType D, typename PointFunc>
+        [[nodiscard]] constexpr
+        Float Search(const Array<Float, D>& frac, PointFunc&& point) const noexcept
+        {
+            return Resolve<M>(Nearest<M, D>(frac, point));
+        }
+
+        // Note(3011): Turns the runtime metric into a template argument, so
+        // the inner loops don't branch on it.
+        template <SizeType D, typename PointFunc>
+        [[nodiscard]] constexpr
+        Float Dispatch(const Array<Float, D>& frac, PointFunc&& point) const noexcept
+        {
+            switch (mMetric)
+            {
+            case Metric::Manhattan: return Search<Metric::Manhattan, D>(frac, point);
+            case Metric::Chebyshev: return Search<Metric::Chebyshev, D>(frac, point);
+            default:                return Search<Metric::Euclidean, D>(frac, point);
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        // Evaluation
+        //////////////////////////////////////////////////////////////////////
+
+        template <typename Vec>
+        [[nodiscard]] constexpr
+        Float Sample(const Vec& in) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            Array<Int, D> cell;
+            Array<Float, D> frac;
+            for (SizeType a = 0; a < D; ++a)
+            {
+                cell[a] = Floor<Int>(in[a]);
+                frac[a] = in[a] - Cast<Float>(cell[a]);
+            }
+
+            Array<Float, D> position;
+            return Dispatch<D>(frac, [&](SizeType n) -> const Array<Float, D>&
+            {
+                Array<Int, D> neighbour;
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    neighbour[a] = cell[a] + sNeighbours<D>[n][a];
+                }
+
+                position = FeaturePoint<D>(neighbour);
+                for (SizeType a = 0; a < D; ++a)
+                {
+                    position[a] += Cast<Float>(sNeighbours<D>[n][a]);
+                }
+                return position;
+            });
+        }
+
+        template <typename Vec>
+        constexpr
+        void EvaluateBatch(std::span<const Vec> in, std::span<Float> out) const noexcept
+        {
+            for (std::size_t i = 0; i < in.size(); ++i)
+            {
+                out[i] = Sample(in[i]);
+            }
+        }
+
+        template <typename Vec, typename Dims>
+        constexpr
+        void FillGridBatch(const Vec& origin, const Vec& step, const Dims& dims, std::span<Float> out) const noexcept
+        {
+            constexpr SizeType D = Vec::Dimension;
+
+            SizeType rows = 1;
+            for (SizeType a = 1; a < D; ++a)
+            {
+                rows *= dims[a];
+            }
+
+            Array<Int, D> cell;
+            Array<Float, D> frac;
+            Points<D> points;
+            const auto point = [&points](SizeType n) -> const Array<Float, D>& { return points[n]; };
+
+            Float* result = out.data();
+            for (SizeType row = 0; row < rows; ++row)
+            {
+                SizeType index = row;
+                for (SizeType a = 1; a < D; ++a)
+                {
+                    const Float coord = origin[a] + Cast<Float>(index % dims[a]) * step[a];
+                    index /= dims[a];
+
+                    cell[a] = Floor<Int>(coord);
+                    frac[a] = coord - Cast<Float>(cell[a]);
+                }
+
+                for (SizeType i = 0; i < dims[0]; ++i)
+                {
+                    const Float x = origin[0] + Cast<Float>(i) * step[0];
+                    const Int xi = Floor<Int>(x);
+                    if (i == 0 || xi != cell[0])
+                    {
+                        cell[0] = xi;
+                        GatherPoints<D>(cell, points);
+                    }
+
+                    frac[0] = x - Cast<Float>(xi);
+                    *result++ = Dispatch<D>(frac, point);
+                }
+            }
+        }
+
+        u64 mSeed;
+        Feature mFeature;
+        Metric mMetric;
     };
 }
 
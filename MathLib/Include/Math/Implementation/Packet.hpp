@@ -0,0 +1,424 @@
+#ifndef MATHLIB_IMPLEMENTATION_PACKET_HPP
+#define MATHLIB_IMPLEMENTATION_PACKET_HPP
+
+#include "Base/Concepts.hpp"
+#include "Base/Simd.hpp"
+#include "Functions/BasicFunctions.hpp"
+
+#include <bit>
+#include <type_traits>
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Lane-wise operations
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Implementation::PacketOps
+    {
+        // Note(3011): Each operation has a scalar version used for every lane
+        // and a register version used when the packet maps onto whole SIMD
+        // registers (see Base/Simd.hpp).
+
+        struct Add
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return a + b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Add(a, b); }
+        };
+
+        struct Sub
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return a - b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Sub(a, b); }
+        };
+
+        struct Mul
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return a * b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Mul(a, b); }
+        };
+
+        struct Div
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return a / b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Div(a, b); }
+        };
+
+        struct Min
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return (a < b) ? a : b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Min(a, b); }
+        };
+
+        struct Max
+        {
+            template <typename T> constexpr T operator()(T a, T b) const noexcept { return (a > b) ? a : b; }
+            template <typename Reg, typename V> static V Simd(V a, V b) noexcept { return Reg::Max(a, b); }
+        };
+
+        struct Neg
+        {
+            template <typename T> constexpr T operator()(T a) const noexcept { return -a; }
+            template <typename Reg, typename V> static V Simd(V a) noexcept { return Reg::Neg(a); }
+        };
+
+        struct Sqrt
+        {
+            template <typename T> constexpr T operator()(T a) const noexcept { return Math::Sqrt(a); }
+            template <typename Reg, typename V> static V Simd(V a) noexcept { return Reg::Sqrt(a); }
+        };
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // PacketMask
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::StrongType T, SizeType N>
+    struct PacketMask final
+    {
+    public:
+        using ValueType = T;
+        static constexpr SizeType Size = N;
+    private:
+        using ThisType = PacketMask<T, N>;
+    public:
+
+        [[nodiscard]] constexpr
+        PacketMask(bool value = false) noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                mLanes[ToUnderlying(i)] = value;
+            }
+        }
+
+        [[nodiscard]] constexpr       bool& operator[] (SizeType lane)       noexcept { return mLanes[ToUnderlying(lane)]; }
+        [[nodiscard]] constexpr const bool& operator[] (SizeType lane) const noexcept { return mLanes[ToUnderlying(lane)]; }
+
+        [[nodiscard]] constexpr
+        bool Any() const noexcept
+        {
+            bool result = false;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result |= mLanes[ToUnderlying(i)];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        bool All() const noexcept
+        {
+            bool result = true;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result &= mLanes[ToUnderlying(i)];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr bool None() const noexcept { return !Any(); }
+
+        [[nodiscard]] constexpr
+        SizeType Count() const noexcept
+        {
+            SizeType result = 0;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result += mLanes[ToUnderlying(i)] ? 1 : 0;
+            }
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr ThisType operator! (const ThisType& a)                    noexcept { ThisType r; for (SizeType i = 0; i < Size; ++i) { r[i] = !a[i];         } return r; }
+        [[nodiscard]] friend constexpr ThisType operator& (const ThisType& a, const ThisType& b) noexcept { ThisType r; for (SizeType i = 0; i < Size; ++i) { r[i] = a[i] && b[i]; } return r; }
+        [[nodiscard]] friend constexpr ThisType operator| (const ThisType& a, const ThisType& b) noexcept { ThisType r; for (SizeType i = 0; i < Size; ++i) { r[i] = a[i] || b[i]; } return r; }
+        [[nodiscard]] friend constexpr ThisType operator^ (const ThisType& a, const ThisType& b) noexcept { ThisType r; for (SizeType i = 0; i < Size; ++i) { r[i] = a[i] != b[i]; } return r; }
+
+        [[maybe_unused]] friend constexpr ThisType& operator&= (ThisType& a, const ThisType& b) noexcept { a = a & b; return a; }
+        [[maybe_unused]] friend constexpr ThisType& operator|= (ThisType& a, const ThisType& b) noexcept { a = a | b; return a; }
+        [[maybe_unused]] friend constexpr ThisType& operator^= (ThisType& a, const ThisType& b) noexcept { a = a ^ b; return a; }
+    private:
+        bool mLanes[ToUnderlying(Size)] = {};
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Packet
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): A packet holds N values of the same scalar type and behaves
+    // like a single scalar with lane-wise semantics. Comparisons produce a
+    // PacketMask, which can be consumed by Select (see PacketUtilities.hpp).
+    template <Concept::StrongType T, SizeType N>
+    struct Packet final
+    {
+    public:
+        using ValueType = T;
+        using MaskType = PacketMask<T, N>;
+        static constexpr SizeType Size = N;
+    private:
+        using ThisType = Packet<T, N>;
+        using Underlying = UnderlyingType<T>;
+
+        // Note(3011): The widest register whose lane count divides N, eight
+        // lane packets of f32 use whole AVX registers.
+        static constexpr bool IsWide = Implementation::Simd::Register8<Underlying>::Enabled && (ToUnderlying(N) % 8 == 0);
+        static constexpr std::size_t RegisterWidth = IsWide ? 8 : 4;
+        using Register = std::conditional_t<IsWide,
+                                            Implementation::Simd::Register8<Underlying>,
+                                            Implementation::Simd::Register4<Underlying>>;
+
+        static constexpr bool IsAccelerated = Register::Enabled && (ToUnderlying(N) % RegisterWidth == 0);
+    public:
+
+        [[nodiscard]] constexpr
+        Packet() noexcept = default;
+
+        template <typename U>
+            requires Concept::IsConvertible<U, T>
+        [[nodiscard]] constexpr
+        Packet(const U& value) noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                mLanes[ToUnderlying(i)] = T(value);
+            }
+        }
+
+        template <typename... Ts>
+            requires (sizeof...(Ts) == ToUnderlying(N) && sizeof...(Ts) > 1
+                  && (Concept::IsConvertible<Ts, T> && ...))
+        [[nodiscard]] constexpr
+        Packet(const Ts&... values) noexcept
+            : mLanes{ T(values)... }
+        {}
+
+        [[nodiscard]] static constexpr
+        ThisType Load(const T* data) noexcept
+        {
+            ThisType result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.mLanes[ToUnderlying(i)] = data[ToUnderlying(i)];
+            }
+            return result;
+        }
+
+        constexpr
+        void Store(T* data) const noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                data[ToUnderlying(i)] = mLanes[ToUnderlying(i)];
+            }
+        }
+
+        // Note(3011): Returns (start, start + step, start + 2 * step, ...),
+        // which is handy when walking regular grids.
+        [[nodiscard]] static constexpr
+        ThisType Sequence(T start = T(0), T step = T(1)) noexcept
+        {
+            ThisType result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.mLanes[ToUnderlying(i)] = start + Cast<T>(i) * step;
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr       T& operator[] (SizeType lane)       noexcept { return mLanes[ToUnderlying(lane)]; }
+        [[nodiscard]] constexpr const T& operator[] (SizeType lane) const noexcept { return mLanes[ToUnderlying(lane)]; }
+
+        [[nodiscard]] constexpr
+        T Sum() const noexcept
+        {
+            T result = mLanes[0];
+            for (SizeType i = 1; i < Size; ++i)
+            {
+                result += mLanes[ToUnderlying(i)];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        T Min() const noexcept
+        {
+            T result = mLanes[0];
+            for (SizeType i = 1; i < Size; ++i)
+            {
+                result = (mLanes[ToUnderlying(i)] < result) ? mLanes[ToUnderlying(i)] : result;
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        T Max() const noexcept
+        {
+            T result = mLanes[0];
+            for (SizeType i = 1; i < Size; ++i)
+            {
+                result = (mLanes[ToUnderlying(i)] > result) ? mLanes[ToUnderlying(i)] : result;
+            }
+            return result;
+        }
+
+        template <typename Op>
+        [[nodiscard]] static constexpr
+        ThisType Map(const ThisType& a, const ThisType& b, Op op) noexcept
+        {
+            ThisType result;
+            if constexpr (IsAccelerated && requires { &Op::template Simd<Register, typename Register::Type>; })
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const Underlying* lhs = reinterpret_cast<const Underlying*>(a.mLanes);
+                    const Underlying* rhs = reinterpret_cast<const Underlying*>(b.mLanes);
+                    Underlying* out = reinterpret_cast<Underlying*>(result.mLanes);
+                    for (std::size_t i = 0; i < ToUnderlying(Size); i += RegisterWidth)
+                    {
+                        StoreRegister(out + i, Op::template Simd<Register>(LoadRegister(lhs + i), LoadRegister(rhs + i)));
+                    }
+                    return result;
+                }
+            }
+
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.mLanes[ToUnderlying(i)] = op(a.mLanes[ToUnderlying(i)], b.mLanes[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        template <typename Op>
+        [[nodiscard]] static constexpr
+        MaskType Compare(const ThisType& a, const ThisType& b, Op op) noexcept
+        {
+            MaskType result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result[i] = op(a.mLanes[ToUnderlying(i)], b.mLanes[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        template <typename Op>
+        [[nodiscard]] static constexpr
+        ThisType Apply(const ThisType& a, Op op) noexcept
+        {
+            ThisType result;
+            if constexpr (IsAccelerated && requires { &Op::template Simd<Register, typename Register::Type>; })
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const Underlying* in = reinterpret_cast<const Underlying*>(a.mLanes);
+                    Underlying* out = reinterpret_cast<Underlying*>(result.mLanes);
+                    for (std::size_t i = 0; i < ToUnderlying(Size); i += RegisterWidth)
+                    {
+                        StoreRegister(out + i, Op::template Simd<Register>(LoadRegister(in + i)));
+                    }
+                    return result;
+                }
+            }
+
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.mLanes[ToUnderlying(i)] = op(a.mLanes[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        [[nodiscard]]    friend constexpr ThisType  operator+  (const ThisType& a)                    noexcept { return a; }
+        [[nodiscard]]    friend constexpr ThisType  operator-  (const ThisType& a)                    noexcept { return Apply(a, Implementation::PacketOps::Neg()); }
+        [[nodiscard]]    friend constexpr ThisType  operator+  (const ThisType& a, const ThisType& b) noexcept { return Map(a, b, Implementation::PacketOps::Add()); }
+        [[nodiscard]]    friend constexpr ThisType  operator-  (const ThisType& a, const ThisType& b) noexcept { return Map(a, b, Implementation::PacketOps::Sub()); }
+        [[nodiscard]]    friend constexpr ThisType  operator*  (const ThisType& a, const ThisType& b) noexcept { return Map(a, b, Implementation::PacketOps::Mul()); }
+        [[nodiscard]]    friend constexpr ThisType  operator/  (const ThisType& a, const ThisType& b) noexcept { return Map(a, b, Implementation::PacketOps::Div()); }
+
+        [[maybe_unused]] friend constexpr ThisType& operator+= (ThisType& a, const ThisType& b)       noexcept { a = a + b; return a; }
+        [[maybe_unused]] friend constexpr ThisType& operator-= (ThisType& a, const ThisType& b)       noexcept { a = a - b; return a; }
+        [[maybe_unused]] friend constexpr ThisType& operator*= (ThisType& a, const ThisType& b)       noexcept { a = a * b; return a; }
+        [[maybe_unused]] friend constexpr ThisType& operator/= (ThisType& a, const ThisType& b)       noexcept { a = a / b; return a; }
+
+        [[nodiscard]] friend constexpr MaskType operator== (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u == v; }); }
+        [[nodiscard]] friend constexpr MaskType operator!= (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u != v; }); }
+        [[nodiscard]] friend constexpr MaskType operator<  (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u <  v; }); }
+        [[nodiscard]] friend constexpr MaskType operator<= (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u <= v; }); }
+        [[nodiscard]] friend constexpr MaskType operator>  (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u >  v; }); }
+        [[nodiscard]] friend constexpr MaskType operator>= (const ThisType& a, const ThisType& b) noexcept { return Compare(a, b, [](T u, T v) { return u >= v; }); }
+    private:
+        template <typename Reg = Register>
+        static typename Reg::Type LoadRegister(const Underlying* data) noexcept
+        {
+            if constexpr (IsWide) { return Reg::Load8(data); }
+            else                  { return Reg::Load4(data); }
+        }
+
+        template <typename Reg = Register>
+        static void StoreRegister(Underlying* data, typename Reg::Type value) noexcept
+        {
+            if constexpr (IsWide) { Reg::Store8(data, value); }
+            else                  { Reg::Store4(data, value); }
+        }
+
+        static constexpr std::size_t Alignment = std::has_single_bit(sizeof(T) * ToUnderlying(N))
+                                               ? Math::Min(sizeof(T) * ToUnderlying(N), std::size_t(64))
+                                               : alignof(T);
+
+        alignas(Alignment) T mLanes[ToUnderlying(Size)] = {};
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Integer packet operators
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator% (const Packet<T, N>& a, const Packet<T, N>& b) noexcept
+    {
+        return Packet<T, N>::Map(a, b, [](T u, T v) { return u % v; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator& (const Packet<T, N>& a, const Packet<T, N>& b) noexcept
+    {
+        return Packet<T, N>::Map(a, b, [](T u, T v) { return u & v; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator| (const Packet<T, N>& a, const Packet<T, N>& b) noexcept
+    {
+        return Packet<T, N>::Map(a, b, [](T u, T v) { return u | v; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator^ (const Packet<T, N>& a, const Packet<T, N>& b) noexcept
+    {
+        return Packet<T, N>::Map(a, b, [](T u, T v) { return u ^ v; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator~ (const Packet<T, N>& a) noexcept
+    {
+        return Packet<T, N>::Apply(a, [](T u) { return ~u; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator<< (const Packet<T, N>& a, T shift) noexcept
+    {
+        return Packet<T, N>::Apply(a, [shift](T u) { return u << shift; });
+    }
+
+    template <Concept::StrongIntegerType T, SizeType N>
+    [[nodiscard]] constexpr
+    Packet<T, N> operator>> (const Packet<T, N>& a, T shift) noexcept
+    {
+        return Packet<T, N>::Apply(a, [shift](T u) { return u >> shift; });
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_PACKET_HPP
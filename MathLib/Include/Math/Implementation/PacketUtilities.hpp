@@ -0,0 +1,243 @@
+#ifndef MATHLIB_IMPLEMENTATION_PACKET_UTILITIES_HPP
+#define MATHLIB_IMPLEMENTATION_PACKET_UTILITIES_HPP
+
+#include "Base/Concepts.hpp"
+#include "Packet.hpp"
+#include "Functions/Trigonometric.hpp"
+#include "Functions/FastFunctions.hpp"
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Masks
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::StrongType T, SizeType N>
+    [[nodiscard]] constexpr
+    bool Any(const PacketMask<T, N>& mask) noexcept
+    {
+        return mask.Any();
+    }
+
+    template <Concept::StrongType T, SizeType N>
+    [[nodiscard]] constexpr
+    bool All(const PacketMask<T, N>& mask) noexcept
+    {
+        return mask.All();
+    }
+
+    template <Concept::StrongType T, SizeType N>
+    [[nodiscard]] constexpr
+    bool None(const PacketMask<T, N>& mask) noexcept
+    {
+        return mask.None();
+    }
+
+    // Note(3011): Picks the lanes of a where the mask is set and the lanes
+    // of b everywhere else, i.e. a branch-free (mask ? a : b).
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Select(const typename P::MaskType& mask, const P& a, const P& b) noexcept
+    {
+        P result;
+        for (SizeType i = 0; i < P::Size; ++i)
+        {
+            result[i] = mask[i] ? a[i] : b[i];
+        }
+        return result;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Basic functions
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): The overloads below take their arguments by value so they
+    // are equivalent to the generic ones in BasicFunctions.hpp and win
+    // through their constraint instead of being ambiguous.
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Abs(P val) noexcept
+    {
+        return Select(val > P(0), val, -val);
+    }
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Sign(P val) noexcept
+    {
+        return Select(val > P(0), P(1), Select(val < P(0), P(-1), P(0)));
+    }
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Sqrt(P val) noexcept
+    {
+        return P::Apply(val, Implementation::PacketOps::Sqrt());
+    }
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Min(P v1, P v2) noexcept
+    {
+        return P::Map(v1, v2, Implementation::PacketOps::Min());
+    }
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Max(P v1, P v2) noexcept
+    {
+        return P::Map(v1, v2, Implementation::PacketOps::Max());
+    }
+
+    template <Concept::Packet P>
+    [[nodiscard]] constexpr
+    P Clamp(P val, P min = P(0), P max = P(1)) noexcept
+    {
+        return Min(Max(val, min), max);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Lerp(P val, P begin, P end) noexcept
+    {
+        return ((1 - val) * begin) + (val * end);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Trigonometric functions
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Same kernels as the scalar versions, every lane follows
+    // the same instructions and the results are blended with Select.
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Sin(P val) noexcept
+    {
+        return Implementation::Trig::Sin(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Cos(P val) noexcept
+    {
+        return Implementation::Trig::Cos(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Tan(P val) noexcept
+    {
+        return Implementation::Trig::Tan(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    constexpr
+    void SinCos(P val, P& sin, P& cos) noexcept
+    {
+        Implementation::Trig::SinCos(val, sin, cos);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Asin(P val) noexcept
+    {
+        return Implementation::Trig::Asin(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Acos(P val) noexcept
+    {
+        return Implementation::Trig::Acos(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Atan(P val) noexcept
+    {
+        return Implementation::Trig::Atan(val);
+    }
+
+    template <Concept::Packet P>
+        requires Concept::StrongFloatType<typename P::ValueType>
+    [[nodiscard]] constexpr
+    P Atan2(P y, P x) noexcept
+    {
+        return Implementation::Trig::Atan2(y, x);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Fast approximations
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Fast
+    {
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Exp2(P val) noexcept
+        {
+            return Implementation::Fast::Exp2<Level>(val);
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Exp(P val) noexcept
+        {
+            return Implementation::Fast::Exp<Level>(val);
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Log2(P val) noexcept
+        {
+            return Implementation::Fast::Log2<Level>(val);
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Log(P val) noexcept
+        {
+            return Implementation::Fast::Log2<Level>(val) * P(0.693147180559945309417232121458176568);
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Pow(P val, P exponent) noexcept
+        {
+            return Implementation::Fast::Exp2<Level>(exponent * Implementation::Fast::Log2<Level>(val));
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P RSqrt(P val) noexcept
+        {
+            return Implementation::Fast::RSqrt<Level>(val);
+        }
+
+        template <Precision Level = Precision::Medium, Concept::Packet P>
+            requires Concept::StrongFloatType<typename P::ValueType>
+        [[nodiscard]] constexpr
+        P Reciprocal(P val) noexcept
+        {
+            return Implementation::Fast::Reciprocal<Level>(val);
+        }
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_PACKET_UTILITIES_HPP
@@ -0,0 +1,76 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_BETA_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_BETA_DISTRIBUTION_HPP
+
+#include "GammaDistribution.hpp"
+
+namespace Math
+{
+    // Note(3011): X / (X + Y) for X ~ Gamma(alpha) and Y ~ Gamma(beta).
+    // For small shapes both gamma samples underflow to 0 and the ratio is
+    // NaN, so shapes that are both below 1 use Johnk's method instead: with
+    // x = u^(1 / alpha) and y = v^(1 / beta) for uniform u and v, x / (x + y)
+    // is accepted when x + y <= 1. It runs in log space, x and y underflow
+    // as well.
+    template <Concept::StrongFloatType T>
+    class BetaDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        BetaDistribution(ValueType alpha = ValueType(1), ValueType beta = ValueType(1)) noexcept
+            : mAlpha(alpha), mBeta(beta)
+        {}
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            if (Alpha() < ValueType(1) && Beta() < ValueType(1))
+            {
+                return Johnk(rng);
+            }
+
+            const ValueType x = mAlpha(rng);
+            const ValueType y = mBeta(rng);
+            return x / (x + y);
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Alpha() const noexcept
+        {
+            return mAlpha.Shape();
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Beta() const noexcept
+        {
+            return mBeta.Shape();
+        }
+    private:
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType Johnk(RNG& rng) const noexcept
+        {
+            const UniformUnitDistribution<ValueType> uniform;
+            while (true)
+            {
+                // Note(3011): Uniform in (0, 1], so it can be passed to Log.
+                const ValueType logX = Log(ValueType(1) - uniform(rng)) / Alpha();
+                const ValueType logY = Log(ValueType(1) - uniform(rng)) / Beta();
+
+                const ValueType logMax = Max(logX, logY);
+                const ValueType logSum = logMax + Log(Exp(logX - logMax) + Exp(logY - logMax));
+                if (logSum <= ValueType(0))
+                {
+                    return Exp(logX - logSum);
+                }
+            }
+        }
+
+        GammaDistribution<ValueType> mAlpha;
+        GammaDistribution<ValueType> mBeta;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_BETA_DISTRIBUTION_HPP
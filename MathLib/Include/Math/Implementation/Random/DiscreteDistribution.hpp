@@ -0,0 +1,288 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
+
+#include "Utils.hpp"
+#include "../Base/Parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Note(3011):
+// Alias table after Michael Vose, "A linear algorithm for generating random
+// numbers with a given distribution". Every index owns a bucket of the same
+// size, which selects the index itself below a threshold and a single alias
+// above it, so a sample is one table lookup and one comparison.
+//
+// A bucket is 2^32 units of fixed point and stores its threshold and alias
+// as two u32, eight bytes per index. One u64 draw is split into the bucket
+// (upper half, scaled by multiplication) and the coin (lower half). Both
+// are off by at most about N / 2^32, which is the resolution of the table.
+//
+// Light indices (less than a bucket of weight) are paired with heavy ones
+// in index order, the sweeping variant of Hübschle-Schneider and Sanders,
+// "Parallel Weighted Random Sampling". Laid out on a line, the deficits of
+// the light and the excesses of the heavy indices turn the pairing into
+// prefix sums and a merge, which threads can start anywhere with a binary
+// search. The sums are integers, so the table does not depend on the
+// number of threads.
+
+namespace Math
+{
+    namespace Implementation
+    {
+        // Note(3011): Weights are summed and classified in blocks of this
+        // size, a thread is handed at least AliasRange weights.
+        inline constexpr std::size_t AliasBlock = std::size_t(1) << 12;
+        inline constexpr std::size_t AliasRange = std::size_t(1) << 16;
+    }
+
+    template <Concept::FloatingPointType T = f32>
+    class DiscreteDistribution
+    {
+    public:
+        using ValueType = SizeType;
+        using WeightType = T;
+
+        struct SampleType
+        {
+            SizeType Index;
+            T PDF;
+        };
+
+        [[nodiscard]]
+        DiscreteDistribution() = default;
+
+        // Note(3011): Weights have to be finite and non-negative, at most
+        // 2^32 - 1 of them. All weights zero select every index equally.
+        [[nodiscard]] explicit
+        DiscreteDistribution(std::span<const T> weights)
+        {
+            Rebuild<Execution::Sequential>(weights);
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        SizeType operator()(RNG& rng) const noexcept
+        {
+            const u64 bits = GetRandomBits<u64>(rng);
+            const std::size_t bucket = ToUnderlying(((bits >> 32) * Cast<u64>(mTable.size())) >> 32);
+            const Bucket& entry = mTable[bucket];
+            return Cast<u32>(bits & 0xFFFFFFFF) < entry.Threshold ? Cast<SizeType>(bucket) : Cast<SizeType>(entry.Alias);
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        SampleType Sample(RNG& rng) const noexcept
+        {
+            const SizeType index = (*this)(rng);
+            return { index, PDF(index) };
+        }
+
+        // Note(3011): Probability of the index, its weight over the sum of
+        // all weights.
+        [[nodiscard]]
+        T PDF(SizeType index) const noexcept
+        {
+            return mPDF[ToUnderlying(index)];
+        }
+
+        [[nodiscard]]
+        SizeType Size() const noexcept
+        {
+            return Cast<SizeType>(mTable.size());
+        }
+
+        // Note(3011): Replaces the weights, Execution::Parallel splits large
+        // tables across threads and builds the same table.
+        template <Execution Policy = Execution::Parallel>
+        void Rebuild(std::span<const T> weights)
+        {
+            using Implementation::AliasBlock;
+            using Implementation::AliasRange;
+
+            const std::size_t count = weights.size();
+            mTable.resize(count);
+            mPDF.resize(count);
+            if (count == 0)
+            {
+                return;
+            }
+
+            const std::size_t blocks = (count + AliasBlock - 1) / AliasBlock;
+            std::vector<BlockSums> sums(blocks);
+
+            Implementation::ForRange<Policy>(blocks, AliasRange / AliasBlock, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t b = begin; b < end; ++b)
+                {
+                    f64 weight = 0;
+                    for (std::size_t i = b * AliasBlock; i < std::min((b + 1) * AliasBlock, count); ++i)
+                    {
+                        weight += Cast<f64>(weights[i]);
+                    }
+                    sums[b].Weight = weight;
+                }
+            });
+
+            f64 total = 0;
+            for (const BlockSums& block : sums)
+            {
+                total += block.Weight;
+            }
+
+            const bool uniform = !(total > 0);
+            const f64 scale = uniform ? f64(0) : Cast<f64>(count) * sCapacityF / total;
+            const auto units = [&](std::size_t i)
+            {
+                return uniform ? sCapacity : Cast<u64>(Cast<f64>(weights[i]) * scale + f64(0.5));
+            };
+
+            Implementation::ForRange<Policy>(blocks, AliasRange / AliasBlock, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t b = begin; b < end; ++b)
+                {
+                    BlockSums& block = sums[b];
+                    for (std::size_t i = b * AliasBlock; i < std::min((b + 1) * AliasBlock, count); ++i)
+                    {
+                        mPDF[i] = uniform ? T(1) / Cast<T>(count) : Cast<T>(Cast<f64>(weights[i]) / total);
+
+                        const u64 value = units(i);
+                        if (value < sCapacity)
+                        {
+                            ++block.Lights;
+                            block.Deficit += sCapacity - value;
+                        }
+                        else
+                        {
+                            ++block.Heavies;
+                            block.Excess += value - sCapacity;
+                        }
+                    }
+                }
+            });
+
+            std::size_t lights = 0;
+            std::size_t heavies = 0;
+            u64 deficit = 0;
+            u64 excess = 0;
+            for (BlockSums& block : sums)
+            {
+                block.Lights = std::exchange(lights, lights + block.Lights);
+                block.Heavies = std::exchange(heavies, heavies + block.Heavies);
+                block.Deficit = std::exchange(deficit, deficit + block.Deficit);
+                block.Excess = std::exchange(excess, excess + block.Excess);
+            }
+
+            // Note(3011): Light p covers [lightStart[p], lightStart[p + 1])
+            // of the deficits, heavy q [heavyStart[q], heavyStart[q + 1])
+            // of the excesses.
+            std::vector<u32> lightIndex(lights);
+            std::vector<u32> heavyIndex(heavies);
+            std::vector<u64> lightStart(lights + 1);
+            std::vector<u64> heavyStart(heavies + 1);
+            lightStart[lights] = deficit;
+            heavyStart[heavies] = excess;
+
+            Implementation::ForRange<Policy>(blocks, AliasRange / AliasBlock, [&](std::size_t begin, std::size_t end)
+            {
+                for (std::size_t b = begin; b < end; ++b)
+                {
+                    BlockSums block = sums[b];
+                    for (std::size_t i = b * AliasBlock; i < std::min((b + 1) * AliasBlock, count); ++i)
+                    {
+                        const u64 value = units(i);
+                        if (value < sCapacity)
+                        {
+                            lightIndex[block.Lights] = Cast<u32>(i);
+                            lightStart[block.Lights++] = block.Deficit;
+                            block.Deficit += sCapacity - value;
+                        }
+                        else
+                        {
+                            heavyIndex[block.Heavies] = Cast<u32>(i);
+                            heavyStart[block.Heavies++] = block.Excess;
+                            block.Excess += value - sCapacity;
+                        }
+                    }
+                }
+            });
+
+            // Note(3011): A light index is filled by the heavy whose excess
+            // contains the start of its deficit. A heavy index whose excess
+            // ends inside the deficit of a light one gave away more than it
+            // had and is filled by the next heavy index for the difference.
+            Implementation::ForRange<Policy>(count, AliasRange, [&](std::size_t begin, std::size_t end)
+            {
+                if (begin < lights)
+                {
+                    std::size_t q = std::upper_bound(heavyStart.begin(), heavyStart.end() - 1, lightStart[begin]) - heavyStart.begin();
+                    for (std::size_t p = begin; p < std::min(end, lights); ++p)
+                    {
+                        while (q < heavies && heavyStart[q] <= lightStart[p])
+                        {
+                            ++q;
+                        }
+
+                        const u32 index = lightIndex[p];
+                        mTable[ToUnderlying(index)] = Bucket{
+                            Cast<u32>(sCapacity - (lightStart[p + 1] - lightStart[p])),
+                            q > 0 ? heavyIndex[q - 1] : index
+                        };
+                    }
+                }
+
+                if (end > lights)
+                {
+                    const std::size_t first = std::max(begin, lights) - lights;
+                    std::size_t p = std::lower_bound(lightStart.begin(), lightStart.end(), heavyStart[first + 1]) - lightStart.begin();
+                    for (std::size_t q = first; q < end - lights; ++q)
+                    {
+                        const u64 supply = heavyStart[q + 1];
+                        while (p < lights && lightStart[p] < supply)
+                        {
+                            ++p;
+                        }
+
+                        const u32 index = heavyIndex[q];
+                        if (q + 1 < heavies && lightStart[p] > supply)
+                        {
+                            mTable[ToUnderlying(index)] = Bucket{ Cast<u32>(sCapacity - (lightStart[p] - supply)), heavyIndex[q + 1] };
+                        }
+                        else
+                        {
+                            mTable[ToUnderlying(index)] = Bucket{ Cast<u32>(0xFFFFFFFF), index };
+                        }
+                    }
+                }
+            });
+        }
+    private:
+        struct Bucket
+        {
+            u32 Threshold;
+            u32 Alias;
+        };
+
+        static_assert(sizeof(Bucket) == 8);
+
+        struct BlockSums
+        {
+            f64 Weight = 0;
+            std::size_t Lights = 0;
+            std::size_t Heavies = 0;
+            u64 Deficit = 0;
+            u64 Excess = 0;
+        };
+
+        static constexpr u64 sCapacity = u64(1) << 32;
+        static constexpr f64 sCapacityF = f64(4294967296.0);
+
+        std::vector<Bucket> mTable;
+        std::vector<T> mPDF;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_DISCRETE_DISTRIBUTION_HPP
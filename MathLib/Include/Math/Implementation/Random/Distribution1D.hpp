@@ -0,0 +1,216 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_1D_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_1D_HPP
+
+#include "UniformDistribution.hpp"
+#include "../Functions/BasicFunctions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Note(3011):
+// Piecewise constant density over [0, 1) with one piece per value, as in
+// "Physically Based Rendering" by Pharr, Jakob and Humphreys. Sampling
+// inverts the CDF. Entry g of the guide table is the first piece whose CDF
+// ends in or after the g-th of N equally sized ranges of u, so a sample
+// only searches the pieces between two neighbouring entries, which is a
+// single piece unless the function has spikes. Besides the function the
+// distribution stores the CDF as T and the guide as u32, eight more bytes
+// per piece for f32.
+
+namespace Math
+{
+    template <Concept::FloatingPointType T = f32>
+    class Distribution1D
+    {
+    public:
+        using ValueType = T;
+
+        struct ContinuousSample
+        {
+            T Value;
+            T PDF;
+            SizeType Index;
+        };
+
+        struct DiscreteSample
+        {
+            SizeType Index;
+            T PDF;
+        };
+
+        [[nodiscard]]
+        Distribution1D() = default;
+
+        // Note(3011): Negative values count with their magnitude, all values
+        // zero give the uniform density. An empty function gives an empty
+        // distribution, which has a PDF of 0 and can't be sampled.
+        [[nodiscard]] explicit
+        Distribution1D(std::span<const T> function)
+            : mFunction(function.begin(), function.end()), mCDF(function.size() + 1), mGuide(function.size())
+        {
+            const std::size_t count = mFunction.size();
+            if (count == 0)
+            {
+                return;
+            }
+            mCount = Cast<T>(count);
+
+            f64 total = 0;
+            for (T& value : mFunction)
+            {
+                value = Abs(value);
+                total += Cast<f64>(value);
+            }
+
+            if (!(total > 0))
+            {
+                std::fill(mFunction.begin(), mFunction.end(), T(1));
+                total = Cast<f64>(count);
+            }
+
+            mIntegral = Cast<T>(total / Cast<f64>(count));
+
+            f64 sum = 0;
+            mCDF[0] = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum += Cast<f64>(mFunction[i]);
+                mCDF[i + 1] = Cast<T>(sum / total);
+            }
+            mCDF[count] = 1;
+
+            std::size_t piece = 0;
+            for (std::size_t g = 0; g < count; ++g)
+            {
+                while (piece + 1 < count && Guide(mCDF[piece + 1]) < g)
+                {
+                    ++piece;
+                }
+                mGuide[g] = Cast<u32>(piece);
+            }
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return SampleContinuous(rng).Value;
+        }
+
+        // Note(3011): Maps u in [0, 1) to a point with the density of the
+        // function, the PDF is the density at that point.
+        [[nodiscard]]
+        ContinuousSample SampleContinuous(T u) const noexcept
+        {
+            const std::size_t i = Find(u);
+            const T offset = (u - mCDF[i]) / (mCDF[i + 1] - mCDF[i]);
+
+            // Note(3011): Rounding can move the point onto the neighbouring
+            // piece, which would disagree with PDF.
+            T value = Min((Cast<T>(Cast<i64>(i)) + Clamp(offset)) / mCount, sBelowOne);
+            if (Guide(value) != i) [[unlikely]]
+            {
+                const UnderlyingType<T> direction = (Guide(value) > i) ? 0 : 1;
+                while (Guide(value) != i)
+                {
+                    value = Cast<T>(std::nextafter(ToUnderlying(value), direction));
+                }
+            }
+            return { value, mFunction[i] / mIntegral, Cast<SizeType>(i) };
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        ContinuousSample SampleContinuous(RNG& rng) const noexcept
+        {
+            return SampleContinuous(UniformUnitDistribution<T>()(rng));
+        }
+
+        // Note(3011): Picks a piece with probability proportional to its
+        // value.
+        [[nodiscard]]
+        DiscreteSample SampleDiscrete(T u) const noexcept
+        {
+            const std::size_t i = Find(u);
+            return { Cast<SizeType>(i), DiscretePDF(Cast<SizeType>(i)) };
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        DiscreteSample SampleDiscrete(RNG& rng) const noexcept
+        {
+            return SampleDiscrete(UniformUnitDistribution<T>()(rng));
+        }
+
+        [[nodiscard]]
+        T PDF(T x) const noexcept
+        {
+            if (mFunction.empty())
+            {
+                return T(0);
+            }
+            return mFunction[Guide(x)] / mIntegral;
+        }
+
+        [[nodiscard]]
+        T DiscretePDF(SizeType index) const noexcept
+        {
+            if (mFunction.empty())
+            {
+                return T(0);
+            }
+            return mFunction[ToUnderlying(index)] / (mIntegral * mCount);
+        }
+
+        // Note(3011): Integral of the function over [0, 1), the mean of its
+        // values.
+        [[nodiscard]]
+        T Integral() const noexcept
+        {
+            return mIntegral;
+        }
+
+        [[nodiscard]]
+        SizeType Size() const noexcept
+        {
+            return Cast<SizeType>(mFunction.size());
+        }
+    private:
+        // Note(3011): The range of u the value falls into, which is also
+        // the piece that contains it.
+        [[nodiscard]]
+        std::size_t Guide(T x) const noexcept
+        {
+            // Note(3011): Through the signed type, which converts from
+            // floating point in a single instruction.
+            const std::size_t count = mFunction.size();
+            return std::min(static_cast<std::size_t>(ToUnderlying(Cast<i64>(Max(x, T(0)) * mCount))), count - 1);
+        }
+
+        // Note(3011): The first piece whose CDF ends after u. It lies
+        // between the guide entries of the range of u and the next range,
+        // and has a positive value.
+        [[nodiscard]]
+        std::size_t Find(T u) const noexcept
+        {
+            const std::size_t count = mFunction.size();
+            const std::size_t g = Guide(u);
+            const std::size_t first = ToUnderlying(mGuide[g]);
+            const std::size_t last = (g + 1 < count) ? ToUnderlying(mGuide[g + 1]) : count - 1;
+            return std::upper_bound(mCDF.begin() + first + 1, mCDF.begin() + last + 1, u) - mCDF.begin() - 1;
+        }
+
+        static constexpr T sBelowOne = T(1) - T::Epsilon() / 2;
+
+        std::vector<T> mFunction;
+        std::vector<T> mCDF;
+        std::vector<u32> mGuide;
+        T mIntegral = 0;
+        T mCount = 0;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_1D_HPP
@@ -0,0 +1,161 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_2D_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_2D_HPP
+
+#include "Distribution1D.hpp"
+#include "../../Vector.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Note(3011):
+// Piecewise constant density over [0, 1)^2 on a grid of values stored row
+// by row, x along a row and y across rows. A sample first picks y from the
+// marginal density of the rows and then x from the conditional density of
+// that row, the PDF is the product of both.
+
+namespace Math
+{
+    template <Concept::FloatingPointType T = f32>
+    class Distribution2D
+    {
+    public:
+        using ValueType = Vector2T<T>;
+
+        struct ContinuousSample
+        {
+            Vector2T<T> Value;
+            T PDF;
+            Vector2sz Index;
+        };
+
+        struct DiscreteSample
+        {
+            Vector2sz Index;
+            T PDF;
+        };
+
+        [[nodiscard]]
+        Distribution2D() = default;
+
+        // Note(3011): Values has to hold width * height values, negative
+        // ones count with their magnitude. Like Distribution1D, an empty
+        // grid gives an empty distribution, which has a PDF of 0 and can't
+        // be sampled.
+        [[nodiscard]]
+        Distribution2D(std::span<const T> values, SizeType width, SizeType height)
+        {
+            const std::size_t columns = ToUnderlying(width);
+            const std::size_t rows = ToUnderlying(height);
+            if (columns == 0 || rows == 0)
+            {
+                return;
+            }
+
+            std::vector<T> marginal(rows);
+            mConditionals.reserve(rows);
+            for (std::size_t y = 0; y < rows; ++y)
+            {
+                const std::span<const T> row = values.subspan(y * columns, columns);
+
+                f64 sum = 0;
+                for (T value : row)
+                {
+                    sum += Cast<f64>(Abs(value));
+                }
+                marginal[y] = Cast<T>(sum / Cast<f64>(columns));
+
+                mConditionals.emplace_back(row);
+            }
+            mMarginal = Distribution1D<T>(marginal);
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return SampleContinuous(rng).Value;
+        }
+
+        [[nodiscard]]
+        ContinuousSample SampleContinuous(const Vector2T<T>& u) const noexcept
+        {
+            const auto y = mMarginal.SampleContinuous(u.y);
+            const auto x = mConditionals[ToUnderlying(y.Index)].SampleContinuous(u.x);
+            return { Vector2T<T>(x.Value, y.Value), x.PDF * y.PDF, Vector2sz(x.Index, y.Index) };
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        ContinuousSample SampleContinuous(RNG& rng) const noexcept
+        {
+            const UniformUnitDistribution<T> unit;
+            const T x = unit(rng);
+            return SampleContinuous(Vector2T<T>(x, unit(rng)));
+        }
+
+        [[nodiscard]]
+        DiscreteSample SampleDiscrete(const Vector2T<T>& u) const noexcept
+        {
+            const auto y = mMarginal.SampleDiscrete(u.y);
+            const auto x = mConditionals[ToUnderlying(y.Index)].SampleDiscrete(u.x);
+            return { Vector2sz(x.Index, y.Index), x.PDF * y.PDF };
+        }
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]]
+        DiscreteSample SampleDiscrete(RNG& rng) const noexcept
+        {
+            const UniformUnitDistribution<T> unit;
+            const T x = unit(rng);
+            return SampleDiscrete(Vector2T<T>(x, unit(rng)));
+        }
+
+        [[nodiscard]]
+        T PDF(const Vector2T<T>& point) const noexcept
+        {
+            if (mConditionals.empty())
+            {
+                return T(0);
+            }
+
+            const SizeType row = Min(Cast<SizeType>(Max(point.y, T(0)) * Cast<T>(mConditionals.size())), Height() - 1);
+            return mMarginal.PDF(point.y) * mConditionals[ToUnderlying(row)].PDF(point.x);
+        }
+
+        [[nodiscard]]
+        T DiscretePDF(const Vector2sz& index) const noexcept
+        {
+            if (mConditionals.empty())
+            {
+                return T(0);
+            }
+            return mMarginal.DiscretePDF(index.y) * mConditionals[ToUnderlying(index.y)].DiscretePDF(index.x);
+        }
+
+        // Note(3011): Integral of the function over [0, 1)^2, the mean of
+        // its values.
+        [[nodiscard]]
+        T Integral() const noexcept
+        {
+            return mMarginal.Integral();
+        }
+
+        [[nodiscard]]
+        SizeType Width() const noexcept
+        {
+            return mConditionals.empty() ? SizeType(0) : mConditionals[0].Size();
+        }
+
+        [[nodiscard]]
+        SizeType Height() const noexcept
+        {
+            return Cast<SizeType>(mConditionals.size());
+        }
+    private:
+        std::vector<Distribution1D<T>> mConditionals;
+        Distribution1D<T> mMarginal;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_DISTRIBUTION_2D_HPP
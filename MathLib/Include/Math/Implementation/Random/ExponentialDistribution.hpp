@@ -0,0 +1,54 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+
+#include "Ziggurat.hpp"
+
+namespace Math
+{
+    // Note(3011): The location shifts the distribution to [location, inf),
+    // it also gives the two parameter constructor Concept::Distribution
+    // expects.
+    template <Concept::StrongFloatType T>
+    class ExponentialDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        ExponentialDistribution(ValueType rate = ValueType(1), ValueType location = ValueType(0)) noexcept
+            : mScale(ValueType(1) / rate), mLocation(location)
+        {}
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return mLocation + mScale * Implementation::Ziggurat::Sample<ValueType, Implementation::Ziggurat::Exponential>(rng);
+        }
+
+        template <Concept::PacketRandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        Packet<ValueType, RNG::ValueType::Size> operator()(RNG& rng) const noexcept
+        {
+            using PacketType = Packet<ValueType, RNG::ValueType::Size>;
+            return PacketType(mLocation) + PacketType(mScale) * Implementation::Ziggurat::Sample<ValueType, Implementation::Ziggurat::Exponential>(rng);
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Rate() const noexcept
+        {
+            return ValueType(1) / mScale;
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Location() const noexcept
+        {
+            return mLocation;
+        }
+    private:
+        ValueType mScale;
+        ValueType mLocation;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
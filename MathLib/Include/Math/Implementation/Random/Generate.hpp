@@ -0,0 +1,37 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_GENERATE_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_GENERATE_HPP
+
+#include "../Base/Concepts.hpp"
+
+#include <span>
+
+namespace Math
+{
+    // Note(3011): Fills out with values drawn from dist. Distributions with
+    // a Generate member provide a bulk path (see UniformDistribution.hpp),
+    // all others are called once per element. The generator is copied for
+    // the duration of the fill and written back at the end, so its state
+    // can stay in registers instead of going through the reference after
+    // every store to out.
+    template <Concept::RandomNumberGenerator RNG, typename Dist>
+        requires requires (RNG& rng, const Dist& dist) { { dist(rng) } -> Concept::IsSame<typename Dist::ValueType>; }
+    constexpr
+    void Generate(RNG& rng, const Dist& dist, std::span<typename Dist::ValueType> out) noexcept
+    {
+        RNG local = rng;
+        if constexpr (requires { dist.Generate(local, out); })
+        {
+            dist.Generate(local, out);
+        }
+        else
+        {
+            for (typename Dist::ValueType& value : out)
+            {
+                value = dist(local);
+            }
+        }
+        rng = local;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_GENERATE_HPP
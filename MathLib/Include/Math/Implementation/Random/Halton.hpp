@@ -0,0 +1,77 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
+
+#include "../Base/Types.hpp"
+#include "../Base/Array.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "Scramble.hpp"
+#include "Splitmix.hpp"
+
+// Note(3011): The Halton sequence, dimension d is the radical inverse of
+// the index in the d-th prime. Scrambling permutes every digit depending
+// on the digits before it (Owen scrambling restricted to cyclic shifts of
+// the digits), which removes the correlation between the dimensions with
+// larger bases. The table covers 32 dimensions, higher ones reuse the
+// bases with a different scramble.
+
+namespace Math::Implementation
+{
+    class Halton final
+    {
+    public:
+        static constexpr SizeType Dimensions = 32;
+
+        [[nodiscard]] static constexpr
+        u32 Sequence(u32 index, SizeType dimension) noexcept
+        {
+            return RadicalInverse<false>(index, sPrimes[dimension % Dimensions], 0);
+        }
+
+        [[nodiscard]] static constexpr
+        u32 Scrambled(u32 index, SizeType dimension, u32 seed) noexcept
+        {
+            return RadicalInverse<true>(index, sPrimes[dimension % Dimensions], HashCombine(seed, Cast<u32>(dimension)));
+        }
+    private:
+        // Note(3011): Collects digits until the base power exceeds 2^32, so
+        // the scrambled result has the full 32 bits of precision also when
+        // the index has fewer digits. reversed / scale is the value in
+        // [0, 1), with at most base * 2^32 it is exact in a double.
+        template <bool Scramble>
+        [[nodiscard]] static constexpr
+        u32 RadicalInverse(u32 index, u32 base, u32 seed) noexcept
+        {
+            const u64 wideBase = Cast<u64>(base);
+
+            u64 reversed = 0;
+            u64 scale = 1;
+            while (scale <= Cast<u64>(u32::Max()))
+            {
+                const u32 next = index / base;
+                u32 digit = index - next * base;
+                if constexpr (Scramble)
+                {
+                    // Note(3011): reversed + scale encodes the previous digits
+                    // together with their count.
+                    const u64 prefix = Splitmix64((Cast<u64>(seed) << 32) ^ (reversed + scale))();
+                    digit = Cast<u32>((Cast<u64>(digit) + prefix) % wideBase);
+                }
+
+                reversed = reversed * wideBase + Cast<u64>(digit);
+                scale *= wideBase;
+                index = next;
+            }
+
+            const f64 result = Cast<f64>(reversed) / Cast<f64>(scale) * 0x1.0p32;
+            return Cast<u32>(Min(result, Cast<f64>(u32::Max())));
+        }
+
+        static constexpr Array<u32, Dimensions> sPrimes = Array<u32, Dimensions>(
+            u32(2), u32(3), u32(5), u32(7), u32(11), u32(13), u32(17), u32(19),
+            u32(23), u32(29), u32(31), u32(37), u32(41), u32(43), u32(47), u32(53),
+            u32(59), u32(61), u32(67), u32(71), u32(73), u32(79), u32(83), u32(89),
+            u32(97), u32(101), u32(103), u32(107), u32(109), u32(113), u32(127), u32(131));
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_HALTON_HPP
@@ -0,0 +1,228 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_JUMP_POLYNOMIAL_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_JUMP_POLYNOMIAL_HPP
+
+#include "../Base/Types.hpp"
+#include "../Base/Array.hpp"
+
+#include <vector>
+
+// Note(3011):
+// The state transition of xoshiro is linear over GF(2), so advancing the
+// state by n steps is evaluating the polynomial x^n modulo the
+// characteristic polynomial p of the transition at the transition matrix.
+// That is what the loops behind Jump and LongJump do with their constants,
+// which are x^(2^(2W)) and x^(2^(3W)) modulo p for words of W bits.
+// Polynomials of degree below 4W are stored in four words like the state,
+// bit b of word i is the coefficient of x^(W * i + b).
+
+namespace Math::Implementation
+{
+    template <typename Word>
+    using JumpPolynomial = Array<Word, 4>;
+
+    template <typename Word>
+    inline constexpr SizeType JumpWordBits = sizeof(Word) * 8;
+
+    // Note(3011): Product of a and b modulo p, where low holds the terms of
+    // p below its leading term x^(4W). Works on the underlying integers to
+    // stay inside the operation limit of constant evaluation.
+    template <typename Word>
+    [[nodiscard]] constexpr
+    JumpPolynomial<Word> MultiplyModulo(const JumpPolynomial<Word>& a, const JumpPolynomial<Word>& b,
+                                        const JumpPolynomial<Word>& low) noexcept
+    {
+        using Raw = Math::UnderlyingType<Word>;
+        constexpr int W = sizeof(Raw) * 8;
+
+        Raw shifted[4] = { ToUnderlying(a[0]), ToUnderlying(a[1]), ToUnderlying(a[2]), ToUnderlying(a[3]) };
+        const Raw reduction[4] = { ToUnderlying(low[0]), ToUnderlying(low[1]), ToUnderlying(low[2]), ToUnderlying(low[3]) };
+
+        Raw result[4] = {};
+        for (int i = 0; i < 4; ++i)
+        {
+            const Raw factor = ToUnderlying(b[i]);
+            for (int bit = 0; bit < W; ++bit)
+            {
+                const Raw mask = Raw(0) - ((factor >> bit) & 1);
+                for (int k = 0; k < 4; ++k)
+                {
+                    result[k] ^= shifted[k] & mask;
+                }
+
+                const Raw overflow = Raw(0) - (shifted[3] >> (W - 1));
+                shifted[3] = (shifted[3] << 1) | (shifted[2] >> (W - 1));
+                shifted[2] = (shifted[2] << 1) | (shifted[1] >> (W - 1));
+                shifted[1] = (shifted[1] << 1) | (shifted[0] >> (W - 1));
+                shifted[0] = shifted[0] << 1;
+                for (int k = 0; k < 4; ++k)
+                {
+                    shifted[k] ^= reduction[k] & overflow;
+                }
+            }
+        }
+        return JumpPolynomial<Word>(result[0], result[1], result[2], result[3]);
+    }
+
+    template <typename Word>
+    using JumpPowers = Array<JumpPolynomial<Word>, 64>;
+
+    // Note(3011): x^(2^k) modulo p for every bit k of a u64 distance.
+    template <typename Word>
+    [[nodiscard]] constexpr
+    JumpPowers<Word> MakeJumpPowers(const JumpPolynomial<Word>& low) noexcept
+    {
+        JumpPowers<Word> result;
+
+        JumpPolynomial<Word> power = {};
+        power[0] = 2;
+        for (SizeType k = 0; k < 64; ++k)
+        {
+            result[k] = power;
+            power = MultiplyModulo(power, power, low);
+        }
+        return result;
+    }
+
+    // Note(3011): The generator after the jump described by the
+    // polynomial. The branches follow the bits of the polynomial, which
+    // the branch predictor learns for the fixed polynomials of Jump and
+    // LongJump, a branchless loop measured slower.
+    template <typename Generator, typename Word>
+    [[nodiscard]] constexpr
+    Generator Jumped(Generator generator, const JumpPolynomial<Word>& polynomial) noexcept
+    {
+        JumpPolynomial<Word> state = {};
+        for (SizeType i = 0; i < 4; ++i)
+        {
+            for (SizeType b = 0; b < JumpWordBits<Word>; ++b)
+            {
+                if (ToUnderlying(polynomial[i] & (Word(1) << b)))
+                {
+                    state[0] ^= generator.State()[0];
+                    state[1] ^= generator.State()[1];
+                    state[2] ^= generator.State()[2];
+                    state[3] ^= generator.State()[3];
+                }
+                static_cast<void>(generator());
+            }
+        }
+        return Generator(state);
+    }
+
+    // Note(3011): The generator after n steps, one jump per set bit of n.
+    // Multiplying the powers into x^n first costs more than applying them.
+    template <typename Generator, typename Word>
+    [[nodiscard]] constexpr
+    Generator Advanced(Generator generator, u64 n, const JumpPowers<Word>& powers) noexcept
+    {
+        for (SizeType k = 0; k < 64; ++k)
+        {
+            if (ToUnderlying((n >> k) & 1))
+            {
+                generator = Jumped(generator, powers[k]);
+            }
+        }
+        return generator;
+    }
+
+    // Note(3011): Applies one jump to many states. A jump is linear in the
+    // state, so the jumped images of all 16 values of every nibble of the
+    // state are tabulated, which costs as much as 4W jumps. Afterwards a
+    // jump is one lookup per nibble.
+    template <typename Generator, typename Word>
+    class JumpTable final
+    {
+    public:
+        static constexpr SizeType W = JumpWordBits<Word>;
+        static constexpr SizeType Nibbles = W;
+
+        [[nodiscard]] explicit
+        JumpTable(const JumpPolynomial<Word>& polynomial)
+            : mTable(ToUnderlying(Nibbles * 16))
+        {
+            for (SizeType bit = 0; bit < 4 * W; ++bit)
+            {
+                JumpPolynomial<Word> unit = {};
+                unit[bit / W] = Word(1) << (bit % W);
+
+                const SizeType nibble = bit / 4;
+                const SizeType value = SizeType(1) << (bit % 4);
+                mTable[ToUnderlying(nibble * 16 + value)] = Jumped(Generator(unit), polynomial).State();
+            }
+
+            for (SizeType nibble = 0; nibble < Nibbles; ++nibble)
+            {
+                for (SizeType value = 3; value < 16; ++value)
+                {
+                    const SizeType low = value & (value - 1);
+                    if (low != 0)
+                    {
+                        JumpPolynomial<Word>& entry = mTable[ToUnderlying(nibble * 16 + value)];
+                        entry = mTable[ToUnderlying(nibble * 16 + low)];
+                        for (SizeType k = 0; k < 4; ++k)
+                        {
+                            entry[k] ^= mTable[ToUnderlying(nibble * 16 + (value ^ low))][k];
+                        }
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]]
+        Generator operator()(const Generator& generator) const noexcept
+        {
+            using Raw = Math::UnderlyingType<Word>;
+
+            Raw state[4] = {};
+            const JumpPolynomial<Word>* entries = mTable.data();
+            for (SizeType word = 0; word < 4; ++word)
+            {
+                const Raw value = ToUnderlying(generator.State()[word]);
+                for (int shift = 0; shift < int(sizeof(Raw) * 8); shift += 4)
+                {
+                    const JumpPolynomial<Word>& entry = entries[(value >> shift) & 15];
+                    state[0] ^= ToUnderlying(entry[0]);
+                    state[1] ^= ToUnderlying(entry[1]);
+                    state[2] ^= ToUnderlying(entry[2]);
+                    state[3] ^= ToUnderlying(entry[3]);
+                    entries += 16;
+                }
+            }
+            return Generator(JumpPolynomial<Word>(state[0], state[1], state[2], state[3]));
+        }
+    private:
+        std::vector<JumpPolynomial<Word>> mTable;
+    };
+
+    // Note(3011): The generator and the ones it turns into after 1 to k - 1
+    // jumps, the generator itself is advanced by k jumps. Above 4W streams
+    // the jumps go through a JumpTable.
+    template <typename Generator, typename Word>
+    [[nodiscard]]
+    std::vector<Generator> Split(Generator& generator, const JumpPolynomial<Word>& jump, SizeType k)
+    {
+        std::vector<Generator> result;
+        result.reserve(ToUnderlying(k));
+
+        if (k <= 4 * JumpWordBits<Word>)
+        {
+            for (SizeType i = 0; i < k; ++i)
+            {
+                result.push_back(generator);
+                generator = Jumped(generator, jump);
+            }
+        }
+        else
+        {
+            const JumpTable<Generator, Word> table(jump);
+            for (SizeType i = 0; i < k; ++i)
+            {
+                result.push_back(generator);
+                generator = table(generator);
+            }
+        }
+        return result;
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_JUMP_POLYNOMIAL_HPP
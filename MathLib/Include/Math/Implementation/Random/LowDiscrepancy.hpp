@@ -0,0 +1,115 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_LOW_DISCREPANCY_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_LOW_DISCREPANCY_HPP
+
+#include "Halton.hpp"
+#include "R2.hpp"
+#include "Sobol.hpp"
+
+// Note(3011):
+// Samplers that walk the dimensions of one sample of a low-discrepancy
+// sequence. Every call returns the next dimension as a 0.32 fixed point
+// value, so a sampler satisfies Concept::RandomNumberGenerator and drops in
+// wherever a generator is passed to a distribution. UniformUnitDistribution
+// of f32 reads one dimension per value, f64 reads two and gives no benefit
+// over f32.
+//
+// The seed selects an independent scramble of the sequence, typically one
+// per pixel, the index selects the sample. Jump returns the sampler of the
+// current sample and moves on to the first dimension of the next sample,
+// LongJump returns the current sampler and switches to another scramble.
+
+namespace Math
+{
+    namespace Implementation
+    {
+        template <typename SequenceType>
+        class LowDiscrepancySampler final
+        {
+        public:
+            using ValueType = u32;
+
+            [[nodiscard]] constexpr
+            LowDiscrepancySampler(u32 seed = 0) noexcept
+                : LowDiscrepancySampler(seed, 0)
+            {}
+
+            [[nodiscard]] constexpr
+            LowDiscrepancySampler(u32 seed, u32 index, SizeType dimension = 0) noexcept
+                : mSeed(seed), mIndex(index), mDimension(dimension)
+            {}
+
+            [[nodiscard]] constexpr
+            u32 operator() () noexcept
+            {
+                return SequenceType::Scrambled(mIndex, mDimension++, mSeed);
+            }
+
+            [[nodiscard]] constexpr
+            LowDiscrepancySampler Jump() noexcept
+            {
+                LowDiscrepancySampler result = *this;
+                ++mIndex;
+                mDimension = 0;
+                return result;
+            }
+
+            [[nodiscard]] constexpr
+            LowDiscrepancySampler LongJump() noexcept
+            {
+                LowDiscrepancySampler result = *this;
+                mSeed = Splitmix32(mSeed)();
+                return result;
+            }
+
+            // Note(3011): Random access to any sample, independent of the
+            // current position.
+            [[nodiscard]] constexpr
+            u32 Sample(u32 index, SizeType dimension) const noexcept
+            {
+                return SequenceType::Scrambled(index, dimension, mSeed);
+            }
+
+            // Note(3011): The unscrambled sequence.
+            [[nodiscard]] static constexpr
+            u32 Sequence(u32 index, SizeType dimension) noexcept
+            {
+                return SequenceType::Sequence(index, dimension);
+            }
+
+            constexpr
+            void Seek(u32 index, SizeType dimension = 0) noexcept
+            {
+                mIndex = index;
+                mDimension = dimension;
+            }
+
+            [[nodiscard]] constexpr
+            u32 Seed() const noexcept
+            {
+                return mSeed;
+            }
+
+            [[nodiscard]] constexpr
+            u32 Index() const noexcept
+            {
+                return mIndex;
+            }
+
+            [[nodiscard]] constexpr
+            SizeType Dimension() const noexcept
+            {
+                return mDimension;
+            }
+        private:
+            u32 mSeed;
+            u32 mIndex;
+            SizeType mDimension;
+        };
+    }
+
+    using SobolSampler = Implementation::LowDiscrepancySampler<Implementation::Sobol>;
+    using HaltonSampler = Implementation::LowDiscrepancySampler<Implementation::Halton>;
+    using R2Sampler = Implementation::LowDiscrepancySampler<Implementation::R2>;
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_LOW_DISCREPANCY_HPP
@@ -0,0 +1,51 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
+
+#include "Ziggurat.hpp"
+
+namespace Math
+{
+    template <Concept::StrongFloatType T>
+    class NormalDistribution
+    {
+    public:
+        using ValueType = T;
+
+        [[nodiscard]] constexpr
+        NormalDistribution(ValueType mean = ValueType(0), ValueType deviation = ValueType(1)) noexcept
+            : mMean(mean), mDeviation(deviation)
+        {}
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType operator()(RNG& rng) const noexcept
+        {
+            return mMean + mDeviation * Implementation::Ziggurat::Sample<ValueType, Implementation::Ziggurat::Normal>(rng);
+        }
+
+        template <Concept::PacketRandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        Packet<ValueType, RNG::ValueType::Size> operator()(RNG& rng) const noexcept
+        {
+            using PacketType = Packet<ValueType, RNG::ValueType::Size>;
+            return PacketType(mMean) + PacketType(mDeviation) * Implementation::Ziggurat::Sample<ValueType, Implementation::Ziggurat::Normal>(rng);
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Mean() const noexcept
+        {
+            return mMean;
+        }
+
+        [[nodiscard]] constexpr
+        ValueType Deviation() const noexcept
+        {
+            return mDeviation;
+        }
+    private:
+        ValueType mMean;
+        ValueType mDeviation;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_NORMAL_DISTRIBUTION_HPP
@@ -0,0 +1,174 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_PHILOX_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_PHILOX_HPP
+
+// Note(3011):
+// Philox4x32-10 from "Parallel Random Numbers: As Easy as 1, 2, 3" by
+// Salmon, Moraes, Dror and Shaw. The generator has no state besides a key
+// and a 128 bit counter, every value is a bijection of the two, so any
+// value of any stream can be computed directly without generating the ones
+// before it. The counter is split into a 64 bit position (low half) and a
+// 64 bit stream (high half), which lets every pixel, sample or bounce pick
+// its own stream from its indices instead of carrying generators around.
+//
+// Jump and LongJump follow the semantics of the xoshiro generators. Jump
+// moves to the next stream, LongJump advances the counter by 2^96 blocks.
+
+#include "../Base/Types.hpp"
+#include "../Base/Array.hpp"
+#include "../Functions/IntUtils.hpp"
+
+namespace Math
+{
+    class Philox4x32 final
+    {
+    public:
+        using ValueType = u32;
+        using KeyType = Array<u32, 2>;
+        using CounterType = Array<u32, 4>;
+
+        [[nodiscard]] constexpr
+        Philox4x32(u32 seed = 0) noexcept
+            : Philox4x32(KeyType(seed, u32(0)), CounterType())
+        {}
+
+        // Note(3011): Value position of the given stream, a block of four
+        // values is generated per counter.
+        [[nodiscard]] constexpr
+        Philox4x32(u64 key, u64 stream, u64 position = 0) noexcept
+            : Philox4x32(KeyType(Low(key), High(key)), CounterType(u32(0), u32(0), Low(stream), High(stream)))
+        {
+            Seek(position);
+        }
+
+        [[nodiscard]] constexpr
+        Philox4x32(const KeyType& key, const CounterType& counter) noexcept
+            : mKey(key), mCounter(counter), mBlock(Block(key, counter)), mIndex(0)
+        {}
+
+        [[nodiscard]] constexpr
+        u32 operator() () noexcept
+        {
+            const u32 result = mBlock[mIndex];
+            if (++mIndex == 4)
+            {
+                mIndex = 0;
+                Increment(0);
+                mBlock = Block(mKey, mCounter);
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        Philox4x32 Jump() noexcept
+        {
+            Philox4x32 result = *this;
+            Increment(2);
+            mBlock = Block(mKey, mCounter);
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        Philox4x32 LongJump() noexcept
+        {
+            Philox4x32 result = *this;
+            Increment(3);
+            mBlock = Block(mKey, mCounter);
+            return result;
+        }
+
+        // Note(3011): Moves to the given value position of the current
+        // stream.
+        constexpr
+        void Seek(u64 position) noexcept
+        {
+            const u64 block = position >> 2;
+            mCounter[0] = Low(block);
+            mCounter[1] = High(block);
+            mBlock = Block(mKey, mCounter);
+            mIndex = Cast<SizeType>(position & 3);
+        }
+
+        [[nodiscard]] constexpr
+        u64 Stream() const noexcept
+        {
+            return (Cast<u64>(mCounter[3]) << 32) | Cast<u64>(mCounter[2]);
+        }
+
+        [[nodiscard]] constexpr
+        u64 Position() const noexcept
+        {
+            return (((Cast<u64>(mCounter[1]) << 32) | Cast<u64>(mCounter[0])) << 2) | Cast<u64>(mIndex);
+        }
+
+        [[nodiscard]] constexpr
+        const KeyType& Key() const noexcept
+        {
+            return mKey;
+        }
+
+        [[nodiscard]] constexpr
+        const CounterType& Counter() const noexcept
+        {
+            return mCounter;
+        }
+
+        // Note(3011): The four values of the given counter, this is the
+        // whole generator.
+        [[nodiscard]] static constexpr
+        CounterType Block(KeyType key, CounterType counter) noexcept
+        {
+            for (SizeType round = 0; round < 10; ++round)
+            {
+                if (round > 0)
+                {
+                    key[0] += sWeyl[0];
+                    key[1] += sWeyl[1];
+                }
+
+                u32 high0;
+                u32 high1;
+                const u32 low0 = MultiplyExtended(sMultipliers[0], counter[0], high0);
+                const u32 low1 = MultiplyExtended(sMultipliers[1], counter[2], high1);
+
+                counter = CounterType(high1 ^ counter[1] ^ key[0], low1, high0 ^ counter[3] ^ key[1], low0);
+            }
+            return counter;
+        }
+    private:
+        [[nodiscard]] static constexpr
+        u32 Low(u64 val) noexcept
+        {
+            return Cast<u32>(val & 0xFFFFFFFF);
+        }
+
+        [[nodiscard]] static constexpr
+        u32 High(u64 val) noexcept
+        {
+            return Cast<u32>(val >> 32);
+        }
+
+        // Note(3011): Adds one to the counter word and carries into the
+        // words above it.
+        constexpr
+        void Increment(SizeType word) noexcept
+        {
+            for (; word < 4; ++word)
+            {
+                if (++mCounter[word] != 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        KeyType mKey;
+        CounterType mCounter;
+        CounterType mBlock;
+        SizeType mIndex;
+
+        static constexpr Array<u32, 2> sMultipliers = Array<u32, 2>(u32(0xD2511F53), u32(0xCD9E8D57));
+        static constexpr Array<u32, 2> sWeyl = Array<u32, 2>(u32(0x9E3779B9), u32(0xBB67AE85));
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_PHILOX_HPP
@@ -2,13 +2,23 @@
 #define MATHLIB_IMPLEMENTATION_RANDOM_POISSON_DISTRIBUTION_HPP
 
 #include "UniformDistribution.hpp"
+#include "../Base/Array.hpp"
+#include "../Functions/FloatUtils.hpp"
+#include "../Functions/Log.hpp"
+
+#include <span>
+
+// Note(3011):
+// Means below InversionLimit walk the CDF from 0, which costs about mean
+// steps and needs exp(-mean) to be representable. Larger means use the
+// transformed rejection method with squeeze (PTRS) of Wolfgang Hörmann,
+// "The transformed rejection method for generating Poisson random
+// variables", which takes about 1.1 pairs of uniform numbers on average
+// independent of the mean. PTRS works in f64 regardless of the value type,
+// the acceptance test subtracts terms of the size of mean * log(mean).
 
 namespace Math
 {
-    // Note(3011):
-    // Works fine for mean values up to ~700 (doubles/f64) or ~100 (floats/f32).
-    // This is not ideal, but it should work fine for most purposes.
-
     template <Concept::StrongIntegerType T>
     class PoissonDistribution
     {
@@ -16,19 +26,70 @@ namespace Math
         using ValueType = T;
         using MeanType = FloatingPointSelector<sizeof(ValueType)>;
 
+        static constexpr f64 InversionLimit = 10;
+
         [[nodiscard]] constexpr
         PoissonDistribution(MeanType mean = Cast<MeanType>(0))
-            : mUniform(Cast<MeanType>(0), Cast<MeanType>(1)), mMean(mean)
-        {}
+            : mUniform(Cast<MeanType>(0), Cast<MeanType>(1)), mMean(mean),
+              mInversion(Cast<f64>(mean) < InversionLimit)
+        {
+            const f64 lambda = Cast<f64>(mean);
+            if (mInversion)
+            {
+                mExpMean = Exp(-mMean);
+                return;
+            }
+
+            mLogMean = Log(lambda);
+            mB = f64(0.931) + f64(2.53) * Sqrt(lambda);
+            mA = f64(-0.059) + f64(0.02483) * mB;
+            mLogAlpha = Log(f64(1.1239) + f64(1.1328) / (mB - f64(3.4)));
+            mSqueeze = f64(0.9277) - f64(3.6224) / (mB - 2);
+        }
 
         template <Concept::RandomNumberGenerator RNG>
         [[nodiscard]] constexpr
         ValueType operator()(RNG& rng) const noexcept
+        {
+            return mInversion ? Inversion(rng) : TransformedRejection(rng);
+        }
+
+        // Note(3011): Same values as calling operator() for every element,
+        // the method is chosen once for the whole span.
+        template <Concept::RandomNumberGenerator RNG>
+        constexpr
+        void Generate(RNG& rng, std::span<ValueType> out) const noexcept
+        {
+            if (mInversion)
+            {
+                for (ValueType& value : out)
+                {
+                    value = Inversion(rng);
+                }
+            }
+            else
+            {
+                for (ValueType& value : out)
+                {
+                    value = TransformedRejection(rng);
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr
+        MeanType Mean() const noexcept
+        {
+            return mMean;
+        }
+    private:
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType Inversion(RNG& rng) const noexcept
         {
             MeanType uniformSample = mUniform(rng);
 
             ValueType i = 0;
-            MeanType p = Exp(-mMean);
+            MeanType p = mExpMean;
             MeanType cdf = p;
             while (uniformSample >= cdf)
             {
@@ -39,9 +100,69 @@ namespace Math
 
             return i;
         }
-    private:
+
+        template <Concept::RandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        ValueType TransformedRejection(RNG& rng) const noexcept
+        {
+            const UniformUnitDistribution<f64> unit;
+            const f64 lambda = Cast<f64>(mMean);
+
+            while (true)
+            {
+                const f64 u = unit(rng) - f64(0.5);
+                const f64 v = unit(rng);
+                const f64 us = f64(0.5) - Abs(u);
+                const i64 k = Floor<i64, f64>((2 * mA / us + mB) * u + lambda + f64(0.43));
+
+                // Note(3011): The squeeze accepts about 86% of the pairs.
+                if (us >= f64(0.07) && v <= mSqueeze)
+                {
+                    return Cast<ValueType>(k);
+                }
+                if (k < 0 || (us < f64(0.013) && v > us))
+                {
+                    continue;
+                }
+                if (Log(v) + mLogAlpha - Log(mA / (us * us) + mB) <= -lambda + Cast<f64>(k) * mLogMean - LogFactorial(k))
+                {
+                    return Cast<ValueType>(k);
+                }
+            }
+        }
+
+        // Note(3011): Stirling's series, accurate to about 1e-10 from k = 10
+        // on, below that a table.
+        [[nodiscard]] static constexpr
+        f64 LogFactorial(i64 k) noexcept
+        {
+            if (k < 10)
+            {
+                return sLogFactorials[Cast<SizeType>(k)];
+            }
+
+            const f64 x = Cast<f64>(k + 1);
+            const f64 x2 = x * x;
+            return (x - f64(0.5)) * Log(x) - x + f64(0.918938533204672742)
+                + (f64(1) / 12 - (f64(1) / 360 - f64(1) / (1260 * x2)) / x2) / x;
+        }
+
+        static constexpr Array<f64, 10> sLogFactorials = Array<f64, 10>(
+            0.0, 0.0, 0.693147180559945309, 1.791759469228055001,
+            3.178053830347945620, 4.787491742782045994, 6.579251212010100995,
+            8.525161361065414300, 10.604602902745250228, 12.801827480081469611);
+
         UniformDistribution<MeanType> mUniform;
         MeanType mMean;
+        bool mInversion;
+
+        MeanType mExpMean = 0;
+
+        f64 mLogMean = 0;
+        f64 mA = 0;
+        f64 mB = 0;
+        f64 mLogAlpha = 0;
+        f64 mSqueeze = 0;
     };
 }
 
@@ -0,0 +1,43 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_R2_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_R2_HPP
+
+#include "../Base/Types.hpp"
+#include "../Base/Array.hpp"
+#include "Scramble.hpp"
+
+// Note(3011): Martin Roberts' R2 sequence, the Kronecker sequence
+// index * (1 / g, 1 / g^2) mod 1 with the plastic number g, in 0.32 fixed
+// point. Dimensions are used in pairs. Scrambling rotates every pair by a
+// random offset (Cranley-Patterson rotation) and shuffles the indices of
+// all pairs but the first, so the pairs are decorrelated while the first
+// pair keeps the progressive order of the sequence.
+
+namespace Math::Implementation
+{
+    class R2 final
+    {
+    public:
+        static constexpr SizeType Dimensions = 2;
+
+        [[nodiscard]] static constexpr
+        u32 Sequence(u32 index, SizeType dimension) noexcept
+        {
+            return index * sAlpha[dimension % Dimensions];
+        }
+
+        [[nodiscard]] static constexpr
+        u32 Scrambled(u32 index, SizeType dimension, u32 seed) noexcept
+        {
+            const u32 pair = Cast<u32>(dimension / Dimensions);
+            if (pair != 0)
+            {
+                index = NestedUniformScramble(index, HashCombine(seed, ~pair));
+            }
+            return Sequence(index, dimension) + HashCombine(seed, Cast<u32>(dimension));
+        }
+    private:
+        static constexpr Array<u32, Dimensions> sAlpha = Array<u32, Dimensions>(u32(0xC13FA9A9), u32(0x91E10DA5));
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_R2_HPP
@@ -0,0 +1,46 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_SCRAMBLE_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_SCRAMBLE_HPP
+
+#include "../Base/Types.hpp"
+#include "../Functions/IntUtils.hpp"
+#include "Splitmix.hpp"
+
+// Note(3011): Hash-based scrambling of low-discrepancy sequences, from
+// "Practical Hash-based Owen Scrambling" by Brent Burley. The scrambles
+// keep the stratification of the sequences, so the first 2^k values of a
+// scrambled sequence still fall into different intervals of size 2^-k.
+
+namespace Math::Implementation
+{
+    [[nodiscard]] constexpr
+    u32 HashCombine(u32 seed, u32 val) noexcept
+    {
+        return Splitmix32(seed ^ Splitmix32(val)())();
+    }
+
+    // Note(3011): Every multiplication with an even constant only carries
+    // bits upwards, so bit k of the result depends on bits 0 to k of val.
+    // On bit-reversed values this is a random permutation of every subtree
+    // of the binary digits, which is what Owen scrambling asks for.
+    [[nodiscard]] constexpr
+    u32 LaineKarras(u32 val, u32 seed) noexcept
+    {
+        val += seed;
+        val ^= val * 0x6C50B47C;
+        val ^= val * 0xB82F1E52;
+        val ^= val * 0xC7AFE638;
+        val ^= val * 0x8D22F6E6;
+        return val;
+    }
+
+    // Note(3011): Owen scrambling of a 0.32 fixed point value in base 2.
+    // Applied to an index it shuffles the indices [0, 2^k) among each
+    // other for every k.
+    [[nodiscard]] constexpr
+    u32 NestedUniformScramble(u32 val, u32 seed) noexcept
+    {
+        return ReverseBits(LaineKarras(ReverseBits(val), seed));
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_SCRAMBLE_HPP
@@ -0,0 +1,105 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
+
+#include "../Base/Types.hpp"
+#include "../Base/Array.hpp"
+#include "Scramble.hpp"
+
+// Note(3011): The Sobol sequence in base 2 with the primitive polynomials
+// and initial direction numbers of Joe and Kuo (new-joe-kuo-6.21201) for
+// the first 16 dimensions. Higher dimensions reuse the table in groups of
+// 16 with the indices shuffled per group, so the groups are decorrelated
+// but every group is still a (t, m, s)-net for power of two sample counts.
+
+namespace Math::Implementation
+{
+    // Note(3011): Degree s, coefficients a and initial numbers m of the
+    // polynomials of dimensions 1 to 15, dimension 0 is the van der Corput
+    // sequence and has no polynomial.
+    [[nodiscard]] constexpr
+    Array<Array<u32, 32>, 16> MakeSobolDirections() noexcept
+    {
+        constexpr Array<u32, 15> degree = Array<u32, 15>(1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6);
+        constexpr Array<u32, 15> coefficients = Array<u32, 15>(0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14, 1, 13, 16);
+        constexpr Array<u32, 15 * 6> initial = Array<u32, 15 * 6>(
+            1, 0, 0, 0, 0, 0,
+            1, 3, 0, 0, 0, 0,
+            1, 3, 1, 0, 0, 0,
+            1, 1, 1, 0, 0, 0,
+            1, 1, 3, 3, 0, 0,
+            1, 3, 5, 13, 0, 0,
+            1, 1, 5, 5, 17, 0,
+            1, 1, 5, 5, 5, 0,
+            1, 1, 7, 11, 19, 0,
+            1, 1, 5, 1, 1, 0,
+            1, 1, 1, 3, 11, 0,
+            1, 3, 5, 5, 31, 0,
+            1, 3, 3, 9, 7, 49,
+            1, 1, 1, 15, 21, 21,
+            1, 3, 1, 13, 27, 49);
+
+        Array<Array<u32, 32>, 16> result;
+        for (SizeType bit = 0; bit < 32; ++bit)
+        {
+            result[0][bit] = u32(1) << (31 - bit);
+        }
+
+        for (SizeType d = 1; d < 16; ++d)
+        {
+            const SizeType s = Cast<SizeType>(degree[d - 1]);
+            for (SizeType bit = 0; bit < 32; ++bit)
+            {
+                if (bit < s)
+                {
+                    result[d][bit] = initial[(d - 1) * 6 + bit] << (31 - bit);
+                    continue;
+                }
+
+                u32 direction = result[d][bit - s] ^ (result[d][bit - s] >> s);
+                for (SizeType k = 1; k < s; ++k)
+                {
+                    if (ToUnderlying((coefficients[d - 1] >> (s - 1 - k)) & 1))
+                    {
+                        direction ^= result[d][bit - k];
+                    }
+                }
+                result[d][bit] = direction;
+            }
+        }
+        return result;
+    }
+
+    class Sobol final
+    {
+    public:
+        static constexpr SizeType Dimensions = 16;
+
+        [[nodiscard]] static constexpr
+        u32 Sequence(u32 index, SizeType dimension) noexcept
+        {
+            const Array<u32, 32>& directions = sDirections[dimension % Dimensions];
+
+            u32 result = 0;
+            for (SizeType bit = 0; index != 0; index >>= 1, ++bit)
+            {
+                if (ToUnderlying(index & 1))
+                {
+                    result ^= directions[bit];
+                }
+            }
+            return result;
+        }
+
+        [[nodiscard]] static constexpr
+        u32 Scrambled(u32 index, SizeType dimension, u32 seed) noexcept
+        {
+            const u32 group = Cast<u32>(dimension / Dimensions);
+            const u32 shuffled = NestedUniformScramble(index, HashCombine(seed, ~group));
+            return NestedUniformScramble(Sequence(shuffled, dimension), HashCombine(seed, Cast<u32>(dimension)));
+        }
+    private:
+        static constexpr Array<Array<u32, 32>, Dimensions> sDirections = MakeSobolDirections();
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_SOBOL_HPP
@@ -2,10 +2,17 @@
 #define MATHLIB_IMPLEMENTATION_RANDOM_UNIFORM_DISTRIBUTION_HPP
 
 #include "../Base/Concepts.hpp"
+#include "../Base/Array.hpp"
 #include "../Functions/BasicFunctions.hpp"
+#include "../Functions/IntUtils.hpp"
 #include "../Functions/ValueShift.hpp"
+#include "../Packet.hpp"
 #include "Utils.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <span>
+
 namespace Math
 {
     // Note(3011): This forward decl should accept only Concept::StrongType,
@@ -23,16 +30,68 @@ namespace Math
         [[nodiscard]] constexpr
         ValueType operator()(RNG& rng) const noexcept
         {
-            using Uint = UnsignedIntegerSelector<sizeof(ValueType)>;
-            Uint randomBits = GetRandomBits<Uint>(rng);
+            return FromBits(GetRandomBits<Uint>(rng));
+        }
+
+        // Note(3011): Converts every lane of a packet generator, lane i
+        // matches the scalar overload on the generator of that lane.
+        template <Concept::PacketRandomNumberGenerator RNG>
+        [[nodiscard]] constexpr
+        Packet<ValueType, RNG::ValueType::Size> operator()(RNG& rng) const noexcept
+        {
+            constexpr SizeType N = RNG::ValueType::Size;
+
+            const Packet<Uint, N> bits = GetRandomBits<Uint>(rng);
+
+            Packet<ValueType, N> result;
+            for (SizeType i = 0; i < N; ++i)
+            {
+                result[i] = FromBits(bits[i]);
+            }
+            return result;
+        }
+
+        // Note(3011): Same values as calling operator() for every element.
+        // The raw bits of a block are drawn first and converted afterwards,
+        // which keeps the conversion loop free of generator calls so the
+        // compiler can vectorize it.
+        template <Concept::RandomNumberGenerator RNG>
+        constexpr
+        void Generate(RNG& rng, std::span<ValueType> out) const noexcept
+        {
+            constexpr std::size_t BlockSize = 64;
 
+            Array<Uint, BlockSize> bits;
+            for (std::size_t begin = 0; begin < out.size(); begin += BlockSize)
+            {
+                const std::size_t count = std::min(BlockSize, out.size() - begin);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    bits[i] = GetRandomBits<Uint>(rng);
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    out[begin + i] = FromBits(bits[i]);
+                }
+            }
+        }
+    private:
+        using Uint = UnsignedIntegerSelector<sizeof(ValueType)>;
+
+        using Int = SignedIntegerSelector<sizeof(ValueType)>;
+
+        // Note(3011): The shifted bits fit the signed type, which converts
+        // to floating point in a single instruction, also in SIMD lanes.
+        [[nodiscard]] static constexpr
+        ValueType FromBits(Uint randomBits) noexcept
+        {
             if constexpr (sizeof(ValueType) == 4)
             {
-                return Cast<ValueType>(randomBits >> 8) * 0x1.0p-24f;
+                return Cast<ValueType>(Cast<Int>(randomBits >> 8)) * 0x1.0p-24f;
             }
             else if constexpr (sizeof(ValueType) == 8)
             {
-                return Cast<ValueType>(randomBits >> 11) * 0x1.0p-53;
+                return Cast<ValueType>(Cast<Int>(randomBits >> 11)) * 0x1.0p-53;
             }
         }
     };
@@ -98,6 +157,46 @@ namespace Math
 
             return ValueShift<ValueType>(begin + (result % range));
         }
+
+        // Note(3011): Uses Lemire's nearly divisionless method, the high
+        // half of random bits times the range is the result, and only the
+        // rare draws whose low half falls below 2^n mod range are rejected.
+        // This maps the bits differently than operator(), so the values are
+        // equally distributed but not the same as calling it repeatedly.
+        template <Concept::RandomNumberGenerator RNG>
+        constexpr
+        void Generate(RNG& rng, std::span<ValueType> out) const noexcept
+        {
+            using RandomBitsType = UnsignedIntegerSelector<sizeof(ValueType)>;
+
+            const RandomBitsType begin = ValueShift<RandomBitsType>(mBegin);
+            const RandomBitsType range = ValueShift<RandomBitsType>(mEnd) - begin;
+
+            if (range == RandomBitsType::Max())
+            {
+                for (ValueType& value : out)
+                {
+                    value = ValueShift<ValueType>(GetRandomBits<RandomBitsType>(rng));
+                }
+                return;
+            }
+
+            const RandomBitsType count = range + 1;
+            for (ValueType& value : out)
+            {
+                RandomBitsType high;
+                RandomBitsType low = MultiplyExtended(GetRandomBits<RandomBitsType>(rng), count, high);
+                if (low < count)
+                {
+                    const RandomBitsType threshold = (RandomBitsType::Max() - range) % count;
+                    while (low < threshold)
+                    {
+                        low = MultiplyExtended(GetRandomBits<RandomBitsType>(rng), count, high);
+                    }
+                }
+                value = ValueShift<ValueType>(begin + high);
+            }
+        }
     private:
         ValueType mBegin;
         ValueType mEnd;
@@ -121,6 +220,18 @@ namespace Math
             ValueType result = UniformUnitDistribution<ValueType>()(rng);
             return Lerp(result, mBegin, mEnd);
         }
+
+        // Note(3011): Same values as calling operator() for every element.
+        template <Concept::RandomNumberGenerator RNG>
+        constexpr
+        void Generate(RNG& rng, std::span<ValueType> out) const noexcept
+        {
+            UniformUnitDistribution<ValueType>().Generate(rng, out);
+            for (ValueType& value : out)
+            {
+                value = Lerp(value, mBegin, mEnd);
+            }
+        }
     private:
         ValueType mBegin;
         ValueType mEnd;
@@ -3,6 +3,7 @@
 
 #include "../Base/Concepts.hpp"
 #include "../Functions/ValueShift.hpp"
+#include "../Packet.hpp"
 
 namespace Math
 {
@@ -28,6 +29,43 @@ namespace Math
             return result;
         }
     }
+
+    // Note(3011): Lane i holds the bits the scalar overload returns for the
+    // generator of lane i.
+    template <Concept::StrongType T, Concept::PacketRandomNumberGenerator RNG>
+        requires Concept::UnsignedIntegralType<T>
+    [[nodiscard]] constexpr
+    Packet<T, RNG::ValueType::Size> GetRandomBits(RNG& rng) noexcept
+    {
+        using Lanes = typename RNG::ValueType;
+        using Bits = typename Lanes::ValueType;
+
+        Packet<T, Lanes::Size> result;
+        if constexpr (sizeof(T) <= sizeof(Bits))
+        {
+            const Lanes bits = rng();
+            for (SizeType i = 0; i < Lanes::Size; ++i)
+            {
+                result[i] = ValueShift<T>(bits[i]);
+            }
+        }
+        else
+        {
+            for (SizeType i = 0; i < Lanes::Size; ++i)
+            {
+                result[i] = 0;
+            }
+            for (SizeType k = 0; k < (sizeof(T) / sizeof(Bits)); ++k)
+            {
+                const Lanes bits = rng();
+                for (SizeType i = 0; i < Lanes::Size; ++i)
+                {
+                    result[i] |= Cast<T>(bits[i]) << (k * sizeof(Bits) * 8);
+                }
+            }
+        }
+        return result;
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_RANDOM_UTILS_HPP
@@ -13,10 +13,18 @@
 // possible to easily advance the state of the PRNG by just calling the
 // Jump functions and discarding the result.
 
+// Note(3011):
+// Advance moves the state by any number of steps below 2^64 through the
+// polynomials of JumpPolynomial.hpp, Split hands out consecutive jumps
+// as one std::vector for one stream per task.
+
 #include "../Base/Types.hpp"
 #include "../Base/Array.hpp"
 #include "../Functions/IntUtils.hpp"
 #include "Splitmix.hpp"
+#include "JumpPolynomial.hpp"
+
+#include <vector>
 
 namespace Math
 {
@@ -36,6 +44,11 @@ namespace Math
             }
         }
 
+        [[nodiscard]] constexpr
+        Xoshiro128StarStar(const Array<u32, 4>& state)
+            : mState(state)
+        {}
+
         [[nodiscard]] constexpr
         u32 operator() () noexcept
         {
@@ -57,48 +70,40 @@ namespace Math
         [[nodiscard]] constexpr
         Xoshiro128StarStar Jump() noexcept
         {
-            Xoshiro128StarStar result = *this;
-            Xoshiro128StarStar temp = *this;
-            mState = {};
-            for (SizeType i = 0; i < sJump.Size; ++i)
-            {
-                for (SizeType b = 0; b < SizeType(32); ++b)
-                {
-                    if (ToUnderlying(sJump[i] & (u32(1) << b)))
-                    {
-                        mState[0] ^= temp.mState[0];
-                        mState[1] ^= temp.mState[1];
-                        mState[2] ^= temp.mState[2];
-                        mState[3] ^= temp.mState[3];
-                    }
-                    static_cast<void>(temp());
-                }
-            }
+            const Xoshiro128StarStar result = *this;
+            *this = Implementation::Jumped(*this, sJump);
             return result;
         }
 
         [[nodiscard]] constexpr
         Xoshiro128StarStar LongJump() noexcept
         {
-            Xoshiro128StarStar result = *this;
-            Xoshiro128StarStar temp = *this;
-            mState = {};
-            for (SizeType i = 0; i < sLongJump.Size; ++i)
-            {
-                for (SizeType b = 0; b < SizeType(32); ++b)
-                {
-                    if (ToUnderlying(sLongJump[i] & (u32(1) << b)))
-                    {
-                        mState[0] ^= temp.mState[0];
-                        mState[1] ^= temp.mState[1];
-                        mState[2] ^= temp.mState[2];
-                        mState[3] ^= temp.mState[3];
-                    }
-                    static_cast<void>(temp());
-                }
-            }
+            const Xoshiro128StarStar result = *this;
+            *this = Implementation::Jumped(*this, sLongJump);
             return result;
         }
+
+        // Note(3011): Same as discarding n values, in at most 64 jumps
+        // whatever the size of n.
+        constexpr
+        void Advance(u64 n) noexcept
+        {
+            *this = Implementation::Advanced(*this, n, sAdvance);
+        }
+
+        // Note(3011): Returns this generator and the k - 1 generators after
+        // it in steps of Jump, and advances this one by k jumps.
+        [[nodiscard]]
+        std::vector<Xoshiro128StarStar> Split(SizeType k)
+        {
+            return Implementation::Split(*this, sJump, k);
+        }
+
+        [[nodiscard]] constexpr
+        const Array<u32, 4>& State() const noexcept
+        {
+            return mState;
+        }
     private:
         Array<u32, 4> mState;
 
@@ -112,6 +117,15 @@ namespace Math
             u32(0x0B6F099F),
             u32(0xCCF5A0EF),
             u32(0x1C580662));
+
+        // Note(3011): Characteristic polynomial of the state transition
+        // without its leading term x^128.
+        static constexpr Array<u32, 4> sCharacteristic = Array<u32, 4>(
+            u32(0xDE18FC01),
+            u32(0x1B489DB6),
+            u32(0x006254B1),
+            u32(0x00FC65A2));
+        static constexpr Implementation::JumpPowers<u32> sAdvance = Implementation::MakeJumpPowers(sCharacteristic);
     };
 
     class Xoshiro256StarStar final
@@ -157,48 +171,40 @@ namespace Math
         [[nodiscard]] constexpr
         Xoshiro256StarStar Jump() noexcept
         {
-            Xoshiro256StarStar result = *this;
-            Xoshiro256StarStar temp = *this;
-            mState = {};
-            for (SizeType i = 0; i < sJump.Size; ++i)
-            {
-                for (SizeType b = 0; b < SizeType(64); ++b)
-                {
-                    if (ToUnderlying(sJump[i] & (u64(1) << b)))
-                    {
-                        mState[0] ^= temp.mState[0];
-                        mState[1] ^= temp.mState[1];
-                        mState[2] ^= temp.mState[2];
-                        mState[3] ^= temp.mState[3];
-                    }
-                    static_cast<void>(temp());
-                }
-            }
+            const Xoshiro256StarStar result = *this;
+            *this = Implementation::Jumped(*this, sJump);
             return result;
         }
 
         [[nodiscard]] constexpr
         Xoshiro256StarStar LongJump() noexcept
         {
-            Xoshiro256StarStar result = *this;
-            Xoshiro256StarStar temp = *this;
-            mState = {};
-            for (SizeType i = 0; i < sLongJump.Size; ++i)
-            {
-                for (SizeType b = 0; b < SizeType(64); ++b)
-                {
-                    if (ToUnderlying(sLongJump[i] & (u64(1) << b)))
-                    {
-                        mState[0] ^= temp.mState[0];
-                        mState[1] ^= temp.mState[1];
-                        mState[2] ^= temp.mState[2];
-                        mState[3] ^= temp.mState[3];
-                    }
-                    static_cast<void>(temp());
-                }
-            }
+            const Xoshiro256StarStar result = *this;
+            *this = Implementation::Jumped(*this, sLongJump);
             return result;
         }
+
+        // Note(3011): Same as discarding n values, in at most 64 jumps
+        // whatever the size of n.
+        constexpr
+        void Advance(u64 n) noexcept
+        {
+            *this = Implementation::Advanced(*this, n, sAdvance);
+        }
+
+        // Note(3011): Returns this generator and the k - 1 generators after
+        // it in steps of Jump, and advances this one by k jumps.
+        [[nodiscard]]
+        std::vector<Xoshiro256StarStar> Split(SizeType k)
+        {
+            return Implementation::Split(*this, sJump, k);
+        }
+
+        [[nodiscard]] constexpr
+        const Array<u64, 4>& State() const noexcept
+        {
+            return mState;
+        }
     private:
         Array<u64, 4> mState;
 
@@ -212,6 +218,15 @@ namespace Math
             u64(0xC5004E441C522FB3),
             u64(0x77710069854EE241),
             u64(0x39109BB02ACBE635));
+
+        // Note(3011): Characteristic polynomial of the state transition
+        // without its leading term x^256.
+        static constexpr Array<u64, 4> sCharacteristic = Array<u64, 4>(
+            u64(0x9D116F2BB0F0F001),
+            u64(0x0280002BCEFD1A5E),
+            u64(0x04B4EDCF26259F85),
+            u64(0x0003C03C3F3ECB19));
+        static constexpr Implementation::JumpPowers<u64> sAdvance = Implementation::MakeJumpPowers(sCharacteristic);
     };
 }
 
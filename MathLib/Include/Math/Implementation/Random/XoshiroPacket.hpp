@@ -0,0 +1,120 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_XOSHIRO_PACKET_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_XOSHIRO_PACKET_HPP
+
+#include "Xoshiro.hpp"
+#include "../Packet.hpp"
+
+// Note(3011):
+// Runs N xoshiro** streams side by side. The state is stored per state
+// word with one lane per stream, so every step is the same arithmetic on
+// N lanes, which the compiler turns into SIMD code. Lane i starts where a
+// scalar generator with the same seed is after i calls to Jump, so lane 0
+// reproduces the scalar generator and the streams never overlap for 2^128
+// (xoshiro256**) or 2^64 (xoshiro128**) values.
+
+namespace Math
+{
+    namespace Implementation
+    {
+        template <typename Generator, SizeType N>
+        class XoshiroStarStarPacket final
+        {
+        public:
+            using ScalarType = typename Generator::ValueType;
+            using ValueType = Packet<ScalarType, N>;
+            static constexpr SizeType Size = N;
+
+            [[nodiscard]] constexpr
+            XoshiroStarStarPacket(ScalarType seed = 0) noexcept
+            {
+                Generator generator(seed);
+                for (SizeType i = 0; i < N; ++i)
+                {
+                    SetLane(i, generator.Jump());
+                }
+            }
+
+            [[nodiscard]] constexpr
+            ValueType operator() () noexcept
+            {
+                ValueType result;
+                for (SizeType i = 0; i < N; ++i)
+                {
+                    result[i] = RotateLeft(mState[1][i] * 5, 7u) * 9;
+                    const ScalarType t = mState[1][i] << sShift;
+
+                    mState[2][i] ^= mState[0][i];
+                    mState[3][i] ^= mState[1][i];
+                    mState[1][i] ^= mState[2][i];
+                    mState[0][i] ^= mState[3][i];
+
+                    mState[2][i] ^= t;
+
+                    mState[3][i] = RotateLeft(mState[3][i], sRotation);
+                }
+                return result;
+            }
+
+            // Note(3011): Same semantics as the scalar generators. Every lane
+            // is advanced by N jumps, so the lanes of the returned and the
+            // advanced generator are all distinct streams.
+            [[nodiscard]] constexpr
+            XoshiroStarStarPacket Jump() noexcept
+            {
+                XoshiroStarStarPacket result = *this;
+                for (SizeType i = 0; i < N; ++i)
+                {
+                    Generator lane = Lane(i);
+                    for (SizeType j = 0; j < N; ++j)
+                    {
+                        static_cast<void>(lane.Jump());
+                    }
+                    SetLane(i, lane);
+                }
+                return result;
+            }
+
+            [[nodiscard]] constexpr
+            XoshiroStarStarPacket LongJump() noexcept
+            {
+                XoshiroStarStarPacket result = *this;
+                for (SizeType i = 0; i < N; ++i)
+                {
+                    Generator lane = Lane(i);
+                    static_cast<void>(lane.LongJump());
+                    SetLane(i, lane);
+                }
+                return result;
+            }
+
+            // Note(3011): The scalar generator that continues lane i.
+            [[nodiscard]] constexpr
+            Generator Lane(SizeType lane) const noexcept
+            {
+                return Generator(Array<ScalarType, 4>(mState[0][lane], mState[1][lane], mState[2][lane], mState[3][lane]));
+            }
+        private:
+            constexpr
+            void SetLane(SizeType lane, const Generator& generator) noexcept
+            {
+                for (SizeType k = 0; k < 4; ++k)
+                {
+                    mState[k][lane] = generator.State()[k];
+                }
+            }
+
+            static constexpr ScalarType sShift = (sizeof(ScalarType) == 4) ? 9 : 17;
+            static constexpr ScalarType sRotation = (sizeof(ScalarType) == 4) ? 11 : 45;
+
+            Array<Packet<ScalarType, N>, 4> mState;
+        };
+    }
+
+    using Xoshiro128StarStarX4 = Implementation::XoshiroStarStarPacket<Xoshiro128StarStar, 4>;
+    using Xoshiro128StarStarX8 = Implementation::XoshiroStarStarPacket<Xoshiro128StarStar, 8>;
+
+    using Xoshiro256StarStarX4 = Implementation::XoshiroStarStarPacket<Xoshiro256StarStar, 4>;
+    using Xoshiro256StarStarX8 = Implementation::XoshiroStarStarPacket<Xoshiro256StarStar, 8>;
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_XOSHIRO_PACKET_HPP
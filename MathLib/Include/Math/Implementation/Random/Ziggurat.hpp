@@ -0,0 +1,418 @@
+#ifndef MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
+#define MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
+
+#include "../Base/Concepts.hpp"
+#include "../Base/Array.hpp"
+#include "../Functions/BasicFunctions.hpp"
+#include "../Functions/Log.hpp"
+#include "../Packet.hpp"
+#include "Utils.hpp"
+
+// Note(3011):
+// The Ziggurat method of Marsaglia and Tsang. The area under a decreasing
+// density is covered by N layers of equal area, a random layer is picked
+// and a point inside it is accepted right away when it lies below the layer
+// above, which happens for about 99% of the draws. Only the rest evaluates
+// the density or samples the tail beyond the widest layer.
+//
+// The layer, the sign and the value are taken from different bits of the
+// random number, which avoids the correlation between the layer and the
+// value of the original paper. The tables are computed at compile time for
+// f32 and f64. std::exp and std::log are not constexpr on every compiler,
+// so the table construction has its own series implementations.
+
+namespace Math::Implementation::Ziggurat
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Compile time functions
+    //////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] constexpr
+    f64 Exp(f64 val) noexcept
+    {
+        constexpr f64 ln2 = 0.693147180559945309417;
+
+        i64 exponent = Cast<i64>(val / ln2 + ((val < 0) ? f64(-0.5) : f64(0.5)));
+        const f64 reduced = val - Cast<f64>(exponent) * ln2;
+
+        f64 term = 1;
+        f64 result = 1;
+        for (SizeType i = 1; i < 24; ++i)
+        {
+            term *= reduced / Cast<f64>(i);
+            result += term;
+        }
+
+        for (; exponent > 0; --exponent)
+        {
+            result *= 2;
+        }
+        for (; exponent < 0; ++exponent)
+        {
+            result /= 2;
+        }
+        return result;
+    }
+
+    // Note(3011): log(m * 2^e) = e log(2) + 2 atanh((m - 1) / (m + 1)).
+    [[nodiscard]] constexpr
+    f64 Log(f64 val) noexcept
+    {
+        constexpr f64 ln2 = 0.693147180559945309417;
+
+        f64 exponent = 0;
+        for (; val >= 2; val /= 2)
+        {
+            exponent += 1;
+        }
+        for (; val < 1; val *= 2)
+        {
+            exponent -= 1;
+        }
+
+        const f64 s = (val - 1) / (val + 1);
+        const f64 s2 = s * s;
+
+        f64 power = s;
+        f64 result = 0;
+        for (SizeType i = 1; i < 48; i += 2)
+        {
+            result += power / Cast<f64>(i);
+            power *= s2;
+        }
+        return exponent * ln2 + 2 * result;
+    }
+
+    [[nodiscard]] constexpr
+    f64 Sqrt(f64 val) noexcept
+    {
+        f64 result = (val > 1) ? val : f64(1);
+        for (SizeType i = 0; i < 64; ++i)
+        {
+            result = (result + val / result) / 2;
+        }
+        return result;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Shapes
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): R is the start of the tail and V the area of a layer, for
+    // the unnormalized densities. The values are the ones of Marsaglia and
+    // Tsang and make the top layer end exactly at x = 0. The Table functions
+    // build the tables, the others are used while sampling.
+
+    struct Normal
+    {
+        static constexpr SizeType Layers = 128;
+        static constexpr bool Symmetric = true;
+        static constexpr f64 R = 3.442619855899;
+        static constexpr f64 V = 9.91256303526217e-3;
+
+        [[nodiscard]] static constexpr
+        f64 TableDensity(f64 x) noexcept
+        {
+            return Ziggurat::Exp(-x * x / 2);
+        }
+
+        [[nodiscard]] static constexpr
+        f64 TableInverse(f64 y) noexcept
+        {
+            return Ziggurat::Sqrt(-2 * Ziggurat::Log(y));
+        }
+
+        template <Concept::StrongFloatType Float>
+        [[nodiscard]] static constexpr
+        Float Density(Float x) noexcept
+        {
+            return Math::Exp(-x * x / 2);
+        }
+
+        // Note(3011): Marsaglia's tail method, x is exponential with rate R
+        // and accepted with probability exp(-x^2 / 2).
+        template <Concept::StrongFloatType Float, typename Source>
+        [[nodiscard]] static constexpr
+        Float Tail(Source& next) noexcept
+        {
+            const Float r = Cast<Float>(R);
+            Float x;
+            Float y;
+            do
+            {
+                x = -Math::Log(next.Unit()) / r;
+                y = -Math::Log(next.Unit());
+            }
+            while (y + y < x * x);
+            return r + x;
+        }
+    };
+
+    struct Exponential
+    {
+        static constexpr SizeType Layers = 256;
+        static constexpr bool Symmetric = false;
+        static constexpr f64 R = 7.69711747013104972;
+        static constexpr f64 V = 3.949659822581572e-3;
+
+        [[nodiscard]] static constexpr
+        f64 TableDensity(f64 x) noexcept
+        {
+            return Ziggurat::Exp(-x);
+        }
+
+        [[nodiscard]] static constexpr
+        f64 TableInverse(f64 y) noexcept
+        {
+            return -Ziggurat::Log(y);
+        }
+
+        template <Concept::StrongFloatType Float>
+        [[nodiscard]] static constexpr
+        Float Density(Float x) noexcept
+        {
+            return Math::Exp(-x);
+        }
+
+        // Note(3011): The distribution is memoryless, the tail is R plus
+        // another sample.
+        template <Concept::StrongFloatType Float, typename Source>
+        [[nodiscard]] static constexpr
+        Float Tail(Source& next) noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Tables
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::StrongFloatType Float>
+    struct Bits
+    {
+        using Uint = Math::UnsignedIntegerSelector<sizeof(Float)>;
+        using Int = Math::SignedIntegerSelector<sizeof(Float)>;
+
+        static constexpr SizeType Mantissa = (sizeof(Float) == 4) ? 24 : 53;
+        static constexpr SizeType Shift = sizeof(Float) * 8 - Mantissa;
+    };
+
+    // Note(3011): Layer i spans [0, x_i) horizontally and the densities
+    // f(x_i) to f(x_i+1) vertically, layer 0 also covers the tail.
+    // A value u of the mantissa bits is accepted in layer i when it is
+    // below Accept[i], the sample is then u * Width[i].
+    template <Concept::StrongFloatType Float, typename Shape>
+    struct Table
+    {
+        Array<typename Bits<Float>::Uint, Shape::Layers> Accept;
+        Array<Float, Shape::Layers> Width;
+        Array<Float, Shape::Layers + 1> Height;
+    };
+
+    template <Concept::StrongFloatType Float, typename Shape>
+    [[nodiscard]] constexpr
+    Table<Float, Shape> MakeTable() noexcept
+    {
+        constexpr SizeType N = Shape::Layers;
+
+        Array<f64, N + 1> x;
+        x[0] = Shape::V / Shape::TableDensity(Shape::R);
+        x[1] = Shape::R;
+        for (SizeType i = 1; i + 1 < N; ++i)
+        {
+            const f64 y = Shape::TableDensity(x[i]) + Shape::V / x[i];
+            x[i + 1] = Shape::TableInverse((y < 1) ? y : f64(1));
+        }
+        x[N] = 0;
+
+        f64 scale = 1;
+        for (SizeType i = 0; i < Bits<Float>::Mantissa; ++i)
+        {
+            scale *= 2;
+        }
+
+        Table<Float, Shape> result;
+        for (SizeType i = 0; i < N; ++i)
+        {
+            result.Accept[i] = Cast<typename Bits<Float>::Uint>(x[i + 1] / x[i] * scale);
+            result.Width[i] = Cast<Float>(x[i] / scale);
+            result.Height[i] = Cast<Float>(Shape::TableDensity(x[i]));
+        }
+        result.Height[N] = Float(1);
+        return result;
+    }
+
+    template <Concept::StrongFloatType Float, typename Shape>
+    inline constexpr Table<Float, Shape> Tables = MakeTable<Float, Shape>();
+
+    //////////////////////////////////////////////////////////////////////////
+    // Sampling
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Adapts a function returning random bits to the interface
+    // used by the slow paths.
+    template <Concept::StrongFloatType Float, typename Function>
+    class Source
+    {
+    public:
+        using Uint = typename Bits<Float>::Uint;
+        using Int = typename Bits<Float>::Int;
+
+        [[nodiscard]] constexpr explicit
+        Source(Function function) noexcept
+            : mFunction(function)
+        {}
+
+        [[nodiscard]] constexpr
+        Uint operator()() noexcept
+        {
+            return mFunction();
+        }
+
+        // Note(3011): Uniform in (0, 1], so it can be passed to Log.
+        [[nodiscard]] constexpr
+        Float Unit() noexcept
+        {
+            return Float(1) - Cast<Float>(Cast<Int>(mFunction() >> Bits<Float>::Shift)) * Epsilon();
+        }
+
+        [[nodiscard]] static constexpr
+        Float Epsilon() noexcept
+        {
+            return (sizeof(Float) == 4) ? Float(0x1.0p-24f) : Float(0x1.0p-53);
+        }
+    private:
+        Function mFunction;
+    };
+
+    // Note(3011): Applies the sign bit of symmetric shapes to the mantissa
+    // bits u. A branch on the sign would be mispredicted every other draw.
+    template <typename Shape, Concept::StrongIntegerType Uint>
+    [[nodiscard]] constexpr
+    auto Signed(Uint bits, Uint u) noexcept
+    {
+        using Int = Math::SignedIntegerSelector<sizeof(Uint)>;
+
+        if constexpr (Shape::Symmetric)
+        {
+            const Int negative = -Cast<Int>((bits / Cast<Uint>(Shape::Layers)) & 1);
+            return (Cast<Int>(u) ^ negative) - negative;
+        }
+        else
+        {
+            return Cast<Int>(u);
+        }
+    }
+
+    // Note(3011): The first iteration is the fast path, one table lookup
+    // and a compare.
+    template <Concept::StrongFloatType Float, typename Shape, typename SourceType>
+    [[nodiscard]] constexpr
+    Float Sample(typename Bits<Float>::Uint bits, SourceType& next) noexcept
+    {
+        using Uint = typename Bits<Float>::Uint;
+        using Int = typename Bits<Float>::Int;
+
+        constexpr const Table<Float, Shape>& table = Tables<Float, Shape>;
+
+        while (true)
+        {
+            const SizeType layer = Cast<SizeType>(bits & Cast<Uint>(Shape::Layers - 1));
+            const Uint u = bits >> Bits<Float>::Shift;
+
+            Float x = Cast<Float>(Cast<Int>(u)) * table.Width[layer];
+            if (u >= table.Accept[layer])
+            {
+                if (layer == 0)
+                {
+                    x = Shape::template Tail<Float>(next);
+                }
+                else
+                {
+                    const Float y = table.Height[layer] + (Float(1) - next.Unit()) * (table.Height[layer + 1] - table.Height[layer]);
+                    if (y >= Shape::Density(x))
+                    {
+                        bits = next();
+                        continue;
+                    }
+                }
+            }
+
+            if constexpr (Shape::Symmetric)
+            {
+                return ToUnderlying(bits & Cast<Uint>(Shape::Layers)) ? -x : x;
+            }
+            else
+            {
+                return x;
+            }
+        }
+    }
+
+    template <Concept::StrongFloatType Float, typename Shape, Concept::RandomNumberGenerator RNG>
+    [[nodiscard]] constexpr
+    Float Sample(RNG& rng) noexcept
+    {
+        using Uint = typename Bits<Float>::Uint;
+
+        constexpr const Table<Float, Shape>& table = Tables<Float, Shape>;
+
+        const Uint bits = GetRandomBits<Uint>(rng);
+        const SizeType layer = Cast<SizeType>(bits & Cast<Uint>(Shape::Layers - 1));
+        const Uint u = bits >> Bits<Float>::Shift;
+        if (u < table.Accept[layer]) [[likely]]
+        {
+            return Cast<Float>(Signed<Shape>(bits, u)) * table.Width[layer];
+        }
+
+        auto function = [&rng]() { return GetRandomBits<Uint>(rng); };
+        Source<Float, decltype(function)> next(function);
+        return Sample<Float, Shape>(bits, next);
+    }
+
+    // Note(3011): Runs the fast path on all lanes and leaves only the lanes
+    // that miss it to the scalar slow path. A lane on the slow path draws
+    // whole packets and uses its own lane of them, so the lanes follow the
+    // same distribution as the scalar version but don't reproduce the
+    // scalar generator of the lane.
+    template <Concept::StrongFloatType Float, typename Shape, Concept::PacketRandomNumberGenerator RNG>
+    [[nodiscard]] constexpr
+    Packet<Float, RNG::ValueType::Size> Sample(RNG& rng) noexcept
+    {
+        using Uint = typename Bits<Float>::Uint;
+
+        constexpr SizeType N = RNG::ValueType::Size;
+        constexpr const Table<Float, Shape>& table = Tables<Float, Shape>;
+
+        const Packet<Uint, N> bits = GetRandomBits<Uint>(rng);
+
+        Packet<Float, N> result;
+        Array<bool, N> slow;
+        for (SizeType i = 0; i < N; ++i)
+        {
+            const SizeType layer = Cast<SizeType>(bits[i] & Cast<Uint>(Shape::Layers - 1));
+            const Uint u = bits[i] >> Bits<Float>::Shift;
+
+            result[i] = Cast<Float>(Signed<Shape>(bits[i], u)) * table.Width[layer];
+            slow[i] = (u >= table.Accept[layer]);
+        }
+
+        for (SizeType i = 0; i < N; ++i)
+        {
+            if (slow[i])
+            {
+                auto lane = [&rng, i]() { return GetRandomBits<Uint>(rng)[i]; };
+                Source<Float, decltype(lane)> next(lane);
+                result[i] = Sample<Float, Shape>(bits[i], next);
+            }
+        }
+        return result;
+    }
+
+    template <Concept::StrongFloatType Float, typename SourceType>
+    constexpr
+    Float Exponential::Tail(SourceType& next) noexcept
+    {
+        return Cast<Float>(R) + Sample<Float, Exponential>(next(), next);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_RANDOM_ZIGGURAT_HPP
@@ -0,0 +1,464 @@
+#ifndef MATHLIB_IMPLEMENTATION_SOA_ARRAY_HPP
+#define MATHLIB_IMPLEMENTATION_SOA_ARRAY_HPP
+
+#include "Base/Concepts.hpp"
+#include "Functions/BasicFunctions.hpp"
+
+#include <cassert>
+#include <new>
+#include <span>
+#include <type_traits>
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Element proxies
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Implementation
+    {
+        // Note(3011): The proxies expose the components under the same names
+        // as the vector types, so arr[i].x = 1 works as expected.
+        template <typename Scalar, SizeType Dimension>
+        struct SoAComponents;
+
+        template <typename Scalar>
+        struct SoAComponents<Scalar, 2>
+        {
+            Scalar& x;
+            Scalar& y;
+
+            constexpr SoAComponents(Scalar* const* channels, std::size_t idx) noexcept
+                : x(channels[0][idx]), y(channels[1][idx])
+            {}
+        };
+
+        template <typename Scalar>
+        struct SoAComponents<Scalar, 3>
+        {
+            Scalar& x;
+            Scalar& y;
+            Scalar& z;
+
+            constexpr SoAComponents(Scalar* const* channels, std::size_t idx) noexcept
+                : x(channels[0][idx]), y(channels[1][idx]), z(channels[2][idx])
+            {}
+        };
+
+        template <typename Scalar>
+        struct SoAComponents<Scalar, 4>
+        {
+            Scalar& x;
+            Scalar& y;
+            Scalar& z;
+            Scalar& w;
+
+            constexpr SoAComponents(Scalar* const* channels, std::size_t idx) noexcept
+                : x(channels[0][idx]), y(channels[1][idx]), z(channels[2][idx]), w(channels[3][idx])
+            {}
+        };
+    }
+
+    template <Concept::SoAElement Vec, bool IsConst>
+    class SoAReference final
+        : public Implementation::SoAComponents<std::conditional_t<IsConst, const typename Vec::ScalarType, typename Vec::ScalarType>, Vec::Dimension>
+    {
+    public:
+        using ValueType = Vec;
+        using ScalarType = typename Vec::ScalarType;
+        static constexpr SizeType Dimension = Vec::Dimension;
+    private:
+        using QualifiedScalar = std::conditional_t<IsConst, const ScalarType, ScalarType>;
+        using Base = Implementation::SoAComponents<QualifiedScalar, Vec::Dimension>;
+    public:
+
+        [[nodiscard]] constexpr
+        SoAReference(QualifiedScalar* const* channels, SizeType idx) noexcept
+            : Base(channels, ToUnderlying(idx))
+        {}
+
+        constexpr SoAReference(const SoAReference&) noexcept = default;
+
+        [[nodiscard]] constexpr
+        Vec Get() const noexcept
+        {
+            Vec result;
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                result[i] = (*this)[i];
+            }
+            return result;
+        }
+
+        [[nodiscard]] constexpr
+        operator Vec() const noexcept
+        {
+            return Get();
+        }
+
+        [[nodiscard]] constexpr
+        QualifiedScalar& operator[] (SizeType idx) const noexcept
+        {
+            if constexpr (Dimension > 3) { if (idx == 3) { return this->w; } }
+            if constexpr (Dimension > 2) { if (idx == 2) { return this->z; } }
+            return (idx == 0) ? this->x : this->y;
+        }
+
+        // Note(3011): Assignments write through to the referenced element,
+        // the proxy itself is never rebound.
+        [[maybe_unused]] constexpr
+        const SoAReference& operator= (const Vec& u) const noexcept
+            requires (!IsConst)
+        {
+            for (SizeType i = 0; i < Dimension; ++i)
+            {
+                (*this)[i] = u[i];
+            }
+            return *this;
+        }
+
+        [[maybe_unused]] constexpr
+        const SoAReference& operator= (const SoAReference& other) const noexcept
+            requires (!IsConst)
+        {
+            return *this = other.Get();
+        }
+
+        [[maybe_unused]] constexpr const SoAReference& operator+= (const Vec& u) const noexcept requires (!IsConst) { for (SizeType i = 0; i < Dimension; ++i) { (*this)[i] += u[i]; } return *this; }
+        [[maybe_unused]] constexpr const SoAReference& operator-= (const Vec& u) const noexcept requires (!IsConst) { for (SizeType i = 0; i < Dimension; ++i) { (*this)[i] -= u[i]; } return *this; }
+        [[maybe_unused]] constexpr const SoAReference& operator*= (ScalarType s) const noexcept requires (!IsConst) { for (SizeType i = 0; i < Dimension; ++i) { (*this)[i] *= s;    } return *this; }
+        [[maybe_unused]] constexpr const SoAReference& operator/= (ScalarType s) const noexcept requires (!IsConst) { for (SizeType i = 0; i < Dimension; ++i) { (*this)[i] /= s;    } return *this; }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // SoAArray
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Stores every component of the elements in its own aligned
+    // channel, i.e. xxxx...yyyy...zzzz... instead of xyzxyzxyz... All the
+    // channels share a single allocation, each starting on a cache line.
+    template <Concept::SoAElement Vec>
+    class SoAArray final
+    {
+    public:
+        using ValueType = Vec;
+        using ScalarType = typename Vec::ScalarType;
+        using Reference = SoAReference<Vec, false>;
+        using ConstReference = SoAReference<Vec, true>;
+        static constexpr SizeType Dimension = Vec::Dimension;
+        static constexpr std::size_t Alignment = 64;
+    private:
+        static constexpr std::size_t ChannelPadding = Alignment / sizeof(ScalarType);
+    public:
+
+        [[nodiscard]]
+        SoAArray() noexcept = default;
+
+        [[nodiscard]] explicit
+        SoAArray(SizeType size, const Vec& value = Vec())
+        {
+            Allocate(size);
+            Fill(value);
+        }
+
+        [[nodiscard]] explicit
+        SoAArray(std::span<const Vec> values)
+        {
+            Allocate(SizeType(values.size()));
+            for (SizeType i = 0; i < mSize; ++i)
+            {
+                Set(i, values[ToUnderlying(i)]);
+            }
+        }
+
+        [[nodiscard]]
+        SoAArray(const SoAArray& other)
+        {
+            Allocate(other.mSize);
+            CopyFrom(other, mSize);
+        }
+
+        [[nodiscard]]
+        SoAArray(SoAArray&& other) noexcept
+            : mData(other.mData), mSize(other.mSize), mStride(other.mStride)
+        {
+            other.mData = nullptr;
+            other.mSize = 0;
+            other.mStride = 0;
+        }
+
+        ~SoAArray()
+        {
+            Release();
+        }
+
+        SoAArray& operator= (const SoAArray& other)
+        {
+            if (this != &other)
+            {
+                SoAArray copy(other);
+                Swap(copy);
+            }
+            return *this;
+        }
+
+        SoAArray& operator= (SoAArray&& other) noexcept
+        {
+            SoAArray moved(static_cast<SoAArray&&>(other));
+            Swap(moved);
+            return *this;
+        }
+
+        constexpr
+        void Swap(SoAArray& other) noexcept
+        {
+            Math::Swap(mData, other.mData);
+            Math::Swap(mSize, other.mSize);
+            Math::Swap(mStride, other.mStride);
+        }
+
+        [[nodiscard]] constexpr SizeType Size()  const noexcept { return mSize; }
+        [[nodiscard]] constexpr bool     Empty() const noexcept { return mSize == 0; }
+
+        // Note(3011): Keeps the first Min(size, Size()) elements, the new
+        // elements are set to value.
+        void Resize(SizeType size, const Vec& value = Vec())
+        {
+            SoAArray resized;
+            resized.Allocate(size);
+            resized.CopyFrom(*this, Math::Min(size, mSize));
+            for (SizeType i = mSize; i < size; ++i)
+            {
+                resized.Set(i, value);
+            }
+            Swap(resized);
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Element access
+        //////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] Reference operator[] (SizeType idx) noexcept
+        {
+            ScalarType* channels[ToUnderlying(Dimension)];
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                channels[ToUnderlying(c)] = ChannelData(c);
+            }
+            return Reference(channels, idx);
+        }
+
+        [[nodiscard]] ConstReference operator[] (SizeType idx) const noexcept
+        {
+            const ScalarType* channels[ToUnderlying(Dimension)];
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                channels[ToUnderlying(c)] = ChannelData(c);
+            }
+            return ConstReference(channels, idx);
+        }
+
+        [[nodiscard]]
+        Vec Get(SizeType idx) const noexcept
+        {
+            Vec result;
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                result[c] = ChannelData(c)[ToUnderlying(idx)];
+            }
+            return result;
+        }
+
+        void Set(SizeType idx, const Vec& value) noexcept
+        {
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                ChannelData(c)[ToUnderlying(idx)] = value[c];
+            }
+        }
+
+        [[nodiscard]] std::span<      ScalarType> Channel(SizeType c)       noexcept { return { ChannelData(c), ToUnderlying(mSize) }; }
+        [[nodiscard]] std::span<const ScalarType> Channel(SizeType c) const noexcept { return { ChannelData(c), ToUnderlying(mSize) }; }
+
+        void Store(std::span<Vec> output) const noexcept
+        {
+            SizeType count = Math::Min(mSize, SizeType(output.size()));
+            for (SizeType i = 0; i < count; ++i)
+            {
+                output[ToUnderlying(i)] = Get(i);
+            }
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Bulk operations
+        //////////////////////////////////////////////////////////////////////////
+
+        // Note(3011): All bulk operations walk one channel at a time, so the
+        // inner loops are plain contiguous streams the compiler vectorizes.
+        // Binary operations require both arrays to have the same size.
+
+        void Fill(const Vec& value) noexcept
+        {
+            ForEachChannel([&](SizeType c, ScalarType* data)
+            {
+                const ScalarType v = value[c];
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] = v; }
+            });
+        }
+
+        [[maybe_unused]]
+        SoAArray& operator+= (const SoAArray& other) noexcept
+        {
+            assert(other.mSize == mSize);
+            ForEachChannel([&](SizeType c, ScalarType* data)
+            {
+                const ScalarType* src = other.ChannelData(c);
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] += src[i]; }
+            });
+            return *this;
+        }
+
+        [[maybe_unused]]
+        SoAArray& operator-= (const SoAArray& other) noexcept
+        {
+            assert(other.mSize == mSize);
+            ForEachChannel([&](SizeType c, ScalarType* data)
+            {
+                const ScalarType* src = other.ChannelData(c);
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] -= src[i]; }
+            });
+            return *this;
+        }
+
+        [[maybe_unused]]
+        SoAArray& operator*= (ScalarType scale) noexcept
+        {
+            ForEachChannel([&](SizeType, ScalarType* data)
+            {
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] *= scale; }
+            });
+            return *this;
+        }
+
+        [[maybe_unused]]
+        SoAArray& operator/= (ScalarType scale) noexcept
+        {
+            ForEachChannel([&](SizeType, ScalarType* data)
+            {
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] /= scale; }
+            });
+            return *this;
+        }
+
+        // Note(3011): this[i] += other[i] * scale
+        [[maybe_unused]]
+        SoAArray& MultiplyAdd(const SoAArray& other, ScalarType scale) noexcept
+        {
+            assert(other.mSize == mSize);
+            ForEachChannel([&](SizeType c, ScalarType* data)
+            {
+                const ScalarType* src = other.ChannelData(c);
+                for (std::size_t i = 0; i < ToUnderlying(mSize); ++i) { data[i] += src[i] * scale; }
+            });
+            return *this;
+        }
+
+        // Note(3011): Component-wise reductions, e.g. Min() of a point cloud
+        // is the minimum corner of its bounding box.
+        [[nodiscard]]
+        Vec Min() const noexcept
+        {
+            return Reduce([](ScalarType a, ScalarType b) { return (b < a) ? b : a; });
+        }
+
+        [[nodiscard]]
+        Vec Max() const noexcept
+        {
+            return Reduce([](ScalarType a, ScalarType b) { return (b > a) ? b : a; });
+        }
+
+        [[nodiscard]]
+        Vec Sum() const noexcept
+        {
+            return Reduce([](ScalarType a, ScalarType b) { return a + b; });
+        }
+    private:
+        static_assert(std::is_trivially_destructible_v<ScalarType>);
+
+        [[nodiscard]]       ScalarType* ChannelData(SizeType c)       noexcept { return mData + ToUnderlying(c * mStride); }
+        [[nodiscard]] const ScalarType* ChannelData(SizeType c) const noexcept { return mData + ToUnderlying(c * mStride); }
+
+        template <typename Func>
+        void ForEachChannel(Func func) noexcept
+        {
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                func(c, ChannelData(c));
+            }
+        }
+
+        template <typename Func>
+        [[nodiscard]]
+        Vec Reduce(Func func) const noexcept
+        {
+            Vec result;
+            if (mSize == 0)
+            {
+                return result;
+            }
+
+            for (SizeType c = 0; c < Dimension; ++c)
+            {
+                const ScalarType* data = ChannelData(c);
+                ScalarType value = data[0];
+                for (std::size_t i = 1; i < ToUnderlying(mSize); ++i) { value = func(value, data[i]); }
+                result[c] = value;
+            }
+            return result;
+        }
+
+        void Allocate(SizeType size)
+        {
+            mSize = size;
+            mStride = (size + ChannelPadding - 1) / ChannelPadding * ChannelPadding;
+            if (mStride == 0)
+            {
+                return;
+            }
+
+            std::size_t count = ToUnderlying(mStride * Dimension);
+            void* memory = ::operator new[](count * sizeof(ScalarType), std::align_val_t(Alignment));
+            mData = static_cast<ScalarType*>(memory);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ::new (static_cast<void*>(mData + i)) ScalarType();
+            }
+        }
+
+        void Release() noexcept
+        {
+            if (mData)
+            {
+                ::operator delete[](static_cast<void*>(mData), std::align_val_t(Alignment));
+            }
+            mData = nullptr;
+            mSize = 0;
+            mStride = 0;
+        }
+
+        void CopyFrom(const SoAArray& other, SizeType count) noexcept
+        {
+            ForEachChannel([&](SizeType c, ScalarType* data)
+            {
+                const ScalarType* src = other.ChannelData(c);
+                for (std::size_t i = 0; i < ToUnderlying(count); ++i) { data[i] = src[i]; }
+            });
+        }
+
+        ScalarType* mData = nullptr;
+        SizeType mSize = 0;
+        SizeType mStride = 0;
+    };
+}
+
+#endif //MATHLIB_IMPLEMENTATION_SOA_ARRAY_HPP
@@ -0,0 +1,366 @@
+#ifndef MATHLIB_IMPLEMENTATION_TRANSFORM_BATCH_HPP
+#define MATHLIB_IMPLEMENTATION_TRANSFORM_BATCH_HPP
+
+#include "Base/Concepts.hpp"
+#include "Base/Parallel.hpp"
+#include "Base/Simd.hpp"
+#include "Point.hpp"
+#include "SoAArray.hpp"
+#include "Transform.hpp"
+#include "TransformOperators.hpp"
+#include "TransformUtilities.hpp"
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace Math
+{
+    namespace Implementation
+    {
+        template <Concept::BasicTransform Transform>
+        [[nodiscard]] consteval
+        bool IsAffine() noexcept
+        {
+            for (SizeType i = 0; i < Transform::Dimension; ++i)
+            {
+                if (Transform::BottomRow[i] != Cast<typename Transform::ScalarType>(0))
+                {
+                    return false;
+                }
+            }
+            return Transform::BottomRow[Transform::Dimension] == Cast<typename Transform::ScalarType>(1);
+        }
+
+        template <Concept::Transform Transform>
+        using TransformPoint = std::conditional_t<Transform::Dimension == 2,
+                                                  Point2T<typename Transform::ScalarType>,
+                                                  Point3T<typename Transform::ScalarType>>;
+
+        template <Concept::Transform Transform>
+        using TransformVector = typename Transform::VectorType;
+
+        // Note(3011): Outputs larger than this many bytes would evict the
+        // whole cache anyway, so they are written with non-temporal stores.
+        inline constexpr std::size_t StreamingThreshold = std::size_t(1) << 22;
+
+        // Note(3011): Smallest number of elements a thread is handed with
+        // Execution::Parallel, below that spawning threads does not pay off.
+        inline constexpr std::size_t ParallelRange = std::size_t(1) << 15;
+
+        //////////////////////////////////////////////////////////////////////////
+        // AoS kernels
+        //////////////////////////////////////////////////////////////////////////
+
+        template <Concept::Transform Transform>
+        inline constexpr bool IsBatchAccelerated = []()
+        {
+            if constexpr (Transform::Dimension == 3 && IsAffine<Transform>())
+            {
+                return Simd::Register4<Math::UnderlyingType<typename Transform::ScalarType>>::Enabled;
+            }
+            return false;
+        }();
+
+        // Note(3011): The columns of the transform stay in registers, every
+        // element is x * c0 + y * c1 + z * c2 (+ c3 for points).
+        template <bool IsPoint, Concept::Transform Transform, typename Elem>
+        void TransformRangeSimd(const Transform& t, const Elem* input, Elem* output, std::size_t count, bool stream) noexcept
+        {
+            using Scalar = Math::UnderlyingType<typename Transform::ScalarType>;
+            using Reg = Simd::Register4<Scalar>;
+            using RegType = typename Reg::Type;
+
+            Scalar columns[4][4] = {};
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                for (std::size_t j = 0; j < 4; ++j)
+                {
+                    columns[j][i] = ToUnderlying(t[i][j]);
+                }
+            }
+
+            const RegType c0 = Reg::Load4(columns[0]);
+            const RegType c1 = Reg::Load4(columns[1]);
+            const RegType c2 = Reg::Load4(columns[2]);
+            const RegType c3 = Reg::Load4(columns[3]);
+
+            const Scalar* in = reinterpret_cast<const Scalar*>(input);
+            Scalar* out = reinterpret_cast<Scalar*>(output);
+
+            auto apply = [&](const Scalar* p)
+            {
+                RegType r = IsPoint ? Reg::MulAdd(Reg::Broadcast(p[0]), c0, c3)
+                                    : Reg::Mul(Reg::Broadcast(p[0]), c0);
+                r = Reg::MulAdd(Reg::Broadcast(p[1]), c1, r);
+                return Reg::MulAdd(Reg::Broadcast(p[2]), c2, r);
+            };
+
+            std::size_t i = 0;
+            if (stream)
+            {
+                // Note(3011): Four elements fill exactly three registers, so
+                // elements are peeled until the output is aligned for them.
+                while (i < count && reinterpret_cast<std::uintptr_t>(out + 3 * i) % Reg::StreamAlignment != 0)
+                {
+                    Reg::Store3(out + 3 * i, apply(in + 3 * i));
+                    ++i;
+                }
+
+                alignas(64) Scalar block[16];
+                for (; i + 4 <= count; i += 4)
+                {
+                    Reg::Store4(block + 0, apply(in + 3 * i + 0));
+                    Reg::Store4(block + 3, apply(in + 3 * i + 3));
+                    Reg::Store4(block + 6, apply(in + 3 * i + 6));
+                    Reg::Store4(block + 9, apply(in + 3 * i + 9));
+                    Reg::Stream4(out + 3 * i + 0, Reg::Load4(block + 0));
+                    Reg::Stream4(out + 3 * i + 4, Reg::Load4(block + 4));
+                    Reg::Stream4(out + 3 * i + 8, Reg::Load4(block + 8));
+                }
+                Reg::StreamFence();
+            }
+
+            for (; i < count; ++i)
+            {
+                Reg::Store3(out + 3 * i, apply(in + 3 * i));
+            }
+        }
+
+        template <bool IsPoint, Concept::Transform Transform, typename Elem>
+        constexpr
+        void TransformRange(const Transform& t, const Elem* input, Elem* output, std::size_t count, bool stream) noexcept
+        {
+            if constexpr (IsBatchAccelerated<Transform>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    TransformRangeSimd<IsPoint>(t, input, output, count, stream);
+                    return;
+                }
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output[i] = t * input[i];
+            }
+        }
+
+        template <bool IsPoint, Execution Policy, Concept::Transform Transform, typename Elem>
+        void TransformBatch(const Transform& t, const Elem* input, Elem* output, std::size_t count)
+        {
+            const bool stream = count * sizeof(Elem) > StreamingThreshold;
+            ForRange<Policy>(count, ParallelRange, [&](std::size_t begin, std::size_t end)
+            {
+                TransformRange<IsPoint>(t, input + begin, output + begin, end - begin, stream);
+            });
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SoA kernels
+        //////////////////////////////////////////////////////////////////////////
+
+        // Note(3011): Works on blocks of the channels, so the inner loops are
+        // plain contiguous streams the compiler vectorizes. The block is
+        // buffered before it is written, which makes in-place calls safe.
+        template <bool IsPoint, Concept::Transform Transform, typename Elem>
+        void TransformChannels(const Transform& t, const SoAArray<Elem>& input, SoAArray<Elem>& output,
+                               std::size_t begin, std::size_t end) noexcept
+        {
+            using Scalar = typename Transform::ScalarType;
+            constexpr std::size_t D = ToUnderlying(Transform::Dimension);
+            constexpr std::size_t Block = 64;
+
+            Scalar m[D][D + 1];
+            for (std::size_t i = 0; i < D; ++i)
+            {
+                for (std::size_t j = 0; j <= D; ++j)
+                {
+                    m[i][j] = t[i][j];
+                }
+            }
+
+            const Scalar* src[D];
+            Scalar* dst[D];
+            for (std::size_t c = 0; c < D; ++c)
+            {
+                src[c] = input.Channel(c).data();
+                dst[c] = output.Channel(c).data();
+            }
+
+            Scalar result[D][Block];
+            for (std::size_t b = begin; b < end; b += Block)
+            {
+                const std::size_t n = std::min(Block, end - b);
+                for (std::size_t c = 0; c < D; ++c)
+                {
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        Scalar r = m[c][0] * src[0][b + i];
+                        for (std::size_t j = 1; j < D; ++j)
+                        {
+                            r += m[c][j] * src[j][b + i];
+                        }
+                        result[c][i] = IsPoint ? r + m[c][D] : r;
+                    }
+                }
+
+                if constexpr (IsPoint && !IsAffine<Transform>())
+                {
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        Scalar w = Transform::BottomRow[Transform::Dimension];
+                        for (std::size_t j = 0; j < D; ++j)
+                        {
+                            w += Transform::BottomRow[j] * src[j][b + i];
+                        }
+                        for (std::size_t c = 0; c < D; ++c)
+                        {
+                            result[c][i] /= w;
+                        }
+                    }
+                }
+
+                for (std::size_t c = 0; c < D; ++c)
+                {
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        dst[c][b + i] = result[c][i];
+                    }
+                }
+            }
+        }
+
+        template <bool IsPoint, Execution Policy, Concept::Transform Transform, typename Elem>
+        void TransformBatch(const Transform& t, const SoAArray<Elem>& input, SoAArray<Elem>& output)
+        {
+            if (output.Size() != input.Size())
+            {
+                output.Resize(input.Size());
+            }
+
+            ForRange<Policy>(ToUnderlying(input.Size()), ParallelRange, [&](std::size_t begin, std::size_t end)
+            {
+                TransformChannels<IsPoint>(t, input, output, begin, end);
+            });
+        }
+
+        template <Concept::Transform Transform>
+        [[nodiscard]] constexpr
+        Transform NormalTransform(const Transform& t) noexcept
+        {
+            return Transform(Transpose(Invert(LinearPart(t))));
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Batched transforms
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Same results as applying operator* to every element, but
+    // without the per-call overhead. Affine 3D transforms of floating point
+    // elements use SIMD kernels, outputs that exceed the cache are streamed
+    // past it. Execution::Parallel splits large batches across threads.
+    // The output span has to be at least as large as the input span.
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformPoints(const Transform& t,
+                         std::span<const Implementation::TransformPoint<Transform>> input,
+                         std::span<Implementation::TransformPoint<Transform>> output)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<true, Policy>(t, input.data(), output.data(), input.size());
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformPoints(const Transform& t, std::span<Implementation::TransformPoint<Transform>> points)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<true, Policy>(t, points.data(), points.data(), points.size());
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformVectors(const Transform& t,
+                          std::span<const Implementation::TransformVector<Transform>> input,
+                          std::span<Implementation::TransformVector<Transform>> output)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<false, Policy>(t, input.data(), output.data(), input.size());
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformVectors(const Transform& t, std::span<Implementation::TransformVector<Transform>> vectors)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<false, Policy>(t, vectors.data(), vectors.data(), vectors.size());
+    }
+
+    // Note(3011): Normals are transformed by the inverse transpose of the
+    // linear part, which is computed once per batch. They are not normalized.
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformNormals(const Transform& t,
+                          std::span<const Implementation::TransformVector<Transform>> input,
+                          std::span<Implementation::TransformVector<Transform>> output)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<false, Policy>(Implementation::NormalTransform(t), input.data(), output.data(), input.size());
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformNormals(const Transform& t, std::span<Implementation::TransformVector<Transform>> normals)
+    noexcept(Policy == Execution::Sequential)
+    {
+        Implementation::TransformBatch<false, Policy>(Implementation::NormalTransform(t), normals.data(), normals.data(), normals.size());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Batched transforms on SoA arrays
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): The output is resized to the size of the input, input and
+    // output may be the same array.
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformPoints(const Transform& t,
+                         const SoAArray<Implementation::TransformPoint<Transform>>& input,
+                         SoAArray<Implementation::TransformPoint<Transform>>& output)
+    {
+        Implementation::TransformBatch<true, Policy>(t, input, output);
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformPoints(const Transform& t, SoAArray<Implementation::TransformPoint<Transform>>& points)
+    {
+        Implementation::TransformBatch<true, Policy>(t, points, points);
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformVectors(const Transform& t,
+                          const SoAArray<Implementation::TransformVector<Transform>>& input,
+                          SoAArray<Implementation::TransformVector<Transform>>& output)
+    {
+        Implementation::TransformBatch<false, Policy>(t, input, output);
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformVectors(const Transform& t, SoAArray<Implementation::TransformVector<Transform>>& vectors)
+    {
+        Implementation::TransformBatch<false, Policy>(t, vectors, vectors);
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformNormals(const Transform& t,
+                          const SoAArray<Implementation::TransformVector<Transform>>& input,
+                          SoAArray<Implementation::TransformVector<Transform>>& output)
+    {
+        Implementation::TransformBatch<false, Policy>(Implementation::NormalTransform(t), input, output);
+    }
+
+    template <Execution Policy = Execution::Sequential, Concept::Transform Transform>
+    void TransformNormals(const Transform& t, SoAArray<Implementation::TransformVector<Transform>>& normals)
+    {
+        Implementation::TransformBatch<false, Policy>(Implementation::NormalTransform(t), normals, normals);
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_TRANSFORM_BATCH_HPP
@@ -5,6 +5,7 @@
 #include "../Functions.hpp"
 #include "Point.hpp"
 #include "MatrixOperators.hpp"
+#include "MatrixUtilities.hpp"
 
 namespace Math
 {
@@ -247,6 +248,61 @@ namespace Math
         Vec xOrtho = Cross(yOrtho, zOrtho);
         return Transform3T<Scalar>(xOrtho, yOrtho, zOrtho);
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Inverse
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Implementation
+    {
+        template <Concept::Transform Transform>
+        [[nodiscard]] constexpr
+        typename Transform::MatrixType LinearPart(const Transform& t) noexcept
+        {
+            typename Transform::MatrixType result;
+            for (SizeType i = 0; i < Transform::Dimension; ++i)
+            {
+                for (SizeType j = 0; j < Transform::Dimension; ++j)
+                {
+                    result[i][j] = t[i][j];
+                }
+            }
+            return result;
+        }
+
+        template <Concept::Transform Transform>
+        [[nodiscard]] constexpr
+        typename Transform::VectorType Translation(const Transform& t) noexcept
+        {
+            typename Transform::VectorType result;
+            for (SizeType i = 0; i < Transform::Dimension; ++i)
+            {
+                result[i] = t[i][Transform::Dimension];
+            }
+            return result;
+        }
+    }
+
+    // Note(3011): Transforms are affine, so only the linear part has to be
+    // inverted: (M, t)^-1 = (M^-1, -M^-1 t). This is far cheaper than
+    // inverting ToMatrix() as a full 4x4 matrix.
+    template <Concept::Transform Transform>
+    [[nodiscard]] constexpr
+    Transform Invert(const Transform& t) noexcept
+    {
+        auto linear = Invert(Implementation::LinearPart(t));
+        return Transform(linear, -(linear * Implementation::Translation(t)));
+    }
+
+    // Note(3011): Only valid if the linear part is a pure rotation, i.e. its
+    // rows are orthonormal. The inverse rotation is then the transpose.
+    template <Concept::Transform Transform>
+    [[nodiscard]] constexpr
+    Transform InvertRigid(const Transform& t) noexcept
+    {
+        auto linear = Transpose(Implementation::LinearPart(t));
+        return Transform(linear, -(linear * Implementation::Translation(t)));
+    }
 }
 
 #endif //MATHLIB_IMPLEMENTATION_TRANSFORM_UTILITIES_HPP
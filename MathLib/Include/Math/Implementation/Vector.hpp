@@ -7,6 +7,25 @@
 
 namespace Math
 {
+    namespace Implementation
+    {
+        // Note(3011): reinterpret_cast is not allowed in constant expressions,
+        // so the components are selected by name during constant evaluation.
+        template <typename T, typename Vec>
+        [[nodiscard]] constexpr
+        T& VectorComponent(Vec& u, SizeType idx) noexcept
+        {
+            if (std::is_constant_evaluated())
+            {
+                if constexpr (Vec::Dimension > 3) { if (idx == 3) { return u.w; } }
+                if constexpr (Vec::Dimension > 2) { if (idx == 2) { return u.z; } }
+                return (idx == 0) ? u.x : u.y;
+            }
+
+            return reinterpret_cast<T*>(&u)[ToUnderlying(idx)];
+        }
+    }
+
     template <Concept::StrongType T>
     struct Vector2T final
     {
@@ -20,8 +39,8 @@ namespace Math
         constexpr explicit Vector2T(T val)      noexcept : x(val ), y(val ) {}
         constexpr          Vector2T(T xv, T yv) noexcept : x(xv  ), y(yv  ) {}
 
-        constexpr       T& operator[] (SizeType idx)       { return reinterpret_cast<      T *>(this)[ToUnderlying(idx)]; }
-        constexpr const T& operator[] (SizeType idx) const { return reinterpret_cast<const T *>(this)[ToUnderlying(idx)]; }
+        constexpr       T& operator[] (SizeType idx)       { return Implementation::VectorComponent<      T>(*this, idx); }
+        constexpr const T& operator[] (SizeType idx) const { return Implementation::VectorComponent<const T>(*this, idx); }
 
         constexpr T LenSqr() const noexcept { return x * x + y * y; }
         constexpr T Length() const noexcept { return Sqrt(LenSqr()); }
@@ -48,8 +67,8 @@ namespace Math
         constexpr explicit Vector3T(const Vector2T<T>& u)       noexcept : x(u.x ), y(u.y ), z(T(0)) {}
         constexpr explicit Vector3T(const Vector2T<T>& u, T zv) noexcept : x(u.x ), y(u.y ), z(zv  ) {}
 
-        constexpr       T& operator[] (SizeType idx)       { return reinterpret_cast<      T *>(this)[ToUnderlying(idx)]; }
-        constexpr const T& operator[] (SizeType idx) const { return reinterpret_cast<const T *>(this)[ToUnderlying(idx)]; }
+        constexpr       T& operator[] (SizeType idx)       { return Implementation::VectorComponent<      T>(*this, idx); }
+        constexpr const T& operator[] (SizeType idx) const { return Implementation::VectorComponent<const T>(*this, idx); }
 
         constexpr T LenSqr() const noexcept { return x * x + y * y + z * z; }
         constexpr T Length() const noexcept { return Sqrt(LenSqr()); }
@@ -80,8 +99,8 @@ namespace Math
         constexpr explicit Vector4T(const Vector3T<T>& u)             noexcept : x(u.x ), y(u.y ), z(u.z ), w(T(0)) {}
         constexpr explicit Vector4T(const Vector3T<T>& u, T wv)       noexcept : x(u.x ), y(u.y ), z(u.z ), w(wv  ) {}
 
-        constexpr       T& operator[] (SizeType idx)       { return reinterpret_cast<      T *>(this)[ToUnderlying(idx)]; }
-        constexpr const T& operator[] (SizeType idx) const { return reinterpret_cast<const T *>(this)[ToUnderlying(idx)]; }
+        constexpr       T& operator[] (SizeType idx)       { return Implementation::VectorComponent<      T>(*this, idx); }
+        constexpr const T& operator[] (SizeType idx) const { return Implementation::VectorComponent<const T>(*this, idx); }
 
         constexpr T LenSqr() const noexcept { return x * x + y * y + z * z + w * w; }
         constexpr T Length() const noexcept { return Sqrt(LenSqr()); }
@@ -118,13 +137,13 @@ namespace Math
         template <typename... ValueTypes>
             requires (sizeof...(ValueTypes) == Dimension)
         constexpr VectorNT(ValueTypes... values) noexcept
-            : Data{MakeStrongType<ValueTypes>(values)...}
+            : Data(Cast<T>(values)...)
         {}
 
         constexpr       T& operator[] (SizeType idx)       { return Data[idx]; }
         constexpr const T& operator[] (SizeType idx) const { return Data[idx]; }
 
-        constexpr T LenSqr() const noexcept { T result; Data.ForEach([&result](T val) { result += val * val; }); return result; }
+        constexpr T LenSqr() const noexcept { T result{}; Data.ForEach([&result](const T& val) { result += val * val; }); return result; }
         constexpr T Length() const noexcept { return Sqrt(LenSqr()); }
         constexpr T Max()    const noexcept { return Data.Max(); }
         constexpr T Min()    const noexcept { return Data.Min(); }
@@ -2,6 +2,7 @@
 #define MATHLIB_IMPLEMENTATION_VECTOR_OPERATORS_HPP
 
 #include "Base/Concepts.hpp"
+#include "VectorSimd.hpp"
 
 namespace Math
 {
@@ -13,6 +14,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator+ (const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Add(u, v);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -25,6 +34,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator- (const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Sub(u, v);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -37,6 +54,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator* (const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Mul(u, v);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -49,6 +74,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator/ (const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Div(u, v);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -61,6 +94,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator- (const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Neg(u);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -75,6 +116,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator+= (Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::Add(u, v);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] += v[i];
@@ -86,6 +136,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator-= (Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::Sub(u, v);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] -= v[i];
@@ -97,6 +156,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator*= (Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::Mul(u, v);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] *= v[i];
@@ -108,6 +176,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator/= (Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::Div(u, v);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] /= v[i];
@@ -175,6 +252,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator+ (const Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::AddScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -187,6 +272,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator+ (typename Vec::ScalarType s, const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::AddScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -199,6 +292,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator- (const Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::SubScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -211,6 +312,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator- (typename Vec::ScalarType s, const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::ScalarSub(s, u);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -223,6 +332,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator* (const Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::MulScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -235,6 +352,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator* (typename Vec::ScalarType s, const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::MulScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -247,6 +372,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator/ (const Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::DivScalar(u, s);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -259,6 +392,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec operator/ (typename Vec::ScalarType s, const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::ScalarDiv(s, u);
+            }
+        }
+
         Vec result;
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -273,6 +414,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator+= (Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::AddScalar(u, s);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] += s;
@@ -284,6 +434,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator-= (Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::SubScalar(u, s);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] -= s;
@@ -295,6 +454,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator*= (Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::MulScalar(u, s);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] *= s;
@@ -306,6 +474,15 @@ namespace Math
     [[maybe_unused]] constexpr
     Vec& operator/= (Vec& u, typename Vec::ScalarType s) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                u = Implementation::Simd::DivScalar(u, s);
+                return u;
+            }
+        }
+
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
             u[i] /= s;
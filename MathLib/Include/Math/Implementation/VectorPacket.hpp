@@ -0,0 +1,228 @@
+#ifndef MATHLIB_IMPLEMENTATION_VECTOR_PACKET_HPP
+#define MATHLIB_IMPLEMENTATION_VECTOR_PACKET_HPP
+
+#include "Base/Concepts.hpp"
+#include "Packet.hpp"
+#include "PacketUtilities.hpp"
+#include "Vector.hpp"
+#include "VectorOperators.hpp"
+#include "VectorUtilities.hpp"
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Vector packets
+    //////////////////////////////////////////////////////////////////////////
+
+    // Note(3011): Structure-of-arrays counterparts of Vector2T/3T/4T. Every
+    // component is a Packet holding N lanes, which makes them regular
+    // vectors with a packet scalar type. The generic vector operators and
+    // utilities therefore work on N vectors at a time.
+
+    template <Concept::StrongType T, SizeType N>
+    struct Vector2Packet final
+    {
+        using ScalarType = Packet<T, N>;
+        using MaskType = typename ScalarType::MaskType;
+        using VectorType = Vector2T<T>;
+        static constexpr SizeType Dimension = 2;
+        static constexpr SizeType Size = N;
+
+        ScalarType x;
+        ScalarType y;
+
+        constexpr          Vector2Packet()                             noexcept = default;
+        constexpr explicit Vector2Packet(ScalarType val)               noexcept : x(val ), y(val ) {}
+        constexpr          Vector2Packet(ScalarType xv, ScalarType yv) noexcept : x(xv  ), y(yv  ) {}
+        constexpr explicit Vector2Packet(const VectorType& u)          noexcept : x(u.x ), y(u.y ) {}
+
+        constexpr       ScalarType& operator[] (SizeType idx)       { return Implementation::VectorComponent<      ScalarType>(*this, idx); }
+        constexpr const ScalarType& operator[] (SizeType idx) const { return Implementation::VectorComponent<const ScalarType>(*this, idx); }
+
+        constexpr ScalarType LenSqr() const noexcept { return x * x + y * y; }
+        constexpr ScalarType Length() const noexcept { return Sqrt(LenSqr()); }
+        constexpr ScalarType Max()    const noexcept { return Math::Max(x, y); }
+        constexpr ScalarType Min()    const noexcept { return Math::Min(x, y); }
+
+        constexpr VectorType Lane(SizeType lane) const noexcept { return VectorType(x[lane], y[lane]); }
+
+        constexpr
+        void SetLane(SizeType lane, const VectorType& u) noexcept
+        {
+            x[lane] = u.x;
+            y[lane] = u.y;
+        }
+
+        static constexpr
+        Vector2Packet Load(const VectorType* data) noexcept
+        {
+            Vector2Packet result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.SetLane(i, data[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        constexpr
+        void Store(VectorType* data) const noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                data[ToUnderlying(i)] = Lane(i);
+            }
+        }
+    };
+
+    template <Concept::StrongType T, SizeType N>
+    struct Vector3Packet final
+    {
+        using ScalarType = Packet<T, N>;
+        using MaskType = typename ScalarType::MaskType;
+        using VectorType = Vector3T<T>;
+        static constexpr SizeType Dimension = 3;
+        static constexpr SizeType Size = N;
+
+        ScalarType x;
+        ScalarType y;
+        ScalarType z;
+
+        constexpr          Vector3Packet()                                            noexcept = default;
+        constexpr explicit Vector3Packet(ScalarType val)                              noexcept : x(val ), y(val ), z(val ) {}
+        constexpr          Vector3Packet(ScalarType xv, ScalarType yv, ScalarType zv) noexcept : x(xv  ), y(yv  ), z(zv  ) {}
+        constexpr explicit Vector3Packet(const VectorType& u)                         noexcept : x(u.x ), y(u.y ), z(u.z ) {}
+
+        constexpr       ScalarType& operator[] (SizeType idx)       { return Implementation::VectorComponent<      ScalarType>(*this, idx); }
+        constexpr const ScalarType& operator[] (SizeType idx) const { return Implementation::VectorComponent<const ScalarType>(*this, idx); }
+
+        constexpr ScalarType LenSqr() const noexcept { return x * x + y * y + z * z; }
+        constexpr ScalarType Length() const noexcept { return Sqrt(LenSqr()); }
+        constexpr ScalarType Max()    const noexcept { return Math::Max(x, y, z); }
+        constexpr ScalarType Min()    const noexcept { return Math::Min(x, y, z); }
+
+        constexpr VectorType Lane(SizeType lane) const noexcept { return VectorType(x[lane], y[lane], z[lane]); }
+
+        constexpr
+        void SetLane(SizeType lane, const VectorType& u) noexcept
+        {
+            x[lane] = u.x;
+            y[lane] = u.y;
+            z[lane] = u.z;
+        }
+
+        static constexpr
+        Vector3Packet Load(const VectorType* data) noexcept
+        {
+            Vector3Packet result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.SetLane(i, data[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        constexpr
+        void Store(VectorType* data) const noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                data[ToUnderlying(i)] = Lane(i);
+            }
+        }
+    };
+
+    template <Concept::StrongType T, SizeType N>
+    struct Vector4Packet final
+    {
+        using ScalarType = Packet<T, N>;
+        using MaskType = typename ScalarType::MaskType;
+        using VectorType = Vector4T<T>;
+        static constexpr SizeType Dimension = 4;
+        static constexpr SizeType Size = N;
+
+        ScalarType x;
+        ScalarType y;
+        ScalarType z;
+        ScalarType w;
+
+        constexpr          Vector4Packet()                                                           noexcept = default;
+        constexpr explicit Vector4Packet(ScalarType val)                                             noexcept : x(val ), y(val ), z(val ), w(val ) {}
+        constexpr          Vector4Packet(ScalarType xv, ScalarType yv, ScalarType zv, ScalarType wv) noexcept : x(xv  ), y(yv  ), z(zv  ), w(wv  ) {}
+        constexpr explicit Vector4Packet(const VectorType& u)                                        noexcept : x(u.x ), y(u.y ), z(u.z ), w(u.w ) {}
+
+        constexpr       ScalarType& operator[] (SizeType idx)       { return Implementation::VectorComponent<      ScalarType>(*this, idx); }
+        constexpr const ScalarType& operator[] (SizeType idx) const { return Implementation::VectorComponent<const ScalarType>(*this, idx); }
+
+        constexpr ScalarType LenSqr() const noexcept { return x * x + y * y + z * z + w * w; }
+        constexpr ScalarType Length() const noexcept { return Sqrt(LenSqr()); }
+        constexpr ScalarType Max()    const noexcept { return Math::Max(x, y, z, w); }
+        constexpr ScalarType Min()    const noexcept { return Math::Min(x, y, z, w); }
+
+        constexpr VectorType Lane(SizeType lane) const noexcept { return VectorType(x[lane], y[lane], z[lane], w[lane]); }
+
+        constexpr
+        void SetLane(SizeType lane, const VectorType& u) noexcept
+        {
+            x[lane] = u.x;
+            y[lane] = u.y;
+            z[lane] = u.z;
+            w[lane] = u.w;
+        }
+
+        static constexpr
+        Vector4Packet Load(const VectorType* data) noexcept
+        {
+            Vector4Packet result;
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                result.SetLane(i, data[ToUnderlying(i)]);
+            }
+            return result;
+        }
+
+        constexpr
+        void Store(VectorType* data) const noexcept
+        {
+            for (SizeType i = 0; i < Size; ++i)
+            {
+                data[ToUnderlying(i)] = Lane(i);
+            }
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Lane-wise utilities
+    //////////////////////////////////////////////////////////////////////////
+
+    template <Concept::PacketVector Vec>
+    [[nodiscard]] constexpr
+    Vec Select(const typename Vec::ScalarType::MaskType& mask, const Vec& a, const Vec& b) noexcept
+    {
+        Vec result;
+        for (SizeType i = 0; i < Vec::Dimension; ++i)
+        {
+            result[i] = Select(mask, a[i], b[i]);
+        }
+        return result;
+    }
+
+    // Note(3011): Same as the scalar Refract, but lanes with total internal
+    // reflection are masked to zero instead of returning early.
+    template <Concept::PacketVector3 Vec>
+    [[nodiscard]] constexpr
+    Vec Refract(const Vec& u, const Vec& n, typename Vec::ScalarType eta) noexcept
+    {
+        using Scalar = typename Vec::ScalarType;
+
+        Scalar cosTheta = Dot(n, u);
+        Scalar sinThetaSquared = 1 - Squared(cosTheta);
+        Scalar sinPhiSquared = Squared(eta) * sinThetaSquared;
+        Scalar cosPhiSquared = 1 - sinPhiSquared;
+
+        auto valid = cosPhiSquared >= Scalar(0);
+        Vec refracted = eta * u - (eta * cosTheta + Sqrt(Max(cosPhiSquared, Scalar(0)))) * n;
+        return Select(valid, refracted, Vec(0));
+    }
+}
+
+#endif //MATHLIB_IMPLEMENTATION_VECTOR_PACKET_HPP
@@ -0,0 +1,224 @@
+#ifndef MATHLIB_IMPLEMENTATION_VECTOR_SIMD_HPP
+#define MATHLIB_IMPLEMENTATION_VECTOR_SIMD_HPP
+
+#include "Base/Simd.hpp"
+#include "Vector.hpp"
+
+namespace Math::Implementation::Simd
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Vector selection
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Vec>
+    struct VectorRegister
+    {
+        static constexpr bool Enabled = false;
+    };
+
+    template <typename T>
+    struct VectorRegister<Vector3T<StrongFloatType<T>>>
+    {
+        using Register = Register4<T>;
+        static constexpr bool Enabled = Register::Enabled;
+        static constexpr SizeType Dimension = 3;
+    };
+
+    template <typename T>
+    struct VectorRegister<Vector4T<StrongFloatType<T>>>
+    {
+        using Register = Register4<T>;
+        static constexpr bool Enabled = Register::Enabled;
+        static constexpr SizeType Dimension = 4;
+    };
+
+    // Note(3011): True when the vector type maps onto a single register
+    // of the selected instruction set.
+    template <typename Vec>
+    inline constexpr bool IsAccelerated = VectorRegister<Vec>::Enabled;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Loads and stores
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    auto Load(const Vec& u, Math::UnderlyingType<typename Vec::ScalarType> fill = 0) noexcept
+    {
+        using Traits = VectorRegister<Vec>;
+        using Scalar = Math::UnderlyingType<typename Vec::ScalarType>;
+
+        const Scalar* data = reinterpret_cast<const Scalar*>(&u);
+        if constexpr (Traits::Dimension == 3)
+        {
+            return Traits::Register::Load3(data, fill);
+        }
+        else
+        {
+            return Traits::Register::Load4(data);
+        }
+    }
+
+    template <typename Vec, typename Reg>
+    [[nodiscard]] inline
+    Vec Store(Reg value) noexcept
+    {
+        using Traits = VectorRegister<Vec>;
+        using Scalar = Math::UnderlyingType<typename Vec::ScalarType>;
+
+        Vec result;
+        Scalar* data = reinterpret_cast<Scalar*>(&result);
+        if constexpr (Traits::Dimension == 3)
+        {
+            Traits::Register::Store3(data, value);
+        }
+        else
+        {
+            Traits::Register::Store4(data, value);
+        }
+        return result;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Kernels
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Add(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Add(Load(u), Load(v)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Sub(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Sub(Load(u), Load(v)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Mul(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Mul(Load(u), Load(v)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Div(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Div(Load(u), Load(v, 1)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Neg(const Vec& u) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Neg(Load(u)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec AddScalar(const Vec& u, typename Vec::ScalarType s) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Add(Load(u), Reg::Broadcast(ToUnderlying(s))));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec SubScalar(const Vec& u, typename Vec::ScalarType s) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Sub(Load(u), Reg::Broadcast(ToUnderlying(s))));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec ScalarSub(typename Vec::ScalarType s, const Vec& u) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Sub(Reg::Broadcast(ToUnderlying(s)), Load(u)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec MulScalar(const Vec& u, typename Vec::ScalarType s) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Mul(Load(u), Reg::Broadcast(ToUnderlying(s))));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec DivScalar(const Vec& u, typename Vec::ScalarType s) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Div(Load(u), Reg::Broadcast(ToUnderlying(s))));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec ScalarDiv(typename Vec::ScalarType s, const Vec& u) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Store<Vec>(Reg::Div(Reg::Broadcast(ToUnderlying(s)), Load(u, 1)));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    typename Vec::ScalarType Dot(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        return Reg::First(Reg::HorizontalSum(Reg::Mul(Load(u), Load(v))));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Normalize(const Vec& u) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        auto value = Load(u);
+        auto length = Reg::Sqrt(Reg::HorizontalSum(Reg::Mul(value, value)));
+        return Store<Vec>(Reg::Div(value, length));
+    }
+
+    // Note(3011): Uses cross(u, v) = yzx(u * yzx(v) - yzx(u) * v), which
+    // only needs a single lane permutation.
+    template <typename Vec>
+    [[nodiscard]] inline
+    Vec Cross(const Vec& u, const Vec& v) noexcept
+    {
+        using Reg = typename VectorRegister<Vec>::Register;
+        auto a = Load(u);
+        auto b = Load(v);
+        auto c = Reg::Sub(Reg::Mul(a, Reg::ShuffleYZX(b)),
+                          Reg::Mul(Reg::ShuffleYZX(a), b));
+        return Store<Vec>(Reg::ShuffleYZX(c));
+    }
+
+    template <typename Vec>
+    [[nodiscard]] consteval
+    bool CrossAccelerated() noexcept
+    {
+        if constexpr (IsAccelerated<Vec>)
+        {
+            return VectorRegister<Vec>::Dimension == 3 && VectorRegister<Vec>::Register::HasShuffle;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template <typename Vec>
+    inline constexpr bool IsCrossAccelerated = CrossAccelerated<Vec>();
+}
+
+#endif //MATHLIB_IMPLEMENTATION_VECTOR_SIMD_HPP
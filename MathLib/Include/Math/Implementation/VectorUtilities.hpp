@@ -2,6 +2,7 @@
 #define MATHLIB_IMPLEMENTATION_VECTOR_UTILITIES_HPP
 
 #include "Base/Concepts.hpp"
+#include "VectorSimd.hpp"
 
 namespace Math
 {
@@ -9,6 +10,14 @@ namespace Math
     [[nodiscard]] constexpr
     typename Vec::ScalarType Dot(const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Dot(u, v);
+            }
+        }
+
         typename Vec::ScalarType dot{};
         for (SizeType i = 0; i < Vec::Dimension; ++i)
         {
@@ -21,6 +30,14 @@ namespace Math
     [[nodiscard]] constexpr
     Vec Normalize(const Vec& u) noexcept
     {
+        if constexpr (Implementation::Simd::IsAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return Implementation::Simd::Normalize(u);
+            }
+        }
+
         auto len = u.Length();
         return u / len;
     }
@@ -50,6 +67,21 @@ namespace Math
     [[nodiscard]] constexpr
     Vec Cross(const Vec& u, const Vec& v) noexcept
     {
+        if constexpr (Implementation::Simd::IsCrossAccelerated<Vec>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if constexpr (Hand == Orientation::Right)
+                {
+                    return Implementation::Simd::Cross(u, v);
+                }
+                else if constexpr (Hand == Orientation::Left)
+                {
+                    return Implementation::Simd::Cross(v, u);
+                }
+            }
+        }
+
         Vec w;
         if constexpr (Hand == Orientation::Right)
         {
@@ -3,6 +3,7 @@
 
 #include "Implementation/Base/Types.hpp"
 #include "Implementation/Matrix.hpp"
+#include "Implementation/MatrixDecomposition.hpp"
 #include "Implementation/MatrixOperators.hpp"
 #include "Implementation/MatrixUtilities.hpp"
 
@@ -20,6 +21,9 @@ namespace Math
     using Matrix3d = Matrix3T<f64>;
     using Matrix4d = Matrix4T<f64>;
 
+    template <SizeType N> using MatrixNf = MatrixNT<N, f32>;
+    template <SizeType N> using MatrixNd = MatrixNT<N, f64>;
+
     //////////////////////////////////////////////////////////////////////////
     // Enforce concepts on provided types
     //////////////////////////////////////////////////////////////////////////
@@ -31,6 +35,9 @@ namespace Math
     static_assert(Concept::Matrix2<Matrix2d>);
     static_assert(Concept::Matrix3<Matrix3d>);
     static_assert(Concept::Matrix4<Matrix4d>);
+
+    static_assert(Concept::MatrixN<MatrixNf<8>>);
+    static_assert(Concept::MatrixN<MatrixNd<8>>);
 }
 
 #endif //MATHLIB_MATRIX_HPP
@@ -1,6 +1,11 @@
 #ifndef MATHLIB_NOISE_HPP
 #define MATHLIB_NOISE_HPP
 
+#include "Implementation/Noise/Bake.hpp"
+#include "Implementation/Noise/FieldGenerator.hpp"
+#include "Implementation/Noise/Layer.hpp"
 #include "Implementation/Noise/Perlin.hpp"
+#include "Implementation/Noise/Simplex.hpp"
+#include "Implementation/Noise/Worley.hpp"
 
 #endif //MATHLIB_NOISE_HPP
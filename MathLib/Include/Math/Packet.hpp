@@ -0,0 +1,72 @@
+#ifndef MATHLIB_PACKET_HPP
+#define MATHLIB_PACKET_HPP
+
+#include "Implementation/Base/Types.hpp"
+#include "Implementation/Packet.hpp"
+#include "Implementation/PacketUtilities.hpp"
+#include "Implementation/VectorPacket.hpp"
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Useful type aliases
+    //////////////////////////////////////////////////////////////////////////
+
+    using Packet4f  = Packet<f32,  4>;
+    using Packet8f  = Packet<f32,  8>;
+    using Packet16f = Packet<f32, 16>;
+
+    using Packet2d = Packet<f64, 2>;
+    using Packet4d = Packet<f64, 4>;
+    using Packet8d = Packet<f64, 8>;
+
+    using Packet4i  = Packet<i32,  4>;
+    using Packet8i  = Packet<i32,  8>;
+    using Packet16i = Packet<i32, 16>;
+
+    using Packet4u  = Packet<u32,  4>;
+    using Packet8u  = Packet<u32,  8>;
+    using Packet16u = Packet<u32, 16>;
+
+    using Vector2Packet4f  = Vector2Packet<f32,  4>;
+    using Vector2Packet8f  = Vector2Packet<f32,  8>;
+    using Vector2Packet16f = Vector2Packet<f32, 16>;
+
+    using Vector3Packet4f  = Vector3Packet<f32,  4>;
+    using Vector3Packet8f  = Vector3Packet<f32,  8>;
+    using Vector3Packet16f = Vector3Packet<f32, 16>;
+
+    using Vector4Packet4f  = Vector4Packet<f32,  4>;
+    using Vector4Packet8f  = Vector4Packet<f32,  8>;
+    using Vector4Packet16f = Vector4Packet<f32, 16>;
+
+    using Vector3Packet2d = Vector3Packet<f64, 2>;
+    using Vector3Packet4d = Vector3Packet<f64, 4>;
+    using Vector3Packet8d = Vector3Packet<f64, 8>;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Enforce concepts on provided types
+    //////////////////////////////////////////////////////////////////////////
+
+    static_assert(Concept::Packet<Packet4f>);
+    static_assert(Concept::Packet<Packet8f>);
+    static_assert(Concept::Packet<Packet16f>);
+
+    static_assert(Concept::Packet<Packet2d>);
+    static_assert(Concept::Packet<Packet4d>);
+    static_assert(Concept::Packet<Packet8d>);
+
+    static_assert(Concept::Packet<Packet4i>);
+    static_assert(Concept::Packet<Packet8u>);
+
+    static_assert(Concept::Vector2<Vector2Packet8f>);
+    static_assert(Concept::Vector3<Vector3Packet8f>);
+    static_assert(Concept::Vector4<Vector4Packet8f>);
+
+    static_assert(Concept::PacketVector3<Vector3Packet4f>);
+    static_assert(Concept::PacketVector3<Vector3Packet8f>);
+    static_assert(Concept::PacketVector3<Vector3Packet16f>);
+    static_assert(Concept::PacketVector3<Vector3Packet4d>);
+}
+
+#endif //MATHLIB_PACKET_HPP
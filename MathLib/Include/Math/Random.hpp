@@ -2,8 +2,19 @@
 #define MATHLIB_RANDOM_HPP
 
 #include "Implementation/Random/Xoshiro.hpp"
+#include "Implementation/Random/XoshiroPacket.hpp"
+#include "Implementation/Random/Philox.hpp"
+#include "Implementation/Random/LowDiscrepancy.hpp"
 #include "Implementation/Random/UniformDistribution.hpp"
 #include "Implementation/Random/PoissonDistribution.hpp"
+#include "Implementation/Random/NormalDistribution.hpp"
+#include "Implementation/Random/ExponentialDistribution.hpp"
+#include "Implementation/Random/GammaDistribution.hpp"
+#include "Implementation/Random/BetaDistribution.hpp"
+#include "Implementation/Random/DiscreteDistribution.hpp"
+#include "Implementation/Random/Distribution1D.hpp"
+#include "Implementation/Random/Distribution2D.hpp"
+#include "Implementation/Random/Generate.hpp"
 
 namespace Math
 {
@@ -12,9 +23,20 @@ namespace Math
 
     static_assert(Concept::RandomNumberGenerator<Random32>);
     static_assert(Concept::RandomNumberGenerator<Random64>);
+    static_assert(Concept::RandomNumberGenerator<Philox4x32>);
+    static_assert(Concept::RandomNumberGenerator<SobolSampler>);
+    static_assert(Concept::RandomNumberGenerator<HaltonSampler>);
+    static_assert(Concept::RandomNumberGenerator<R2Sampler>);
+
+    static_assert(Concept::PacketRandomNumberGenerator<Xoshiro128StarStarX4>);
+    static_assert(Concept::PacketRandomNumberGenerator<Xoshiro256StarStarX8>);
 
     static_assert(Concept::Distribution<UniformDistribution<u32>, Random32>);
     static_assert(Concept::Distribution<UniformDistribution<u64>, Random64>);
+    static_assert(Concept::Distribution<NormalDistribution<f32>, Random32>);
+    static_assert(Concept::Distribution<ExponentialDistribution<f64>, Random64>);
+    static_assert(Concept::Distribution<GammaDistribution<f32>, Random64>);
+    static_assert(Concept::Distribution<BetaDistribution<f64>, Random32>);
 }
 
 #endif //MATHLIB_RANDOM_HPP
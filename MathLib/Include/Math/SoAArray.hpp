@@ -0,0 +1,32 @@
+#ifndef MATHLIB_SOA_ARRAY_HPP
+#define MATHLIB_SOA_ARRAY_HPP
+
+#include "Implementation/Base/Types.hpp"
+#include "Implementation/Vector.hpp"
+#include "Implementation/Point.hpp"
+#include "Implementation/SoAArray.hpp"
+
+namespace Math
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Useful type aliases
+    //////////////////////////////////////////////////////////////////////////
+
+    using SoAArray2f = SoAArray<Vector2T<f32>>;
+    using SoAArray3f = SoAArray<Vector3T<f32>>;
+    using SoAArray4f = SoAArray<Vector4T<f32>>;
+
+    using SoAArray2d = SoAArray<Vector2T<f64>>;
+    using SoAArray3d = SoAArray<Vector3T<f64>>;
+    using SoAArray4d = SoAArray<Vector4T<f64>>;
+
+    //////////////////////////////////////////////////////////////////////////
+    // Enforce concepts on provided types
+    //////////////////////////////////////////////////////////////////////////
+
+    static_assert(Concept::SoAElement<Vector3T<f32>>);
+    static_assert(Concept::SoAElement<Vector4T<f64>>);
+    static_assert(Concept::SoAElement<Point3T<f32>>);
+}
+
+#endif //MATHLIB_SOA_ARRAY_HPP
@@ -4,6 +4,7 @@
 #include "Implementation/Transform.hpp"
 #include "Implementation/TransformOperators.hpp"
 #include "Implementation/TransformUtilities.hpp"
+#include "Implementation/TransformBatch.hpp"
 
 namespace Math
 {
@@ -56,6 +56,9 @@ namespace Math
     using Vector3sz = Vector3T<SizeType>;
     using Vector4sz = Vector4T<SizeType>;
 
+    template <SizeType N> using VectorNf = VectorNT<N, f32>;
+    template <SizeType N> using VectorNd = VectorNT<N, f64>;
+
     //////////////////////////////////////////////////////////////////////////
     // Enforce concepts on provided types
     //////////////////////////////////////////////////////////////////////////
@@ -91,6 +94,9 @@ namespace Math
     static_assert(Concept::Vector2<Vector2ul>);
     static_assert(Concept::Vector3<Vector3ul>);
     static_assert(Concept::Vector4<Vector4ul>);
+
+    static_assert(Concept::VectorN<VectorNf<8>>);
+    static_assert(Concept::VectorN<VectorNd<8>>);
 }
 
 #endif //MATHLIB_VECTOR_HPP
@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Implementation/Base/Parallel.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("Parallel ranges", "[Math][Base]")
+{
+    SECTION("Every index is visited once")
+    {
+        std::vector<std::atomic<int>> visits(100003);
+        Math::Implementation::ParallelFor(visits.size(), 1000, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ++visits[i];
+            }
+        });
+
+        bool once = true;
+        for (const std::atomic<int>& count : visits)
+        {
+            once = once && (count == 1);
+        }
+        REQUIRE(once);
+    }
+
+    SECTION("Exceptions reach the caller after all ranges finished")
+    {
+        // Note(3011): Every range throws, including the one of the calling
+        // thread, so this also runs with a single hardware thread.
+        std::atomic<std::size_t> processed = 0;
+        REQUIRE_THROWS_AS(Math::Implementation::ParallelFor(4096, 1, [&](std::size_t begin, std::size_t end)
+        {
+            processed += end - begin;
+            throw std::runtime_error("range failed");
+        }), std::runtime_error);
+        REQUIRE(processed == 4096);
+
+        REQUIRE_THROWS_AS(Math::Implementation::ForRange<Math::Execution::Parallel>(4096, 1, [](std::size_t begin, std::size_t)
+        {
+            throw std::logic_error(begin == 0 ? "first range failed" : "worker failed");
+        }), std::logic_error);
+    }
+}
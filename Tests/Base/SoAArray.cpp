@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/SoAArray.hpp>
+#include <Math/Vector.hpp>
+#include <Math/Point.hpp>
+#include <Math/Implementation/Functions/Equal.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("SoAArray construction and element access", "[Math][SoAArray]")
+{
+    SECTION("Channels are separate and aligned")
+    {
+        Math::SoAArray3f array(5, Math::Vector3f(1.0f, 2.0f, 3.0f));
+        REQUIRE(array.Size() == 5);
+
+        for (Math::SizeType c = 0; c < 3; ++c)
+        {
+            auto channel = array.Channel(c);
+            REQUIRE(channel.size() == 5);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(channel.data()) % Math::SoAArray3f::Alignment == 0);
+            for (Math::f32 value : channel)
+            {
+                REQUIRE(Math::Equal(value, Math::Cast<Math::f32>(c) + 1.0f));
+            }
+        }
+    }
+
+    SECTION("Proxy references")
+    {
+        Math::SoAArray3f array(3);
+        array[1] = Math::Vector3f(4.0f, 5.0f, 6.0f);
+        array[2].y = 7.0f;
+        array[1] += Math::Vector3f(1.0f);
+        array[1] *= 2.0f;
+        array[0] = array[1];
+
+        Math::Vector3f value = array[1];
+        REQUIRE(Math::Equal(value, Math::Vector3f(10.0f, 12.0f, 14.0f)));
+        REQUIRE(Math::Equal(array.Get(0), value));
+        REQUIRE(Math::Equal(array.Get(2), Math::Vector3f(0.0f, 7.0f, 0.0f)));
+        REQUIRE(Math::Equal(array[1][2], 14.0f));
+
+        const Math::SoAArray3f& constArray = array;
+        REQUIRE(Math::Equal(constArray[2].y, 7.0f));
+        REQUIRE(Math::Equal(Math::Dot(constArray[1].Get(), Math::Vector3f::UnitX()), 10.0f));
+    }
+
+    SECTION("Conversion from and to AoS")
+    {
+        std::vector<Math::Vector3f> input = {
+            Math::Vector3f(1.0f, 2.0f, 3.0f),
+            Math::Vector3f(4.0f, 5.0f, 6.0f),
+        };
+
+        Math::SoAArray3f array(input);
+        array.Resize(3, Math::Vector3f(9.0f));
+        REQUIRE(array.Size() == 3);
+
+        std::vector<Math::Vector3f> output(3);
+        array.Store(output);
+        REQUIRE(Math::Equal(output[0], input[0]));
+        REQUIRE(Math::Equal(output[1], input[1]));
+        REQUIRE(Math::Equal(output[2], Math::Vector3f(9.0f)));
+
+        Math::SoAArray3f copy = array;
+        array[0] = Math::Vector3f(0.0f);
+        REQUIRE(Math::Equal(copy.Get(0), input[0]));
+
+        Math::SoAArray3f moved = static_cast<Math::SoAArray3f&&>(copy);
+        REQUIRE(moved.Size() == 3);
+        REQUIRE(copy.Empty());
+    }
+}
+
+TEST_CASE("SoAArray bulk operations", "[Math][SoAArray]")
+{
+    constexpr Math::SizeType count = 37;
+
+    Math::SoAArray3f a(count);
+    Math::SoAArray3f b(count);
+    for (Math::SizeType i = 0; i < count; ++i)
+    {
+        Math::f32 s = Math::Cast<Math::f32>(i);
+        a[i] = Math::Vector3f(s, -s, 2.0f * s);
+        b[i] = Math::Vector3f(1.0f, 2.0f, 3.0f);
+    }
+
+    SECTION("Add, scale and multiply-add")
+    {
+        a += b;
+        a *= 2.0f;
+        a.MultiplyAdd(b, -1.0f);
+        a -= b;
+        a /= 2.0f;
+
+        for (Math::SizeType i = 0; i < count; ++i)
+        {
+            Math::f32 s = Math::Cast<Math::f32>(i);
+            REQUIRE(Math::Equal(a.Get(i), Math::Vector3f(s, -s, 2.0f * s)));
+        }
+    }
+
+    SECTION("Reductions")
+    {
+        REQUIRE(Math::Equal(a.Min(), Math::Vector3f(0.0f, -36.0f, 0.0f)));
+        REQUIRE(Math::Equal(a.Max(), Math::Vector3f(36.0f, 0.0f, 72.0f)));
+        REQUIRE(Math::Equal(a.Sum(), Math::Vector3f(666.0f, -666.0f, 1332.0f)));
+        REQUIRE(Math::Equal(Math::SoAArray3f().Sum(), Math::Vector3f(0.0f)));
+    }
+
+    SECTION("Points")
+    {
+        Math::SoAArray<Math::Point3f> points(2);
+        points[0] = Math::Point3f(1.0f, 5.0f, -2.0f);
+        points[1] = Math::Point3f(-3.0f, 4.0f, 8.0f);
+
+        REQUIRE(Math::Equal(points.Min().x, -3.0f));
+        REQUIRE(Math::Equal(points.Max().z, 8.0f));
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Packet.hpp>
+
+#include <cmath>
+
+using namespace Math::Types;
+using Math::Fast::Precision;
+
+namespace
+{
+    static constexpr int totalSamples = 20000;
+
+    // Note(3011): Samples [begin, end] evenly, or its image under exp2 for
+    // functions whose error depends on the mantissa only.
+    template <typename T, typename Func, typename Reference>
+    double MaxRelativeError(Func&& func, Reference&& reference, double begin, double end, bool exponential = false)
+    {
+        double result = 0.0;
+        for (int i = 0; i <= totalSamples; ++i)
+        {
+            double t = static_cast<double>((i * 7919) % (totalSamples + 1)) / totalSamples;
+            double sample = begin + (end - begin) * t;
+            T x = static_cast<T>(exponential ? std::exp2(sample) : sample);
+
+            long double expected = reference(static_cast<long double>(x));
+            long double actual = static_cast<long double>(Math::ToUnderlying(func(x)));
+            result = std::fmax(result, static_cast<double>(std::fabs((actual - expected) / expected)));
+        }
+        return result;
+    }
+
+    // Note(3011): Relative to the expected value, the packet lanes span
+    // several orders of magnitude.
+    template <typename T>
+    bool RelativelyEqual(T actual, T expected, T tolerance)
+    {
+        return Math::Abs(actual - expected) <= tolerance * Math::Abs(expected);
+    }
+
+    template <typename T, Precision Level>
+    void CheckRelativeErrors(double exp, double log, double rsqrt, double reciprocal)
+    {
+        using Strong = Math::Implementation::StrongFloatType<T>;
+
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::Exp2<Level>(Strong(x)); }, [](long double x) { return std::exp2(x); }, -100.0, 100.0) <= exp);
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::Exp<Level>(Strong(x)); }, [](long double x) { return std::exp(x); }, -80.0, 80.0) <= exp);
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::Log2<Level>(Strong(x)); }, [](long double x) { return std::log2(x); }, -100.0, 100.0, true) <= log);
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::Log<Level>(Strong(x)); }, [](long double x) { return std::log(x); }, 0.5, 2.0) <= log);
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::RSqrt<Level>(Strong(x)); }, [](long double x) { return 1 / std::sqrt(x); }, -100.0, 100.0, true) <= rsqrt);
+        REQUIRE(MaxRelativeError<T>([](T x) { return Math::Fast::Reciprocal<Level>(Strong(x)); }, [](long double x) { return 1 / x; }, -100.0, 100.0, true) <= reciprocal);
+    }
+}
+
+TEST_CASE("Fast functions stay within their relative error", "[Math][Functions]")
+{
+    SECTION("Low precision")
+    {
+        CheckRelativeErrors<float,  Precision::Low>(8e-5, 3e-5, 2e-3, 3e-3);
+        CheckRelativeErrors<double, Precision::Low>(8e-5, 3e-5, 2e-3, 3e-3);
+    }
+
+    SECTION("Medium precision")
+    {
+        CheckRelativeErrors<float,  Precision::Medium>(4e-7, 4e-7, 5e-6, 7e-6);
+        CheckRelativeErrors<double, Precision::Medium>(1e-7, 2e-7, 5e-6, 7e-6);
+    }
+
+    SECTION("High precision")
+    {
+        CheckRelativeErrors<float,  Precision::High>(4e-7, 4e-7, 4e-7, 4e-7);
+        CheckRelativeErrors<double, Precision::High>(5e-11, 5e-12, 4e-11, 5e-11);
+    }
+
+    SECTION("Pow")
+    {
+        REQUIRE(Math::Equal(Math::Fast::Pow(f64(2.0), f64(10.0)), f64(1024.0), f64(1e-3)));
+        REQUIRE(Math::Equal(Math::Fast::Pow<Precision::High>(f64(9.0), f64(0.5)), f64(3.0), f64(1e-9)));
+        REQUIRE(Math::Equal(Math::Fast::Pow<Precision::Low>(f32(0.5f), f32(-3.0f)), f32(8.0f), f32(1e-2f)));
+    }
+}
+
+TEST_CASE("Fast functions edge cases", "[Math][Functions]")
+{
+    static_assert(Math::Fast::Exp2(f64(3.0)) == f64(8.0) * f64(1.0000000716546822));
+    static_assert(Math::Fast::Log2(f32(1.0f)) == f32(0.0f));
+    static_assert(Math::Abs(Math::Fast::RSqrt<Precision::High>(f64(4.0)) - f64(0.5)) < f64(1e-10));
+
+    REQUIRE(Math::Fast::Exp2(f32(-200.0f)) == f32(0.0f));
+    REQUIRE(Math::Fast::Exp(f64(800.0)) == f64::Infinity());
+    REQUIRE(Math::Equal(Math::Fast::Log2<Precision::High>(f64(0.125)), f64(-3.0), f64(1e-12)));
+
+    SECTION("Exp of large arguments")
+    {
+        REQUIRE(Math::Fast::Exp(f32(-1e30f)) == f32(0.0f));
+        REQUIRE(Math::Fast::Exp(f32(1e30f)) == f32::Infinity());
+        REQUIRE(Math::Fast::Exp<Precision::Low>(f32(-100.0f)) == f32(0.0f));
+        REQUIRE(Math::Fast::Exp<Precision::High>(f64(-1e300)) == f64(0.0));
+        REQUIRE(Math::Fast::Exp<Precision::High>(f64(1e300)) == f64::Infinity());
+        REQUIRE(Math::Fast::Exp(-f64::Infinity()) == f64(0.0));
+
+        Math::Packet8f x(-1e30f, -1e5f, -88.5f, -80.0f, 80.0f, 88.0f, 1e5f, 1e30f);
+        Math::Packet8f exp = Math::Fast::Exp(x);
+        for (Math::SizeType i = 0; i < 8; ++i)
+        {
+            REQUIRE(!Math::IsNan(exp[i]));
+        }
+
+        // Note(3011): Clamped lanes are exactly 0 or infinity, the others
+        // may fuse multiply-adds differently from the scalar code.
+        for (Math::SizeType i : { 0, 1, 2 })
+        {
+            REQUIRE(exp[i] == f32(0.0f));
+        }
+        for (Math::SizeType i : { 3, 4, 5 })
+        {
+            REQUIRE(RelativelyEqual(exp[i], Math::Fast::Exp(x[i]), f32(1e-5f)));
+        }
+        for (Math::SizeType i : { 6, 7 })
+        {
+            REQUIRE(exp[i] == f32::Infinity());
+        }
+        REQUIRE(RelativelyEqual(exp[3], f32(std::exp(-80.0f)), f32(1e-5f)));
+        REQUIRE(RelativelyEqual(exp[5], f32(std::exp(88.0f)), f32(1e-5f)));
+    }
+}
+
+TEST_CASE("Fast functions on packets", "[Math][Functions][Packet]")
+{
+    // Note(3011): The packet code may fuse multiply-adds differently.
+    constexpr f32 Tolerance = 1e-5f;
+
+    Math::Packet8f x(0.001f, 0.3f, 0.75f, 1.0f, 1.5f, 2.0f, 10.0f, 12345.0f);
+
+    Math::Packet8f exp = Math::Fast::Exp(-x);
+    Math::Packet8f log = Math::Fast::Log<Precision::Low>(x);
+    Math::Packet8f pow = Math::Fast::Pow(x, Math::Packet8f(0.25f));
+    Math::Packet8f rsqrt = Math::Fast::RSqrt<Precision::High>(x);
+    Math::Packet8f reciprocal = Math::Fast::Reciprocal(x);
+    for (Math::SizeType i = 0; i < 8; ++i)
+    {
+        REQUIRE(RelativelyEqual(exp[i], Math::Fast::Exp(-x[i]), Tolerance));
+        REQUIRE(RelativelyEqual(log[i], Math::Fast::Log<Precision::Low>(x[i]), Tolerance));
+        REQUIRE(RelativelyEqual(pow[i], Math::Fast::Pow(x[i], f32(0.25f)), Tolerance));
+        REQUIRE(RelativelyEqual(rsqrt[i], Math::Fast::RSqrt<Precision::High>(x[i]), Tolerance));
+        REQUIRE(RelativelyEqual(reciprocal[i], Math::Fast::Reciprocal(x[i]), Tolerance));
+    }
+}
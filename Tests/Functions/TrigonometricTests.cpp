@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Constants.hpp>
+#include <Math/Functions.hpp>
+#include <Math/Packet.hpp>
+
+#include <cmath>
+#include <limits>
+
+using namespace Math::Types;
+using namespace Math::Constant;
+
+namespace
+{
+    static constexpr int totalSamples = 20000;
+
+    // Note(3011): Distance to the long double reference in units of the
+    // spacing of T around the reference, so 0.5 means correctly rounded.
+    template <typename T>
+    double UlpError(T result, long double reference)
+    {
+        T rounded = static_cast<T>(reference);
+        T next = std::nextafter(rounded, (static_cast<long double>(rounded) > reference)
+                                       ? -std::numeric_limits<T>::infinity()
+                                       :  std::numeric_limits<T>::infinity());
+        long double spacing = std::fabs(static_cast<long double>(next) - static_cast<long double>(rounded));
+        return static_cast<double>(std::fabs(static_cast<long double>(result) - reference) / spacing);
+    }
+
+    template <typename T, typename Func, typename Reference>
+    double MaxUlpError(Func&& func, Reference&& reference, double begin, double end)
+    {
+        double result = 0.0;
+        for (int i = 0; i <= totalSamples; ++i)
+        {
+            // Note(3011): The odd multiplier keeps the samples away from a
+            // regular grid that could line up with multiples of Pi.
+            double t = static_cast<double>((i * 7919) % (totalSamples + 1)) / totalSamples;
+            T x = static_cast<T>(begin + (end - begin) * t);
+            result = std::fmax(result, UlpError<T>(Math::ToUnderlying(func(x)), reference(static_cast<long double>(x))));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Trigonometric functions in constant expressions", "[Math][Functions]")
+{
+    static_assert(Math::Sin(f64(0.0)) == f64(0.0));
+    static_assert(Math::Cos(f64(0.0)) == f64(1.0));
+    static_assert(Math::Abs(Math::Sin(Pi<f64>)) < f64(1e-15));
+    static_assert(Math::Abs(Math::Cos(Pi<f32>) + f32(1.0f)) < f32(1e-6f));
+    static_assert(Math::Abs(Math::Atan(f64(1.0)) - Pi<f64> / 4) < f64(1e-15));
+    static_assert(Math::Abs(Math::Atan2(f32(-1.0f), f32(-1.0f)) + Pi<f32> * 0.75f) < f32(1e-6f));
+
+    REQUIRE(Math::Equal(Math::Tan(Pi<f64> / 4), f64(1.0)));
+}
+
+TEST_CASE("Trigonometric functions stay within their ulp bounds", "[Math][Functions]")
+{
+    SECTION("Sin, Cos, Tan with f32")
+    {
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Sin(f32(x)); }, [](long double x) { return std::sin(x); }, -8192.0, 8192.0) <= 2.5);
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Cos(f32(x)); }, [](long double x) { return std::cos(x); }, -8192.0, 8192.0) <= 2.5);
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Tan(f32(x)); }, [](long double x) { return std::tan(x); }, -8192.0, 8192.0) <= 4.0);
+    }
+
+    SECTION("Sin, Cos, Tan with f64")
+    {
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Sin(f64(x)); }, [](long double x) { return std::sin(x); }, -1e6, 1e6) <= 2.5);
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Cos(f64(x)); }, [](long double x) { return std::cos(x); }, -1e6, 1e6) <= 2.5);
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Tan(f64(x)); }, [](long double x) { return std::tan(x); }, -1e6, 1e6) <= 4.0);
+    }
+
+    SECTION("Inverse functions with f32")
+    {
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Asin(f32(x)); }, [](long double x) { return std::asin(x); }, -1.0, 1.0) <= 2.5);
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Acos(f32(x)); }, [](long double x) { return std::acos(x); }, -1.0, 1.0) <= 1.5);
+        REQUIRE(MaxUlpError<float>([](float x) { return Math::Atan(f32(x)); }, [](long double x) { return std::atan(x); }, -100.0, 100.0) <= 3.0);
+    }
+
+    SECTION("Inverse functions with f64")
+    {
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Asin(f64(x)); }, [](long double x) { return std::asin(x); }, -1.0, 1.0) <= 2.5);
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Acos(f64(x)); }, [](long double x) { return std::acos(x); }, -1.0, 1.0) <= 1.5);
+        REQUIRE(MaxUlpError<double>([](double x) { return Math::Atan(f64(x)); }, [](long double x) { return std::atan(x); }, -100.0, 100.0) <= 1.0);
+    }
+}
+
+TEST_CASE("Basic SinCos, Atan2 tests", "[Math][Functions]")
+{
+    SECTION("SinCos matches Sin and Cos")
+    {
+        for (int i = -100; i <= 100; ++i)
+        {
+            f64 x = f64(i) * 0.37;
+            f64 sin;
+            f64 cos;
+            Math::SinCos(x, sin, cos);
+            REQUIRE(sin == Math::Sin(x));
+            REQUIRE(cos == Math::Cos(x));
+        }
+    }
+
+    SECTION("Atan2 quadrants")
+    {
+        REQUIRE(Math::Equal(Math::Atan2(f64( 1.0), f64( 1.0)),  Pi<f64> / 4));
+        REQUIRE(Math::Equal(Math::Atan2(f64( 1.0), f64(-1.0)),  Pi<f64> * 0.75));
+        REQUIRE(Math::Equal(Math::Atan2(f64(-1.0), f64(-1.0)), -Pi<f64> * 0.75));
+        REQUIRE(Math::Equal(Math::Atan2(f64(-1.0), f64( 1.0)), -Pi<f64> / 4));
+        REQUIRE(Math::Equal(Math::Atan2(f64( 0.0), f64(-2.0)),  Pi<f64>));
+        REQUIRE(Math::Equal(Math::Atan2(f64( 3.0), f64( 0.0)),  PiDiv2<f64>));
+        REQUIRE(Math::Atan2(f64(0.0), f64(0.0)) == f64(0.0));
+    }
+
+    SECTION("Special values")
+    {
+        REQUIRE(Math::IsNan(Math::Sin(f32::Infinity())));
+        REQUIRE(Math::IsNan(Math::Cos(f64::NaN())));
+        REQUIRE(Math::IsNan(Math::Asin(f64(1.5))));
+        REQUIRE(Math::Acos(f64(1.0)) == f64(0.0));
+        REQUIRE(Math::Equal(Math::Atan(f32::Infinity()), PiDiv2<f32>));
+        REQUIRE(Math::Equal(Math::Atan(-f64::Infinity()), -PiDiv2<f64>));
+    }
+
+    SECTION("Signed zeros")
+    {
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Sin(f32(-0.0f)))));
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Tan(f64(-0.0)))));
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Asin(f32(-0.0f)))));
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Atan(f64(-0.0)))));
+        REQUIRE(!std::signbit(Math::ToUnderlying(Math::Sin(f32(0.0f)))));
+
+        REQUIRE(Math::Atan2(f32(-0.0f), f32(-2.0f)) == -Pi<f32>);
+        REQUIRE(Math::Atan2(f32( 0.0f), f32(-2.0f)) ==  Pi<f32>);
+        REQUIRE(Math::Atan2(f64(-0.0), f64(-0.0)) == -Pi<f64>);
+        REQUIRE(Math::Atan2(f64( 0.0), f64(-0.0)) ==  Pi<f64>);
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Atan2(f64(-0.0), f64(2.0)))));
+        REQUIRE(std::signbit(Math::ToUnderlying(Math::Atan2(f32(-0.0f), f32(0.0f)))));
+        REQUIRE(Math::Equal(Math::Atan2(f32(-3.0f), f32(-0.0f)), -PiDiv2<f32>));
+
+        Math::Packet4d y(-0.0, 0.0, 1.0, -0.0);
+        Math::Packet4d x(-1.0, -1.0, 0.0, 2.0);
+        Math::Packet4d atan2 = Math::Atan2(y, x);
+        for (Math::SizeType i = 0; i < 4; ++i)
+        {
+            REQUIRE(Math::ToUnderlying(atan2[i]) == std::atan2(Math::ToUnderlying(y[i]), Math::ToUnderlying(x[i])));
+            REQUIRE(std::signbit(Math::ToUnderlying(atan2[i])) == std::signbit(Math::ToUnderlying(y[i])));
+        }
+    }
+
+    SECTION("Large arguments")
+    {
+        // Note(3011): Beyond 2^22 (f32) the reduction alone can't even
+        // round x * 2 / Pi to an integer.
+        for (float x : { 1e5f, -3.0e7f, 1.7e19f, 3.0e38f })
+        {
+            REQUIRE(Math::ToUnderlying(Math::Sin(f32(x))) == std::sin(x));
+            REQUIRE(Math::ToUnderlying(Math::Cos(f32(x))) == std::cos(x));
+            REQUIRE(UlpError<float>(Math::ToUnderlying(Math::Tan(f32(x))), std::tan(static_cast<long double>(x))) <= 4.0);
+        }
+
+        Math::Packet4d x(0.5, 1e7, -2.5e300, 3.0);
+        Math::Packet4d sin;
+        Math::Packet4d cos;
+        Math::SinCos(x, sin, cos);
+        for (Math::SizeType i = 0; i < 4; ++i)
+        {
+            REQUIRE(sin[i] == Math::Sin(x[i]));
+            REQUIRE(cos[i] == Math::Cos(x[i]));
+        }
+        REQUIRE(Math::ToUnderlying(sin[2]) == std::sin(-2.5e300));
+    }
+}
+
+TEST_CASE("Trigonometric functions on packets", "[Math][Functions][Packet]")
+{
+    SECTION("Packet8f")
+    {
+        Math::Packet8f x(-7.5f, -2.0f, -0.75f, 0.0f, 0.3f, 1.2f, 4.0f, 100.0f);
+        Math::Packet8f sin;
+        Math::Packet8f cos;
+        Math::SinCos(x, sin, cos);
+
+        Math::Packet8f tan = Math::Tan(x);
+        Math::Packet8f atan = Math::Atan(x);
+        Math::Packet8f atan2 = Math::Atan2(x, Math::Packet8f(-1.0f));
+        for (Math::SizeType i = 0; i < 8; ++i)
+        {
+            REQUIRE(Math::Equal(sin[i], Math::Sin(x[i])));
+            REQUIRE(Math::Equal(cos[i], Math::Cos(x[i])));
+            REQUIRE(Math::Equal(tan[i], Math::Tan(x[i]), f32(1e-5f)));
+            REQUIRE(Math::Equal(atan[i], Math::Atan(x[i])));
+            REQUIRE(Math::Equal(atan2[i], Math::Atan2(x[i], f32(-1.0f))));
+        }
+    }
+
+    SECTION("Packet4d")
+    {
+        Math::Packet4d x(-1.0, -0.6, 0.25, 0.99);
+        Math::Packet4d asin = Math::Asin(x);
+        Math::Packet4d acos = Math::Acos(x);
+        for (Math::SizeType i = 0; i < 4; ++i)
+        {
+            REQUIRE(Math::Equal(asin[i], Math::Asin(x[i])));
+            REQUIRE(Math::Equal(acos[i], Math::Acos(x[i])));
+            REQUIRE(Math::Equal(Math::Sin(asin)[i], x[i]));
+        }
+    }
+}
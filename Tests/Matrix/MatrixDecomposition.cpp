@@ -0,0 +1,296 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "MatrixTestsCommon.hpp"
+#include <Math/Vector.hpp>
+#include <Math/Implementation/Functions/Equal.hpp>
+
+namespace
+{
+    // Note(3011): Residuals of the solvers are relative to the magnitude of
+    // the inputs, the default epsilon is too strict for them.
+    constexpr Math::f64 Tolerance = 1e-9;
+
+    template <typename Mat>
+    Mat MakeTestingMatrixN(double diagonal)
+    {
+        Mat m;
+        for (Math::SizeType i = 0; i < Mat::Dimension; ++i)
+        {
+            for (Math::SizeType j = 0; j < Mat::Dimension; ++j)
+            {
+                double ij = static_cast<double>(Math::ToUnderlying(i * 7 + j * 3) % 11);
+                m[i][j] = Math::Cast<typename Mat::ScalarType>(ij / 5.0 - 1.0);
+            }
+            m[i][i] += Math::Cast<typename Mat::ScalarType>(diagonal);
+        }
+        return m;
+    }
+
+    template <typename Mat>
+    Mat Reference(const Mat& a, const Mat& b)
+    {
+        Mat c;
+        for (Math::SizeType i = 0; i < Mat::Dimension; ++i)
+        {
+            for (Math::SizeType j = 0; j < Mat::Dimension; ++j)
+            {
+                for (Math::SizeType k = 0; k < Mat::Dimension; ++k)
+                {
+                    c[i][j] += a[i][k] * b[k][j];
+                }
+            }
+        }
+        return c;
+    }
+}
+
+TEST_CASE("Check MatrixNT operations", "[Math][Matrix]")
+{
+    SECTION("Blocked multiplication")
+    {
+        using Mat = Math::MatrixNd<37>;
+        Mat a = MakeTestingMatrixN<Mat>(2.0);
+        Mat b = Math::Transpose(MakeTestingMatrixN<Mat>(-1.0));
+
+        REQUIRE(Math::Equal(a * b, Reference(a, b), Tolerance));
+        REQUIRE(Math::Equal(a * Mat::Identity(), a));
+    }
+
+    SECTION("Matrix-vector products")
+    {
+        using Mat = Math::MatrixNf<6>;
+        Mat a = MakeTestingMatrixN<Mat>(0.0);
+        Math::VectorNf<6> u(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f);
+
+        Math::VectorNf<6> v = a * u;
+        for (Math::SizeType i = 0; i < 6; ++i)
+        {
+            REQUIRE(Math::Equal(v[i], Math::Dot(a[i], u)));
+        }
+    }
+}
+
+TEST_CASE("Check LU decomposition", "[Math][Matrix]")
+{
+    using Mat = Math::MatrixNd<8>;
+    using Vec = Math::VectorNd<8>;
+
+    Mat a = MakeTestingMatrixN<Mat>(0.5);
+    Math::LUDecomposition<Mat> lu(a);
+    REQUIRE(!lu.IsSingular());
+
+    SECTION("Solve")
+    {
+        Vec b(1.0, -2.0, 3.0, 0.5, 0.0, 4.0, -1.0, 2.0);
+        Vec x = lu.Solve(b);
+        REQUIRE(Math::Equal(a * x, b, Tolerance));
+
+        Mat rhs = MakeTestingMatrixN<Mat>(3.0);
+        Mat xs = rhs;
+        lu.SolveInPlace(xs);
+        REQUIRE(Math::Equal(a * xs, rhs, Tolerance));
+    }
+
+    SECTION("Inverse and determinant")
+    {
+        REQUIRE(Math::Equal(a * Math::Invert(a), Mat::Identity(), Tolerance));
+        REQUIRE(Math::Equal(Math::Determinant(a) * Math::Determinant(Math::Invert(a)), 1.0, Tolerance));
+
+        Math::Matrix4d small(2.0, 0.5, -1.0,  3.0,
+                             0.0, 4.0,  1.5, -2.0,
+                             1.0, 0.0,  3.0,  0.25,
+                            -1.0, 2.0,  0.0,  1.0);
+        REQUIRE(Math::Equal(Math::LUDecomposition<Math::Matrix4d>(small).Determinant(), Math::Determinant(small), Tolerance));
+    }
+
+    SECTION("Singular matrices")
+    {
+        // Note(3011): A zero column keeps every candidate pivot exactly zero.
+        Mat singular = a;
+        for (Math::SizeType i = 0; i < 8; ++i)
+        {
+            singular[i][5] = 0.0;
+        }
+
+        REQUIRE(Math::LUDecomposition<Mat>(singular).IsSingular());
+
+        Vec rhs(1.0);
+        REQUIRE(!Math::LUDecomposition<Mat>(singular).TrySolve(rhs));
+        REQUIRE(Math::Equal(rhs, Vec(1.0), Tolerance));
+
+        Mat inverse;
+        REQUIRE(!Math::TryInvert(singular, inverse, 1e-9));
+        REQUIRE(Math::TryInvert(a, inverse));
+    }
+}
+
+TEST_CASE("Check Cholesky decomposition", "[Math][Matrix]")
+{
+    using Mat = Math::MatrixNd<12>;
+    using Vec = Math::VectorNd<12>;
+
+    // Note(3011): B^T B + I is symmetric positive definite.
+    Mat b = MakeTestingMatrixN<Mat>(0.0);
+    Mat a = Math::Transpose(b) * b + Mat::Identity();
+
+    Math::CholeskyDecomposition<Mat> cholesky(a);
+    REQUIRE(cholesky.IsPositiveDefinite());
+
+    Vec rhs(2.0);
+    REQUIRE(Math::Equal(a * cholesky.Solve(rhs), rhs, Tolerance));
+    REQUIRE(Math::Equal(cholesky.Determinant() / Math::Determinant(a), 1.0, Tolerance));
+
+    const Mat& l = cholesky.Factor();
+    REQUIRE(Math::Equal(l * Math::Transpose(l), a, Tolerance));
+
+    REQUIRE(!Math::CholeskyDecomposition<Mat>(a * -1.0).IsPositiveDefinite());
+
+    Vec unchanged = rhs;
+    REQUIRE(!Math::CholeskyDecomposition<Mat>(a * -1.0).TrySolve(unchanged));
+    REQUIRE(Math::Equal(unchanged, rhs, Tolerance));
+    REQUIRE(cholesky.TrySolve(unchanged));
+    REQUIRE(Math::Equal(a * unchanged, rhs, Tolerance));
+}
+
+TEST_CASE("Check QR decomposition", "[Math][Matrix]")
+{
+    using Mat = Math::MatrixNd<10>;
+    using Vec = Math::VectorNd<10>;
+
+    Mat a = MakeTestingMatrixN<Mat>(-0.25);
+    Math::QRDecomposition<Mat> qr(a);
+    REQUIRE(qr.IsFullRank());
+
+    Vec b = Vec::Unit(3) - Vec::Unit(7);
+    REQUIRE(Math::Equal(a * qr.Solve(b), b, Tolerance));
+    REQUIRE(Math::Equal(qr.Solve(a), Mat::Identity(), Tolerance));
+    REQUIRE(Math::Equal(qr.AbsDeterminant(), Math::Abs(Math::Determinant(a)), Tolerance));
+
+    Math::Matrix3f singular = MakeTestingMatrix3f();
+    singular[2] = Math::Vector3f(0.0f);
+    REQUIRE(!Math::QRDecomposition<Math::Matrix3f>(singular).IsFullRank());
+
+    SECTION("Rank deficient matrices")
+    {
+        // Note(3011): Column 4 is the sum of columns 1 and 2, which leaves
+        // only rounding noise in its Householder column.
+        Mat deficient = a;
+        for (Math::SizeType i = 0; i < 10; ++i)
+        {
+            deficient[i][4] = deficient[i][1] + deficient[i][2];
+        }
+
+        Math::QRDecomposition<Mat> rankDeficient(deficient);
+        REQUIRE(!rankDeficient.IsFullRank());
+
+        Vec rhs = b;
+        REQUIRE(!rankDeficient.TrySolve(rhs));
+        REQUIRE(Math::Equal(rhs, b, Tolerance));
+
+        Vec solution = b;
+        REQUIRE(qr.TrySolve(solution));
+        REQUIRE(Math::Equal(a * solution, b, Tolerance));
+
+        Mat zero = a;
+        for (Math::SizeType i = 0; i < 10; ++i)
+        {
+            zero[i][0] = 0.0;
+        }
+        REQUIRE(!Math::QRDecomposition<Mat>(zero).IsFullRank());
+    }
+}
+
+TEST_CASE("Check least squares by QR", "[Math][Matrix]")
+{
+    using Vec = Math::VectorNd<3>;
+    constexpr Math::SizeType Rows = 20;
+    using LeastSquares = Math::LeastSquaresQR<Rows, Vec>;
+
+    // Note(3011): Quadratic fit, row i is (1, t, t^2) at t = i / 4 - 2.
+    LeastSquares::MatrixType a;
+    for (Math::SizeType i = 0; i < Rows; ++i)
+    {
+        const Math::f64 t = Math::Cast<Math::f64>(i) / 4.0 - 2.0;
+        a[i][0] = 1.0;
+        a[i][1] = t;
+        a[i][2] = t * t;
+    }
+
+    const auto residual = [&](const LeastSquares::RhsType& b, const Vec& x)
+    {
+        LeastSquares::RhsType r;
+        for (Math::SizeType i = 0; i < Rows; ++i)
+        {
+            r[i] = a[i][0] * x[0] + a[i][1] * x[1] + a[i][2] * x[2] - b[i];
+        }
+        return r;
+    };
+
+    LeastSquares leastSquares(a);
+    REQUIRE(leastSquares.IsFullRank());
+
+    SECTION("Exact fit")
+    {
+        LeastSquares::RhsType b;
+        for (Math::SizeType i = 0; i < Rows; ++i)
+        {
+            b[i] = 0.5 - 1.25 * a[i][1] + 2.0 * a[i][2];
+        }
+
+        const Vec x = leastSquares.Solve(b);
+        REQUIRE(Math::Equal(x[0], Math::f64(0.5), Tolerance));
+        REQUIRE(Math::Equal(x[1], Math::f64(-1.25), Tolerance));
+        REQUIRE(Math::Equal(x[2], Math::f64(2.0), Tolerance));
+        REQUIRE(Math::Equal(leastSquares.ResidualNorm(b), Math::f64(0.0), Tolerance));
+    }
+
+    SECTION("Noisy fit")
+    {
+        // Note(3011): The residual of a least squares solution is orthogonal
+        // to every column of A.
+        LeastSquares::RhsType b;
+        for (Math::SizeType i = 0; i < Rows; ++i)
+        {
+            const Math::f64 noise = Math::ToUnderlying(i) % 3 == 0 ? 0.1 : -0.05;
+            b[i] = 0.5 - 1.25 * a[i][1] + 2.0 * a[i][2] + noise;
+        }
+
+        Vec x;
+        REQUIRE(leastSquares.TrySolve(b, x));
+        const LeastSquares::RhsType r = residual(b, x);
+
+        Math::f64 norm = 0.0;
+        for (Math::SizeType j = 0; j < 3; ++j)
+        {
+            Math::f64 dot = 0.0;
+            for (Math::SizeType i = 0; i < Rows; ++i)
+            {
+                dot += a[i][j] * r[i];
+            }
+            REQUIRE(Math::Equal(dot, Math::f64(0.0), Tolerance));
+        }
+        for (Math::SizeType i = 0; i < Rows; ++i)
+        {
+            norm += r[i] * r[i];
+        }
+        REQUIRE(norm > Math::f64(0.0));
+        REQUIRE(Math::Equal(leastSquares.ResidualNorm(b), Math::Sqrt(norm), Tolerance));
+    }
+
+    SECTION("Rank deficient matrices")
+    {
+        LeastSquares::MatrixType deficient = a;
+        for (Math::SizeType i = 0; i < Rows; ++i)
+        {
+            deficient[i][2] = deficient[i][0] - 3.0 * deficient[i][1];
+        }
+
+        LeastSquares rankDeficient(deficient);
+        REQUIRE(!rankDeficient.IsFullRank());
+
+        LeastSquares::RhsType b;
+        Vec x = Vec::Unit(1);
+        REQUIRE(!rankDeficient.TrySolve(b, x));
+        REQUIRE(Math::Equal(x, Vec::Unit(1), Tolerance));
+    }
+}
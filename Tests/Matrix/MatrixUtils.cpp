@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "MatrixTestsCommon.hpp"
+#include <Math/Vector.hpp>
 #include <Math/Implementation/Functions/Equal.hpp>
 
 TEST_CASE("Check determinant calculations", "[Math][Matrix]")
@@ -75,5 +76,100 @@ TEST_CASE("Check inverse calculations", "[Math][Matrix]")
         Math::Matrix4f m_inverse = Math::Invert(m);
 
         REQUIRE(Math::Equal((m * m_inverse), Math::Matrix4f(1.0f)));
+        REQUIRE(Math::Equal((m_inverse * m), Math::Matrix4f(1.0f)));
+        REQUIRE(Math::Equal(m_inverse, Math::Adjugate(m) / Math::Determinant(m)));
+    }
+
+    SECTION("Matrix4d inverse")
+    {
+        constexpr Math::Matrix4d m(2.0, 0.5, -1.0,  3.0,
+                                   0.0, 4.0,  1.5, -2.0,
+                                   1.0, 0.0,  3.0,  0.25,
+                                  -1.0, 2.0,  0.0,  1.0);
+
+        constexpr Math::Matrix4d m_inverse = Math::Invert(m);
+
+        REQUIRE(Math::Equal((m * m_inverse), Math::Matrix4d(1.0)));
+        REQUIRE(Math::Equal(Math::Determinant(m) * Math::Determinant(m_inverse), 1.0));
+    }
+
+    SECTION("Singular matrices")
+    {
+        Math::Matrix4f inverse(2.0f);
+
+        REQUIRE(!Math::TryInvert(MakeTestingMatrix4f(), inverse));
+        REQUIRE(Math::Equal(inverse, Math::Matrix4f(2.0f)));
+
+        Math::Matrix3f inverse3;
+        REQUIRE(!Math::TryInvert(MakeTestingMatrix3f(), inverse3));
+
+        Math::Matrix2f m(1.0f, 2.0f,
+                         2.0f, 4.001f);
+        Math::Matrix2f inverse2;
+        REQUIRE(!Math::TryInvert(m, inverse2, Math::f32(0.01f)));
+        REQUIRE(Math::TryInvert(m, inverse2));
+        REQUIRE(Math::Equal((m * inverse2), Math::Matrix2f(1.0f), Math::f32(0.01f)));
+
+        Math::Matrix4f rotation(0.0f, -1.0f, 0.0f, 0.0f,
+                                1.0f,  0.0f, 0.0f, 0.0f,
+                                0.0f,  0.0f, 1.0f, 0.0f,
+                                0.0f,  0.0f, 0.0f, 2.0f);
+        REQUIRE(Math::TryInvert(rotation, inverse));
+        REQUIRE(Math::Equal(inverse[0], Math::Vector4f(0.0f, 1.0f, 0.0f, 0.0f)));
+        REQUIRE(Math::Equal(inverse[3], Math::Vector4f(0.0f, 0.0f, 0.0f, 0.5f)));
+    }
+}
+
+TEST_CASE("Check fused matrix products", "[Math][Matrix]")
+{
+    SECTION("Matrix3f chained product")
+    {
+        Math::Matrix3f a = MakeTestingMatrix3f();
+        Math::Matrix3f b = MakeTestingMatrix3f2();
+        Math::Matrix3f c(2.0f, 0.0f, 1.0f,
+                         0.0f, 1.0f, 0.0f,
+                         1.0f, 0.0f, 3.0f);
+
+        REQUIRE(Math::Equal(Math::Multiply(a, b, c), (a * b) * c));
+        REQUIRE(Math::Equal(Math::Multiply(a, b, c, a), ((a * b) * c) * a));
+        REQUIRE(Math::Equal(Math::Multiply(a, b), a * b));
+    }
+
+    SECTION("Matrix4f chained product")
+    {
+        constexpr Math::Matrix4f a = MakeTestingMatrix4f();
+        constexpr Math::Matrix4f b = MakeTestingMatrix4f2();
+        constexpr Math::Matrix4f c(1.0f, 0.0f, 0.0f, 2.0f,
+                                   0.0f, 3.0f, 0.0f, 0.0f,
+                                   0.0f, 1.0f, 1.0f, 0.0f,
+                                   0.5f, 0.0f, 0.0f, 1.0f);
+
+        // Note(3011): The constexpr results always come from the scalar code.
+        constexpr Math::Matrix4f product = a * b;
+        constexpr Math::Matrix4f chained = Math::Multiply(a, b, c);
+
+        Math::Matrix4f x = a;
+        Math::Matrix4f y = b;
+        Math::Matrix4f z = c;
+        REQUIRE(Math::Equal(x * y, product));
+        REQUIRE(Math::Equal(Math::Multiply(x, y, z), chained));
+        REQUIRE(Math::Equal(Math::Multiply(x, y, z), product * c));
+    }
+
+    SECTION("MultiplyTransposed")
+    {
+        Math::Matrix3f a = MakeTestingMatrix3f();
+        Math::Matrix3f b = MakeTestingMatrix3f2();
+        REQUIRE(Math::Equal(Math::MultiplyTransposed(a, b), a * Math::Transpose(b)));
+
+        Math::Matrix4f c = MakeTestingMatrix4f();
+        Math::Matrix4f d = MakeTestingMatrix4f2();
+        REQUIRE(Math::Equal(Math::MultiplyTransposed(c, d), c * Math::Transpose(d)));
+
+        Math::Matrix4d e(Math::Vector4d(1.0, 2.0, 3.0, 4.0),
+                         Math::Vector4d(0.0, 1.0, 0.0, 2.0),
+                         Math::Vector4d(5.0, 0.0, 1.0, 0.0),
+                         Math::Vector4d(0.0, 3.0, 0.0, 1.0));
+        REQUIRE(Math::Equal(Math::MultiplyTransposed(e, e), e * Math::Transpose(e)));
     }
 }
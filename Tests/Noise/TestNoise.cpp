@@ -1,5 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <Math/Noise.hpp>
+#include <Math/Random.hpp>
+#include <Math/Vector.hpp>
+
+#include <span>
+#include <vector>
 
 // TODO(3011): These tests are disabled for now to speed up test run time.
 // They are not really indicative of the quality of the noise functions
@@ -132,3 +137,628 @@ TEST_CASE("Test 4D Perlin noise", "[Math][Noise]")
     }
 }
 */
+
+namespace
+{
+    template <typename Vec>
+    std::vector<Vec> MakeSamplePoints(Math::SizeType count)
+    {
+        using Float = typename Vec::ScalarType;
+
+        Math::Random64 rng(7);
+        Math::UniformDistribution<Float> distribution(Float(-40), Float(40));
+
+        std::vector<Vec> result(Math::ToUnderlying(count));
+        for (Vec& point : result)
+        {
+            for (Math::SizeType a = 0; a < Vec::Dimension; ++a)
+            {
+                point[a] = distribution(rng);
+            }
+        }
+        return result;
+    }
+
+    template <typename Vec, typename Noise>
+    void CheckEvaluate(const Noise& noise)
+    {
+        using Float = typename Vec::ScalarType;
+
+        // Note(3011): Odd count so the scalar tail is exercised as well.
+        std::vector<Vec> points = MakeSamplePoints<Vec>(203);
+        std::vector<Float> values(points.size());
+        noise.Evaluate(std::span<const Vec>(points), std::span<Float>(values));
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Math::Equal(values[i], noise(points[i]), Float(1e-5)));
+        }
+    }
+
+    template <typename Noise, typename Vec, typename Dims>
+    void CheckFillGrid(const Noise& noise, const Vec& origin, const Vec& step, const Dims& dims)
+    {
+        using Float = typename Vec::ScalarType;
+
+        Math::SizeType count = 1;
+        for (Math::SizeType a = 0; a < Vec::Dimension; ++a)
+        {
+            count *= dims[a];
+        }
+
+        std::vector<Float> values(Math::ToUnderlying(count));
+        noise.FillGrid(origin, step, dims, std::span<Float>(values));
+
+        for (Math::SizeType i = 0; i < count; ++i)
+        {
+            Vec point;
+            Math::SizeType index = i;
+            for (Math::SizeType a = 0; a < Vec::Dimension; ++a)
+            {
+                point[a] = origin[a] + Math::Cast<Float>(index % dims[a]) * step[a];
+                index /= dims[a];
+            }
+            REQUIRE(Math::Equal(values[Math::ToUnderlying(i)], noise(point), Float(1e-5)));
+        }
+    }
+
+    template <typename Vec, typename Noise>
+    void CheckRange(const Noise& noise, double slack)
+    {
+        using Float = typename Vec::ScalarType;
+
+        for (const Vec& point : MakeSamplePoints<Vec>(5000))
+        {
+            Float value = noise(point);
+            REQUIRE(value >= Float(-slack));
+            REQUIRE(value <= Float(1 + slack));
+        }
+    }
+
+    // Note(3011): Compares the analytic gradient to central differences.
+    // The value next to the gradient is computed by a separate instantiation,
+    // which the compiler may contract into multiply-adds differently, so it
+    // only has to match up to a few ulps.
+    template <typename Vec, typename Noise>
+    void CheckGradient(const Noise& noise)
+    {
+        using Float = typename Vec::ScalarType;
+        constexpr Float h = 1e-5;
+
+        for (const Vec& point : MakeSamplePoints<Vec>(500))
+        {
+            Vec gradient;
+            Float value = noise(point, gradient);
+            Float reference = noise(point);
+            REQUIRE(Math::Abs(value - reference) <= Float(1e-6) * (Math::Abs(reference) + 1));
+
+            for (Math::SizeType a = 0; a < Vec::Dimension; ++a)
+            {
+                Vec forward = point;
+                Vec backward = point;
+                forward[a] += h;
+                backward[a] -= h;
+
+                Float difference = (noise(forward) - noise(backward)) / (2 * h);
+                REQUIRE(Math::Equal(gradient[a], difference, Float(1e-5)));
+            }
+        }
+    }
+}
+
+TEST_CASE("Perlin noise batch evaluation", "[Math][Noise]")
+{
+    using namespace Math::Types;
+
+    SECTION("Evaluate matches single samples")
+    {
+        Math::Noise::Perlin<f32> noise32(42);
+        CheckEvaluate<Math::Vector2f>(noise32);
+        CheckEvaluate<Math::Vector3f>(noise32);
+        CheckEvaluate<Math::Vector4f>(noise32);
+
+        Math::Noise::Perlin<f64> noise64;
+        CheckEvaluate<Math::Vector2d>(noise64);
+        CheckEvaluate<Math::Vector3d>(noise64);
+        CheckEvaluate<Math::Vector4d>(noise64);
+    }
+
+    SECTION("FillGrid matches single samples")
+    {
+        Math::Noise::Perlin<f32> noise(3);
+        CheckFillGrid(noise, Math::Vector2f(-3.3f, 1.1f), Math::Vector2f(0.13f, 0.31f), Math::Vector2sz(37, 5));
+        CheckFillGrid(noise, Math::Vector3f(0.5f, -2.0f, 7.0f), Math::Vector3f(0.25f, 0.4f, 0.7f), Math::Vector3sz(19, 4, 3));
+        CheckFillGrid(noise, Math::Vector4f(-1.0f, 0.2f, 3.0f, -0.6f), Math::Vector4f(0.3f, 0.5f, 0.5f, 0.9f), Math::Vector4sz(9, 3, 2, 2));
+
+        Math::Noise::Perlin<f64> noise64(11);
+        CheckFillGrid(noise64, Math::Vector3d(-5.0, 0.0, 1.5), Math::Vector3d(0.1, 0.2, 0.3), Math::Vector3sz(24, 3, 2));
+    }
+}
+
+TEST_CASE("Simplex noise", "[Math][Noise]")
+{
+    using namespace Math::Types;
+
+    Math::Noise::Simplex<f64> noise(5);
+
+    SECTION("Range")
+    {
+        CheckRange<Math::Vector2d>(noise, 0.0);
+        CheckRange<Math::Vector3d>(noise, 0.0);
+        CheckRange<Math::Vector4d>(noise, 0.0);
+        CheckRange<Math::Vector3f>(Math::Noise::Simplex<f32>(), 0.0);
+    }
+
+    SECTION("Seeding")
+    {
+        Math::Noise::Simplex<f64> same(5);
+        Math::Noise::Simplex<f64> other(6);
+        Math::Vector3d point(0.3, 1.7, -2.2);
+        REQUIRE(noise(point) == same(point));
+        REQUIRE(noise(point) != other(point));
+    }
+
+    SECTION("Analytic gradients")
+    {
+        CheckGradient<Math::Vector2d>(noise);
+        CheckGradient<Math::Vector3d>(noise);
+        CheckGradient<Math::Vector4d>(noise);
+    }
+
+    SECTION("Batch evaluation")
+    {
+        CheckEvaluate<Math::Vector2d>(noise);
+        CheckEvaluate<Math::Vector4f>(Math::Noise::Simplex<f32>(1));
+        CheckFillGrid(noise, Math::Vector3d(-1.0, 2.0, 0.5), Math::Vector3d(0.2, 0.3, 0.4), Math::Vector3sz(13, 4, 3));
+
+        std::vector<Math::Vector3d> points = MakeSamplePoints<Math::Vector3d>(50);
+        std::vector<f64> values(points.size());
+        std::vector<Math::Vector3d> gradients(points.size());
+        noise.Evaluate(std::span<const Math::Vector3d>(points), std::span<f64>(values), std::span<Math::Vector3d>(gradients));
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            Math::Vector3d gradient;
+            REQUIRE(values[i] == noise(points[i], gradient));
+            REQUIRE(Math::Equal(gradients[i], gradient));
+        }
+    }
+}
+
+TEST_CASE("Worley noise", "[Math][Noise]")
+{
+    using namespace Math::Types;
+    using Math::Noise::Feature;
+    using Math::Noise::Metric;
+
+    SECTION("Features are ordered")
+    {
+        Math::Noise::Worley<f64> f1(9, Feature::F1);
+        Math::Noise::Worley<f64> f2(9, Feature::F2);
+        Math::Noise::Worley<f64> difference(9, Feature::F2MinusF1);
+        for (const Math::Vector3d& point : MakeSamplePoints<Math::Vector3d>(500))
+        {
+            REQUIRE(f1(point) >= 0.0);
+            REQUIRE(f2(point) >= f1(point));
+            REQUIRE(Math::Equal(difference(point), f2(point) - f1(point)));
+        }
+    }
+
+    SECTION("Metrics are ordered")
+    {
+        Math::Noise::Worley<f64> euclidean(4, Feature::F1, Metric::Euclidean);
+        Math::Noise::Worley<f64> manhattan(4, Feature::F1, Metric::Manhattan);
+        Math::Noise::Worley<f64> chebyshev(4, Feature::F1, Metric::Chebyshev);
+        for (const Math::Vector2d& point : MakeSamplePoints<Math::Vector2d>(500))
+        {
+            REQUIRE(chebyshev(point) <= euclidean(point));
+            REQUIRE(euclidean(point) <= manhattan(point));
+        }
+    }
+
+    SECTION("F1 is 1-Lipschitz")
+    {
+        Math::Noise::Worley<f64> noise(2);
+        Math::Vector4d offset(0.01, -0.02, 0.015, 0.005);
+        for (const Math::Vector4d& point : MakeSamplePoints<Math::Vector4d>(500))
+        {
+            REQUIRE(Math::Abs(noise(point) - noise(point + offset)) <= offset.Length() + 1e-12);
+        }
+    }
+
+    SECTION("Seeding")
+    {
+        Math::Vector2f point(0.3f, -4.1f);
+        REQUIRE(Math::Noise::Worley<f32>(1)(point) == Math::Noise::Worley<f32>(1)(point));
+        REQUIRE(Math::Noise::Worley<f32>(1)(point) != Math::Noise::Worley<f32>(2)(point));
+    }
+
+    SECTION("Batch evaluation")
+    {
+        Math::Noise::Worley<f32> noise(3, Feature::F2, Metric::Manhattan);
+        CheckEvaluate<Math::Vector3f>(noise);
+        CheckFillGrid(noise, Math::Vector2f(-2.5f, 0.5f), Math::Vector2f(0.17f, 0.4f), Math::Vector2sz(40, 6));
+        CheckFillGrid(Math::Noise::Worley<f64>(8), Math::Vector4d(0.1, -1.0, 2.0, 3.0), Math::Vector4d(0.3, 0.5, 0.5, 0.7), Math::Vector4sz(11, 3, 2, 2));
+    }
+}
+
+TEST_CASE("Perlin noise with an integer hash", "[Math][Noise]")
+{
+    using namespace Math::Types;
+
+    using HashedPerlin = Math::Noise::Perlin<f64, Math::Noise::IntegerHash>;
+
+    SECTION("Batches match single samples")
+    {
+        Math::Noise::Perlin<f32, Math::Noise::IntegerHash> noise(17);
+        CheckEvaluate<Math::Vector2f>(noise);
+        CheckEvaluate<Math::Vector3f>(noise);
+        CheckEvaluate<Math::Vector4f>(noise);
+        CheckFillGrid(noise, Math::Vector2f(-3.3f, 1.1f), Math::Vector2f(0.13f, 0.31f), Math::Vector2sz(37, 5));
+        CheckFillGrid(noise, Math::Vector3f(0.5f, -2.0f, 7.0f), Math::Vector3f(0.25f, 0.4f, 0.7f), Math::Vector3sz(19, 4, 3));
+        CheckFillGrid(noise, Math::Vector4f(-1.0f, 0.2f, 3.0f, -0.6f), Math::Vector4f(0.3f, 0.5f, 0.5f, 0.9f), Math::Vector4sz(9, 3, 2, 2));
+    }
+
+    SECTION("Values stay in range")
+    {
+        HashedPerlin noise(2);
+        CheckRange<Math::Vector2d>(noise, 0.0);
+        CheckRange<Math::Vector3d>(noise, 0.0);
+        CheckRange<Math::Vector4d>(noise, 0.0);
+    }
+
+    SECTION("The lattice is neither mirrored nor repeated")
+    {
+        HashedPerlin noise(5);
+        HashedPerlin other(6);
+
+        std::size_t repeated = 0;
+        std::size_t seeded = 0;
+        for (const Math::Vector3d& point : MakeSamplePoints<Math::Vector3d>(500))
+        {
+            Math::Vector3d mirrored = point;
+            mirrored[0] = -mirrored[0];
+
+            repeated += (noise(point) == noise(point + Math::Vector3d(256.0, 0.0, 0.0)));
+            repeated += (noise(point) == noise(mirrored));
+            seeded += (noise(point) == other(point));
+
+            Math::Vector3d left = point;
+            Math::Vector3d right = point;
+            left[0] = -1e-9;
+            right[0] = 1e-9;
+            REQUIRE(Math::Equal(noise(left), noise(right), f64(1e-6)));
+        }
+        REQUIRE(repeated == 0);
+        REQUIRE(seeded == 0);
+    }
+
+    SECTION("Periods are not limited to the permutation")
+    {
+        HashedPerlin noise(8, Math::Vector2sz(300, 1000));
+        for (const Math::Vector2d& point : MakeSamplePoints<Math::Vector2d>(500))
+        {
+            REQUIRE(Math::Equal(noise(point), noise(point + Math::Vector2d(300.0, -1000.0)), f64(1e-9)));
+        }
+        REQUIRE(noise(Math::Vector2d(0.3, 0.6)) != noise(Math::Vector2d(256.3, 0.6)));
+    }
+}
+
+TEST_CASE("Periodic noise and texture baking", "[Math][Noise]")
+{
+    using namespace Math::Types;
+
+    SECTION("Periodic Perlin noise repeats")
+    {
+        Math::Noise::Perlin<f64> noise2(3, Math::Vector2sz(4, 6));
+        for (const Math::Vector2d& point : MakeSamplePoints<Math::Vector2d>(500))
+        {
+            REQUIRE(Math::Equal(noise2(point), noise2(point + Math::Vector2d(4.0, 0.0)), f64(1e-9)));
+            REQUIRE(Math::Equal(noise2(point), noise2(point - Math::Vector2d(8.0, 12.0)), f64(1e-9)));
+        }
+
+        // Note(3011): Periods larger than the permutation still wrap.
+        Math::Noise::Perlin<f64> noise4(5, Math::Vector4sz(3, 1, 300, 7));
+        for (const Math::Vector4d& point : MakeSamplePoints<Math::Vector4d>(500))
+        {
+            REQUIRE(Math::Equal(noise4(point), noise4(point + Math::Vector4d(3.0, -1.0, 300.0, 14.0)), f64(1e-9)));
+        }
+    }
+
+    SECTION("A period of 0 keeps the classic lattice")
+    {
+        Math::Noise::Perlin<f32> classic(9);
+        Math::Noise::Perlin<f32> unwrapped(9, Math::Vector3sz(0, 0, 0));
+        Math::Noise::Perlin<f32> partial(9, Math::Vector3sz(0, 5, 0));
+        for (const Math::Vector3f& point : MakeSamplePoints<Math::Vector3f>(500))
+        {
+            REQUIRE(unwrapped(point) == classic(point));
+            REQUIRE(Math::Equal(partial(point), partial(point + Math::Vector3f(0.0f, 5.0f, 0.0f)), f32(1e-5f)));
+        }
+    }
+
+    SECTION("Periodic batches match single samples")
+    {
+        Math::Noise::Perlin<f32> noise(1, Math::Vector4sz(5, 3, 2, 4));
+        CheckEvaluate<Math::Vector2f>(noise);
+        CheckEvaluate<Math::Vector3f>(noise);
+        CheckEvaluate<Math::Vector4f>(noise);
+        CheckFillGrid(noise, Math::Vector2f(-3.3f, 1.1f), Math::Vector2f(0.13f, 0.31f), Math::Vector2sz(77, 5));
+        CheckFillGrid(noise, Math::Vector3f(0.5f, -2.0f, 7.0f), Math::Vector3f(0.25f, 0.4f, 0.7f), Math::Vector3sz(19, 4, 3));
+    }
+
+    SECTION("Baked textures tile")
+    {
+        const Math::Vector2d extent(4.0, 2.0);
+        const Math::Vector2sz dims(256, 64);
+        Math::Noise::Perlin<f64> noise(7, Math::Vector2sz(4, 2));
+
+        std::vector<f64> parallel(256 * 64);
+        std::vector<f64> sequential(256 * 64);
+        Math::Noise::Bake(noise, extent, dims, std::span<f64>(parallel));
+        Math::Noise::Bake<Math::Execution::Sequential>(noise, extent, dims, std::span<f64>(sequential));
+        REQUIRE(parallel == sequential);
+
+        // Note(3011): The texel before the first one in a row or column is
+        // the last one, so every edge lines up with the opposite edge.
+        const Math::Vector2d texel(4.0 / 256.0, 2.0 / 64.0);
+        for (Math::SizeType y = 0; y < 64; ++y)
+        {
+            const f64 center = (Math::Cast<f64>(y) + 0.5) * texel[1];
+            const std::size_t row = Math::ToUnderlying(y) * 256;
+            REQUIRE(Math::Equal(parallel[row], noise(Math::Vector2d(texel[0] / 2, center)), f64(1e-9)));
+            REQUIRE(Math::Equal(parallel[row + 255], noise(Math::Vector2d(-texel[0] / 2, center)), f64(1e-9)));
+        }
+        for (Math::SizeType x = 0; x < 256; ++x)
+        {
+            const f64 center = (Math::Cast<f64>(x) + 0.5) * texel[0];
+            REQUIRE(Math::Equal(parallel[Math::ToUnderlying(x) + 63 * 256], noise(Math::Vector2d(center, -texel[1] / 2)), f64(1e-9)));
+        }
+    }
+
+    SECTION("Noises without a grid API are baked point-wise")
+    {
+        Math::Noise::Layer<f32, Math::Noise::Perlin> layer(2);
+        const Math::Vector3f extent(2.0f, 3.0f, 1.0f);
+        const Math::Vector3sz dims(32, 24, 8);
+
+        std::vector<f32> values(32 * 24 * 8);
+        Math::Noise::Bake(layer, extent, dims, std::span<f32>(values));
+
+        std::size_t i = 0;
+        for (Math::SizeType z = 0; z < 8; ++z)
+        {
+            for (Math::SizeType y = 0; y < 24; ++y)
+            {
+                for (Math::SizeType x = 0; x < 32; ++x)
+                {
+                    const Math::Vector3f point((Math::Cast<f32>(x) + 0.5f) * (2.0f / 32.0f),
+                                               (Math::Cast<f32>(y) + 0.5f) * (3.0f / 24.0f),
+                                               (Math::Cast<f32>(z) + 0.5f) * (1.0f / 8.0f));
+                    REQUIRE(Math::Equal(values[i++], layer(point), f32(1e-5f)));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Noise field generator", "[Math][Noise]")
+{
+    using namespace Math::Types;
+
+    using Generator = Math::Noise::FieldGenerator<Math::Noise::Perlin<f64>>;
+
+    Generator::SettingsType settings;
+    settings.ChunkSize = 8;
+    settings.Capacity = 64;
+    settings.Spacing = 0.37;
+
+    const Math::Vector3l begin(-5, 3, -12);
+    const Math::Vector3sz dims(20, 7, 12);
+    std::vector<f64> values(20 * 7 * 12);
+
+    SECTION("Volumes match single samples")
+    {
+        Generator generator(settings);
+        Math::Noise::Perlin<f64> noise(4);
+        generator.Generate(4, begin, dims, 1, std::span<f64>(values));
+
+        std::size_t i = 0;
+        for (i64 z = 0; z < 12; ++z)
+        {
+            for (i64 y = 0; y < 7; ++y)
+            {
+                for (i64 x = 0; x < 20; ++x)
+                {
+                    const Math::Vector3d point(Math::Cast<f64>(begin[0] + x), Math::Cast<f64>(begin[1] + y), Math::Cast<f64>(begin[2] + z));
+                    REQUIRE(Math::Equal(values[i++], noise(point * 0.74), f64(1e-9)));
+                }
+            }
+        }
+    }
+
+    SECTION("Overlapping requests are served from the cache")
+    {
+        Generator generator(settings);
+
+        // Note(3011): x spans chunks -1 to 1, y chunks 0 and 1, z chunks
+        // -2 and -1, which makes 12 chunks.
+        generator.Generate(1, begin, dims, 0, std::span<f64>(values));
+        REQUIRE(generator.Misses() == 12);
+        REQUIRE(generator.Hits() == 0);
+        REQUIRE(generator.Size() == 12);
+
+        std::vector<f64> again(values.size());
+        generator.Generate(1, begin, dims, 0, std::span<f64>(again));
+        REQUIRE(generator.Misses() == 12);
+        REQUIRE(generator.Hits() == 12);
+        REQUIRE(again == values);
+
+        // Note(3011): Shifting by one chunk along x adds a new column of 4.
+        generator.Generate(1, begin + Math::Vector3l(8, 0, 0), dims, 0, std::span<f64>(again));
+        REQUIRE(generator.Misses() == 16);
+        REQUIRE(generator.Hits() == 20);
+
+        generator.Generate(2, begin, dims, 0, std::span<f64>(again));
+        generator.Generate(1, begin, dims, 1, std::span<f64>(again));
+        REQUIRE(generator.Misses() == 40);
+        REQUIRE(generator.Size() == 40);
+    }
+
+    SECTION("The least recently used chunks are evicted")
+    {
+        settings.Capacity = 10;
+        Generator generator(settings);
+        generator.Generate(1, begin, dims, 0, std::span<f64>(values));
+        REQUIRE(generator.Size() == 10);
+
+        Generator reference(settings);
+        Generator::ChunkType first = reference.Chunk(1, Math::Vector3l(-1, 0, -2), 0);
+        REQUIRE(*generator.Chunk(1, Math::Vector3l(-1, 0, -2), 0) == *first);
+
+        // Note(3011): The first two chunks were evicted, the last ones are
+        // still cached.
+        REQUIRE(generator.Misses() == 13);
+        (void)generator.Chunk(1, Math::Vector3l(1, 1, -1), 0);
+        REQUIRE(generator.Misses() == 13);
+
+        generator.Clear();
+        REQUIRE(generator.Size() == 0);
+    }
+
+    SECTION("Coarse LODs step by more than 2^32")
+    {
+        Generator generator(settings);
+        Math::Noise::Perlin<f64> noise(2);
+
+        const f64 step = 0.37 * 0x1.0p40;
+        const std::vector<f64>& chunk = *generator.Chunk(2, Math::Vector3l(1, 0, -1), 40);
+        REQUIRE(Math::Equal(chunk[0], noise(Math::Vector3d(8 * step, 0.0, -8 * step)), f64(1e-9)));
+        REQUIRE(Math::Equal(chunk[1], noise(Math::Vector3d(9 * step, 0.0, -8 * step)), f64(1e-9)));
+    }
+
+    SECTION("Noises built by a factory")
+    {
+        using Layer = Math::Noise::Layer<f64, Math::Noise::Perlin>;
+
+        Math::Noise::LayerSettings<f64> ridged;
+        ridged.Octaves = 3;
+        ridged.Frequency = 0.25;
+        ridged.Mode = Math::Noise::Fractal::Ridged;
+
+        Math::Noise::FieldGenerator<Layer> generator([&ridged](u64 seed) { return Layer(seed, ridged); }, settings);
+        generator.Generate(5, begin, dims, 0, std::span<f64>(values));
+
+        const Layer layer(5, ridged);
+        const Layer defaults(5);
+        bool differs = false;
+        std::size_t i = 0;
+        for (i64 z = 0; z < 12; ++z)
+        {
+            for (i64 y = 0; y < 7; ++y)
+            {
+                for (i64 x = 0; x < 20; ++x)
+                {
+                    const Math::Vector3d point(Math::Cast<f64>(begin[0] + x), Math::Cast<f64>(begin[1] + y), Math::Cast<f64>(begin[2] + z));
+                    REQUIRE(Math::Equal(values[i], layer(point * 0.37), f64(1e-9)));
+                    differs = differs || !Math::Equal(values[i], defaults(point * 0.37), f64(1e-6));
+                    ++i;
+                }
+            }
+        }
+        REQUIRE(differs);
+
+        // Note(3011): The seed stays part of the cache key.
+        generator.Generate(6, begin, dims, 0, std::span<f64>(values));
+        REQUIRE(generator.Hits() == 0);
+        REQUIRE(Math::Equal(values[0], Layer(6, ridged)(Math::Vector3d(-5.0, 3.0, -12.0) * 0.37), f64(1e-9)));
+    }
+
+    SECTION("Noises without a grid API")
+    {
+        Math::Noise::FieldGenerator<Math::Noise::Layer<f32, Math::Noise::Simplex>> generator;
+        Math::Noise::Layer<f32, Math::Noise::Simplex> layer(3);
+
+        std::vector<f32> field(40 * 3 * 2);
+        generator.Generate(3, Math::Vector3l(-20, 0, 7), Math::Vector3sz(40, 3, 2), 0, std::span<f32>(field));
+
+        std::size_t i = 0;
+        for (i64 z = 7; z < 9; ++z)
+        {
+            for (i64 y = 0; y < 3; ++y)
+            {
+                for (i64 x = -20; x < 20; ++x)
+                {
+                    REQUIRE(Math::Equal(field[i++], layer(Math::Vector3f(Math::Cast<f32>(x), Math::Cast<f32>(y), Math::Cast<f32>(z))), f32(1e-5f)));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Fractal noise layers", "[Math][Noise]")
+{
+    using namespace Math::Types;
+    using Math::Noise::Fractal;
+
+    using Settings = Math::Noise::LayerSettings<f64>;
+
+    SECTION("A single octave is the base noise")
+    {
+        Settings settings;
+        settings.Octaves = 1;
+
+        Math::Noise::Layer<f64, Math::Noise::Perlin> layer(7, settings);
+        Math::Noise::Perlin<f64> perlin(7);
+        for (const Math::Vector3d& point : MakeSamplePoints<Math::Vector3d>(100))
+        {
+            REQUIRE(Math::Equal(layer(point), perlin(point)));
+        }
+    }
+
+    SECTION("Every mode stays in range")
+    {
+        for (Fractal mode : { Fractal::FBm, Fractal::Ridged, Fractal::Billow, Fractal::Turbulence })
+        {
+            Settings settings;
+            settings.Mode = mode;
+
+            CheckRange<Math::Vector2d>(Math::Noise::Layer<f64, Math::Noise::Simplex>(1, settings), 0.0);
+            CheckRange<Math::Vector3d>(Math::Noise::Layer<f64, Math::Noise::Simplex>(2, settings), 0.0);
+        }
+    }
+
+    SECTION("Octave cutoff")
+    {
+        Settings settings;
+        Settings twoOctaves;
+        twoOctaves.Octaves = 2;
+
+        Math::Noise::Layer<f64, Math::Noise::Simplex> layer(3, settings);
+        Math::Noise::Layer<f64, Math::Noise::Simplex> reference(3, twoOctaves);
+        for (const Math::Vector2d& point : MakeSamplePoints<Math::Vector2d>(100))
+        {
+            REQUIRE(Math::Equal(layer(point, 0.125), reference(point)));
+            REQUIRE(layer(point, 100.0) == 0.5);
+        }
+    }
+
+    SECTION("Batch evaluation")
+    {
+        Settings settings;
+        settings.Mode = Fractal::Ridged;
+        settings.Warp = 0.5;
+        settings.Frequency = 0.3;
+
+        Math::Noise::Layer<f32, Math::Noise::Perlin> perlin(5, Math::Noise::LayerSettings<f32>());
+        Math::Noise::Layer<f64, Math::Noise::Simplex> simplex(5, settings);
+        Math::Noise::Layer<f64, Math::Noise::Worley> worley(5, settings);
+        CheckEvaluate<Math::Vector3f>(perlin);
+        CheckEvaluate<Math::Vector4d>(simplex);
+        CheckEvaluate<Math::Vector2d>(worley);
+
+        Settings unwarped = settings;
+        unwarped.Warp = 0;
+        Math::Vector2d point(1.5, -0.25);
+        REQUIRE(Math::Noise::Layer<f64, Math::Noise::Simplex>(5, unwarped)(point) != simplex(point));
+    }
+}
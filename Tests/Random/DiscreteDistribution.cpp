@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+namespace
+{
+    // Note(3011): Compares the frequencies of the drawn indices with the
+    // normalized weights.
+    template <typename Dist>
+    void CheckFrequencies(const Dist& distribution, const std::vector<f32>& weights, int count)
+    {
+        double total = 0;
+        for (f32 weight : weights)
+        {
+            total += static_cast<double>(Math::ToUnderlying(weight));
+        }
+
+        Math::Random64 rng(7);
+        std::vector<int> histogram(weights.size());
+        for (int i = 0; i < count; ++i)
+        {
+            ++histogram[Math::ToUnderlying(distribution(rng))];
+        }
+
+        for (std::size_t i = 0; i < weights.size(); ++i)
+        {
+            const double p = static_cast<double>(Math::ToUnderlying(weights[i])) / total;
+            const double frequency = static_cast<double>(histogram[i]) / count;
+            REQUIRE(std::abs(frequency - p) <= 5 * std::sqrt(p / count));
+        }
+    }
+}
+
+TEST_CASE("DiscreteDistribution", "[Math][Random]")
+{
+    SECTION("Frequencies follow the weights")
+    {
+        const std::vector<f32> weights = { 1.0f, 0.0f, 3.0f, 0.5f, 10.0f, 2.0f, 0.0f, 0.25f, 7.0f };
+        const Math::DiscreteDistribution<f32> distribution(weights);
+        REQUIRE(distribution.Size() == weights.size());
+        CheckFrequencies(distribution, weights, 1000000);
+    }
+
+    SECTION("Many weights")
+    {
+        // Note(3011): Few heavy indices among many light ones, so most heavy
+        // indices spill into the next one.
+        Math::Random32 rng(1);
+        Math::UniformDistribution<f32> uniform(f32(0.0f), f32(1.0f));
+
+        std::vector<f32> weights(1000);
+        for (std::size_t i = 0; i < weights.size(); ++i)
+        {
+            weights[i] = (i % 97 == 0) ? f32(40.0f) : uniform(rng);
+        }
+
+        const Math::DiscreteDistribution<f32> distribution(weights);
+        CheckFrequencies(distribution, weights, 2000000);
+    }
+
+    SECTION("Equal and zero weights")
+    {
+        const std::vector<f32> equal(3, f32(1.0f));
+        CheckFrequencies(Math::DiscreteDistribution<f32>(equal), equal, 300000);
+
+        const std::vector<f32> zero(4, f32(0.0f));
+        const Math::DiscreteDistribution<f32> distribution(zero);
+        REQUIRE(distribution.PDF(2) == f32(0.25f));
+        CheckFrequencies(distribution, std::vector<f32>(4, f32(1.0f)), 400000);
+    }
+
+    SECTION("Samples carry their probability")
+    {
+        const std::vector<f64> weights = { 2.0, 6.0, 0.0, 8.0 };
+        const Math::DiscreteDistribution<f64> distribution(weights);
+
+        REQUIRE(distribution.PDF(0) == f64(0.125));
+        REQUIRE(distribution.PDF(1) == f64(0.375));
+        REQUIRE(distribution.PDF(2) == f64(0.0));
+        REQUIRE(distribution.PDF(3) == f64(0.5));
+
+        Math::Random32 rng(3);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto sample = distribution.Sample(rng);
+            REQUIRE(sample.Index != 2);
+            REQUIRE(sample.PDF == distribution.PDF(sample.Index));
+        }
+    }
+
+    SECTION("Parallel rebuild builds the same table")
+    {
+        Math::Random64 rng(5);
+        Math::ExponentialDistribution<f32> exponential(f32(1.0f), f32(0.0f));
+
+        std::vector<f32> weights(std::size_t(1) << 20);
+        for (f32& weight : weights)
+        {
+            weight = exponential(rng);
+        }
+
+        Math::DiscreteDistribution<f32> sequential;
+        sequential.Rebuild<Math::Execution::Sequential>(weights);
+        Math::DiscreteDistribution<f32> parallel;
+        parallel.Rebuild<Math::Execution::Parallel>(weights);
+
+        Math::Random64 a(6);
+        Math::Random64 b(6);
+        for (int i = 0; i < 100000; ++i)
+        {
+            REQUIRE(sequential(a) == parallel(b));
+        }
+    }
+}
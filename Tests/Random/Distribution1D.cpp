@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+TEST_CASE("Distribution1D", "[Math][Random]")
+{
+    const std::vector<f32> function = { 1.0f, 3.0f, 0.0f, 4.0f };
+    const Math::Distribution1D<f32> distribution(function);
+
+    SECTION("Inverts the CDF")
+    {
+        REQUIRE(distribution.Size() == 4);
+        REQUIRE(distribution.Integral() == f32(2.0f));
+
+        const auto start = distribution.SampleContinuous(f32(0.0f));
+        REQUIRE(start.Index == 0);
+        REQUIRE(start.Value == f32(0.0f));
+        REQUIRE(start.PDF == f32(0.5f));
+
+        const auto middle = distribution.SampleContinuous(f32(0.3125f));
+        REQUIRE(middle.Index == 1);
+        REQUIRE(middle.Value == f32(0.375f));
+        REQUIRE(middle.PDF == f32(1.5f));
+
+        // Note(3011): The CDF ends the second piece at 0.5, the empty third
+        // piece is skipped.
+        const auto skip = distribution.SampleContinuous(f32(0.5f));
+        REQUIRE(skip.Index == 3);
+        REQUIRE(skip.Value == f32(0.75f));
+        REQUIRE(skip.PDF == f32(2.0f));
+
+        const auto end = distribution.SampleContinuous(f32(0.99999994f));
+        REQUIRE(end.Index == 3);
+        REQUIRE(end.Value < f32(1.0f));
+    }
+
+    SECTION("Discrete probabilities")
+    {
+        REQUIRE(distribution.DiscretePDF(0) == f32(0.125f));
+        REQUIRE(distribution.DiscretePDF(1) == f32(0.375f));
+        REQUIRE(distribution.DiscretePDF(2) == f32(0.0f));
+        REQUIRE(distribution.DiscretePDF(3) == f32(0.5f));
+
+        const auto sample = distribution.SampleDiscrete(f32(0.7f));
+        REQUIRE(sample.Index == 3);
+        REQUIRE(sample.PDF == f32(0.5f));
+    }
+
+    SECTION("Samples are monotonic in u and consistent with the PDF")
+    {
+        // Note(3011): Spikes and runs of empty pieces, so the guide table
+        // has ranges with many pieces and pieces spanning many ranges.
+        Math::Random64 rng(1);
+        Math::UniformUnitDistribution<f32> unit;
+
+        std::vector<f32> values(777);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            const f32 u = unit(rng);
+            values[i] = (i % 50 == 0) ? f32(500.0f) * u : (u < f32(0.3f) ? f32(0.0f) : u);
+        }
+        const Math::Distribution1D<f32> spiky(values);
+
+        f32 previous = 0;
+        for (int i = 0; i < 100000; ++i)
+        {
+            const f32 u = Math::Cast<f32>(i) / f32(100000.0f);
+            const auto sample = spiky.SampleContinuous(u);
+
+            REQUIRE(sample.Value >= previous);
+            REQUIRE(values[Math::ToUnderlying(sample.Index)] > f32(0.0f));
+            REQUIRE(sample.PDF == spiky.PDF(sample.Value));
+            previous = sample.Value;
+        }
+    }
+
+    SECTION("Frequencies follow the function")
+    {
+        Math::Random64 rng(2);
+        std::vector<f32> samples(400000);
+        Math::Generate(rng, distribution, std::span<f32>(samples));
+
+        std::vector<int> histogram(4);
+        for (f32 sample : samples)
+        {
+            ++histogram[static_cast<std::size_t>(Math::ToUnderlying(sample) * 4)];
+        }
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            const double p = static_cast<double>(Math::ToUnderlying(function[i])) / 8;
+            const double frequency = static_cast<double>(histogram[i]) / static_cast<double>(samples.size());
+            REQUIRE(std::abs(frequency - p) <= 5 * std::sqrt(p / static_cast<double>(samples.size())));
+        }
+    }
+
+    SECTION("Empty function")
+    {
+        const Math::Distribution1D<f32> empty(std::vector<f32>{});
+        REQUIRE(empty.Size() == 0);
+        REQUIRE(empty.PDF(f32(0.5f)) == f32(0.0f));
+        REQUIRE(empty.DiscretePDF(0) == f32(0.0f));
+        REQUIRE(Math::Distribution1D<f64>().PDF(f64(0.5)) == f64(0.0));
+        REQUIRE(Math::Distribution1D<f64>().DiscretePDF(0) == f64(0.0));
+    }
+
+    SECTION("Zero function")
+    {
+        const Math::Distribution1D<f64> uniform(std::vector<f64>(5, f64(0.0)));
+        REQUIRE(uniform.PDF(f64(0.3)) == f64(1.0));
+        REQUIRE(uniform.SampleContinuous(f64(0.3)).Value == f64(0.3));
+    }
+}
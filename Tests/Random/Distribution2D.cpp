@@ -0,0 +1,87 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+TEST_CASE("Distribution2D", "[Math][Random]")
+{
+    // Note(3011): Three rows of four, the middle row is empty.
+    const std::vector<f32> values = {
+        1.0f, 2.0f, 3.0f, 2.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,
+        4.0f, 0.0f, 0.0f, 8.0f,
+    };
+    const Math::Distribution2D<f32> distribution(values, 4, 3);
+
+    SECTION("Size and integral")
+    {
+        REQUIRE(distribution.Width() == 4);
+        REQUIRE(distribution.Height() == 3);
+        REQUIRE(std::abs(Math::ToUnderlying(distribution.Integral()) - 20.0f / 12.0f) < 1e-6f);
+    }
+
+    SECTION("Empty grids")
+    {
+        const Math::Distribution2D<f32> empty(values, 0, 3);
+        REQUIRE(empty.Width() == 0);
+        REQUIRE(empty.Height() == 0);
+        REQUIRE(empty.PDF(Math::Vector2f(0.5f, 0.5f)) == f32(0.0f));
+        REQUIRE(Math::Distribution2D<f32>(std::vector<f32>(), 4, 0).PDF(Math::Vector2f(0.5f, 0.5f)) == f32(0.0f));
+        REQUIRE(Math::Distribution2D<f32>().PDF(Math::Vector2f(0.5f, 0.5f)) == f32(0.0f));
+        REQUIRE(Math::Distribution2D<f32>().DiscretePDF(Math::Vector2sz(0, 0)) == f32(0.0f));
+    }
+
+    SECTION("PDF is the normalized function")
+    {
+        for (SizeType y = 0; y < 3; ++y)
+        {
+            for (SizeType x = 0; x < 4; ++x)
+            {
+                const Math::Vector2f center((Math::Cast<f32>(x) + f32(0.5f)) / f32(4.0f), (Math::Cast<f32>(y) + f32(0.5f)) / f32(3.0f));
+                const f32 value = values[Math::ToUnderlying(y * 4 + x)];
+                REQUIRE(std::abs(Math::ToUnderlying(distribution.PDF(center) - value * f32(12.0f) / f32(20.0f))) < 1e-6f);
+                REQUIRE(std::abs(Math::ToUnderlying(distribution.DiscretePDF(Math::Vector2sz(x, y)) - value / f32(20.0f))) < 1e-6f);
+            }
+        }
+    }
+
+    SECTION("Samples follow the function")
+    {
+        Math::Random64 rng(3);
+
+        const int count = 600000;
+        std::vector<int> histogram(12);
+        for (int i = 0; i < count; ++i)
+        {
+            const auto sample = distribution.SampleContinuous(rng);
+            REQUIRE(sample.PDF == distribution.PDF(sample.Value));
+
+            const std::size_t x = static_cast<std::size_t>(Math::ToUnderlying(sample.Value.x) * 4);
+            const std::size_t y = static_cast<std::size_t>(Math::ToUnderlying(sample.Value.y) * 3);
+            REQUIRE(sample.Index.x == x);
+            REQUIRE(sample.Index.y == y);
+            ++histogram[y * 4 + x];
+        }
+
+        for (std::size_t i = 0; i < histogram.size(); ++i)
+        {
+            const double p = static_cast<double>(Math::ToUnderlying(values[i])) / 20;
+            const double frequency = static_cast<double>(histogram[i]) / count;
+            REQUIRE(std::abs(frequency - p) <= 5 * std::sqrt(p / count));
+        }
+    }
+
+    SECTION("Discrete samples")
+    {
+        Math::Random32 rng(4);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto sample = distribution.SampleDiscrete(rng);
+            REQUIRE(sample.Index.y != 1);
+            REQUIRE(sample.PDF == distribution.DiscretePDF(sample.Index));
+        }
+    }
+}
@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Packet.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <functional>
+
+using namespace Math::Types;
+
+namespace
+{
+    struct Moments
+    {
+        double Mean = 0;
+        double Variance = 0;
+
+        // Note(3011): Fraction of the samples above the threshold.
+        double Above = 0;
+    };
+
+    Moments Measure(const std::function<double()>& sample, int count, double threshold)
+    {
+        double sum = 0;
+        double squares = 0;
+        int above = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const double value = sample();
+            sum += value;
+            squares += value * value;
+            above += (value > threshold) ? 1 : 0;
+        }
+
+        Moments result;
+        result.Mean = sum / count;
+        result.Variance = squares / count - result.Mean * result.Mean;
+        result.Above = static_cast<double>(above) / count;
+        return result;
+    }
+
+    void CheckMoments(const Moments& moments, double mean, double variance, double above)
+    {
+        REQUIRE(std::abs(moments.Mean - mean) < 0.01 * std::sqrt(variance) + 1e-9);
+        REQUIRE(std::abs(moments.Variance - variance) < 0.02 * variance);
+        REQUIRE(std::abs(moments.Above - above) < 0.1 * above + 1e-4);
+    }
+
+    constexpr int Count = 400000;
+}
+
+TEST_CASE("Ziggurat tables", "[Math][Random]")
+{
+    namespace Ziggurat = Math::Implementation::Ziggurat;
+
+    for (double x : { -20.0, -3.5, -0.3, 0.0, 0.7, 2.0, 12.5 })
+    {
+        REQUIRE(std::abs(Math::ToUnderlying(Ziggurat::Exp(f64(x))) / std::exp(x) - 1) < 1e-14);
+    }
+    for (double x : { 1e-12, 0.01, 0.5, 1.0, 1.7, 300.0 })
+    {
+        REQUIRE(std::abs(Math::ToUnderlying(Ziggurat::Log(f64(x))) - std::log(x)) < 1e-14);
+    }
+
+    // Note(3011): The top layer has to end at x = 0 with the area of the
+    // other layers.
+    constexpr const auto& normal = Ziggurat::Tables<f64, Ziggurat::Normal>;
+    const double top = Math::ToUnderlying(normal.Width[127] * 0x1.0p53 * (f64(1) - normal.Height[127]));
+    REQUIRE(std::abs(top / Math::ToUnderlying(Ziggurat::Normal::V) - 1) < 1e-6);
+
+    constexpr const auto& exponential = Ziggurat::Tables<f32, Ziggurat::Exponential>;
+    STATIC_REQUIRE(exponential.Accept[255] == u32(0));
+    STATIC_REQUIRE(exponential.Accept[1] > u32(0x00E00000));
+}
+
+TEST_CASE("Continuous distributions", "[Math][Random]")
+{
+    SECTION("Normal")
+    {
+        Math::Random64 rng(1);
+        const Math::NormalDistribution<f64> standard;
+        CheckMoments(Measure([&]() { return Math::ToUnderlying(standard(rng)); }, Count, 1.0), 0.0, 1.0, 0.158655);
+        CheckMoments(Measure([&]() { return Math::ToUnderlying(standard(rng)); }, Count, 3.5), 0.0, 1.0, 2.326e-4);
+
+        Math::Random32 rng32(2);
+        const Math::NormalDistribution<f32> shifted(f32(3.0f), f32(0.5f));
+        CheckMoments(Measure([&]() { return double(Math::ToUnderlying(shifted(rng32))); }, Count, 3.5), 3.0, 0.25, 0.158655);
+    }
+
+    SECTION("Exponential")
+    {
+        Math::Random64 rng(3);
+        const Math::ExponentialDistribution<f32> standard;
+        CheckMoments(Measure([&]() { return double(Math::ToUnderlying(standard(rng))); }, Count, 1.0), 1.0, 1.0, std::exp(-1.0));
+        CheckMoments(Measure([&]() { return double(Math::ToUnderlying(standard(rng))); }, Count, 8.0), 1.0, 1.0, std::exp(-8.0));
+
+        const Math::ExponentialDistribution<f64> shifted(f64(4.0), f64(-1.0));
+        REQUIRE(shifted.Rate() == f64(4.0));
+        CheckMoments(Measure([&]() { return Math::ToUnderlying(shifted(rng)); }, Count, 0.0), -0.75, 1.0 / 16, std::exp(-4.0));
+    }
+
+    SECTION("Gamma")
+    {
+        Math::Random64 rng(4);
+        for (double shape : { 0.4, 1.0, 2.5, 9.0 })
+        {
+            const Math::GammaDistribution<f64> gamma(f64(shape), f64(2.0));
+            const Moments moments = Measure([&]() { return Math::ToUnderlying(gamma(rng)); }, Count, 0.0);
+            CheckMoments(moments, 2.0 * shape, 4.0 * shape, 1.0);
+        }
+    }
+
+    SECTION("Beta")
+    {
+        Math::Random64 rng(5);
+        for (auto [a, b] : { std::pair(0.5, 0.5), std::pair(2.0, 5.0), std::pair(1.0, 1.0) })
+        {
+            const Math::BetaDistribution<f32> beta(Math::Cast<f32>(a), Math::Cast<f32>(b));
+            const Moments moments = Measure([&]() { return double(Math::ToUnderlying(beta(rng))); }, Count, 0.5);
+
+            const double variance = a * b / ((a + b) * (a + b) * (a + b + 1));
+            REQUIRE(std::abs(moments.Mean - a / (a + b)) < 0.01 * std::sqrt(variance));
+            REQUIRE(std::abs(moments.Variance - variance) < 0.02 * variance);
+        }
+    }
+
+    SECTION("Beta with small shapes")
+    {
+        // Note(3011): Almost all of the mass sits next to 0 and 1, the
+        // gamma samples of both shapes underflow in f32.
+        Math::Random64 rng(8);
+        for (auto [a, b] : { std::pair(0.01, 0.01), std::pair(0.05, 0.2), std::pair(0.5, 0.5) })
+        {
+            const Math::BetaDistribution<f32> beta(Math::Cast<f32>(a), Math::Cast<f32>(b));
+            bool valid = true;
+            const Moments moments = Measure([&]()
+            {
+                const f32 value = beta(rng);
+                valid = valid && value >= f32(0.0f) && value <= f32(1.0f);
+                return double(Math::ToUnderlying(value));
+            }, Count, 0.5);
+            REQUIRE(valid);
+
+            const double variance = a * b / ((a + b) * (a + b) * (a + b + 1));
+            REQUIRE(std::abs(moments.Mean - a / (a + b)) < 0.01 * std::sqrt(variance));
+            REQUIRE(std::abs(moments.Variance - variance) < 0.02 * variance);
+        }
+    }
+
+    SECTION("Packets")
+    {
+        Math::Xoshiro256StarStarX4 rng(6);
+        const Math::NormalDistribution<f64> normal(f64(1.0), f64(2.0));
+        const Math::ExponentialDistribution<f32> exponential(f32(0.5f));
+
+        Math::Packet<f64, 4> normals;
+        Math::Packet<f32, 4> exponentials;
+        SizeType lane = 0;
+        const Moments n = Measure([&]()
+        {
+            if (lane % 4 == 0)
+            {
+                normals = normal(rng);
+            }
+            return Math::ToUnderlying(normals[lane++ % 4]);
+        }, Count, 3.0);
+        CheckMoments(n, 1.0, 4.0, 0.158655);
+
+        Math::Xoshiro128StarStarX8 rng8(7);
+        lane = 0;
+        const Moments e = Measure([&]()
+        {
+            if (lane % 4 == 0)
+            {
+                exponentials = Math::Packet<f32, 4>(exponential(rng8)[0], exponential(rng8)[3], exponential(rng8)[5], exponential(rng8)[7]);
+            }
+            return double(Math::ToUnderlying(exponentials[lane++ % 4]));
+        }, Count, 2.0);
+        CheckMoments(e, 2.0, 4.0, std::exp(-1.0));
+    }
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <vector>
+
+using namespace Math::Types;
+
+namespace
+{
+    // Note(3011): Draws into a buffer with Generate and checks every value
+    // against the inclusive range and that every value of a small range
+    // shows up about equally often.
+    template <typename T>
+    void CheckBoundedIntegers(T begin, T end, std::size_t count)
+    {
+        Math::Random64 rng(3);
+        Math::UniformDistribution<T> distribution(begin, end);
+
+        std::vector<T> values(count);
+        Math::Generate(rng, distribution, values);
+
+        const std::size_t range = static_cast<std::size_t>(Math::ToUnderlying(end) - Math::ToUnderlying(begin)) + 1;
+        std::vector<std::size_t> histogram(range);
+        for (T value : values)
+        {
+            REQUIRE(value >= begin);
+            REQUIRE(value <= end);
+            ++histogram[static_cast<std::size_t>(Math::ToUnderlying(value) - Math::ToUnderlying(begin))];
+        }
+
+        const double expected = static_cast<double>(count) / static_cast<double>(range);
+        for (std::size_t hits : histogram)
+        {
+            REQUIRE(static_cast<double>(hits) > expected * 0.9);
+            REQUIRE(static_cast<double>(hits) < expected * 1.1);
+        }
+    }
+}
+
+TEST_CASE("MultiplyExtended", "[Math][Random]")
+{
+    u64 high = 0;
+    REQUIRE(Math::MultiplyExtended(u64::Max(), u64::Max(), high) == u64(1));
+    REQUIRE(high == u64::Max() - 1);
+    REQUIRE(Math::MultiplyExtended(u64(0x123456789ABCDEF0), u64(0x10), high) == u64(0x23456789ABCDEF00));
+    REQUIRE(high == u64(1));
+
+    u32 high32 = 0;
+    REQUIRE(Math::MultiplyExtended(u32(0x80000001), u32(6), high32) == u32(6));
+    REQUIRE(high32 == u32(3));
+
+    u8 high8 = 0;
+    REQUIRE(Math::MultiplyExtended(u8(200), u8(200), high8) == u8(64));
+    REQUIRE(high8 == u8(156));
+}
+
+TEST_CASE("Generate fills buffers", "[Math][Random]")
+{
+    SECTION("Uniform floats match single draws")
+    {
+        Math::Random64 rng(11);
+        Math::Random64 reference = rng;
+
+        Math::UniformUnitDistribution<f32> unit;
+        Math::UniformDistribution<f64> distribution(f64(-2.0), f64(3.0));
+
+        // Note(3011): Not a multiple of the block size.
+        std::vector<f32> units(1000);
+        std::vector<f64> values(333);
+        Math::Generate(rng, unit, units);
+        Math::Generate(rng, distribution, values);
+
+        for (f32 value : units)
+        {
+            REQUIRE(value == unit(reference));
+        }
+        for (f64 value : values)
+        {
+            REQUIRE(value == distribution(reference));
+        }
+        REQUIRE(rng() == reference());
+    }
+
+    SECTION("Bounded integers")
+    {
+        CheckBoundedIntegers<u32>(u32(0), u32(99), 200000);
+        CheckBoundedIntegers<i32>(i32(-5), i32(7), 100000);
+        CheckBoundedIntegers<u8>(u8(10), u8(12), 30000);
+        CheckBoundedIntegers<i64>(i64(-1000), i64(-990), 100000);
+        CheckBoundedIntegers<u64>(u64(0), u64(2), 30000);
+    }
+
+    SECTION("The full range passes the bits through")
+    {
+        Math::Random64 rng(5);
+        Math::Random64 reference = rng;
+
+        std::vector<u64> values(100);
+        Math::Generate(rng, Math::UniformDistribution<u64>(), values);
+        for (u64 value : values)
+        {
+            REQUIRE(value == reference());
+        }
+    }
+
+    SECTION("Distributions without a bulk path")
+    {
+        Math::Random32 rng(2);
+        Math::Random32 reference = rng;
+        Math::NormalDistribution<f32> distribution(f32(4.0f), f32(2.0f));
+
+        std::vector<f32> values(100);
+        Math::Generate(rng, distribution, values);
+        for (f32 value : values)
+        {
+            REQUIRE(value == distribution(reference));
+        }
+    }
+}
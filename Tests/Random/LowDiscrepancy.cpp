@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+using namespace Math::Types;
+
+namespace
+{
+    // Note(3011): The first base^k values of a dimension have to fall into
+    // different intervals of size base^-k.
+    template <typename Sampler>
+    void CheckStratified(const Sampler& sampler, Math::SizeType dimension, std::uint64_t base, int digits)
+    {
+        std::uint64_t count = 1;
+        for (int k = 1; k <= digits; ++k)
+        {
+            count *= base;
+
+            std::set<std::uint64_t> bins;
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                const std::uint64_t value = Math::ToUnderlying(sampler.Sample(u32(i), dimension));
+                bins.insert((value * count) >> 32);
+            }
+            REQUIRE(bins.size() == count);
+        }
+    }
+
+    // Note(3011): The first 4^k points of two dimensions have to fall into
+    // different cells of a 2^k by 2^k grid.
+    template <typename Sampler>
+    void CheckNet(const Sampler& sampler, Math::SizeType dimension, int levels)
+    {
+        for (int k = 1; k <= levels; ++k)
+        {
+            const std::uint64_t count = std::uint64_t(1) << (2 * k);
+            std::set<std::uint64_t> cells;
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                const std::uint64_t x = Math::ToUnderlying(sampler.Sample(u32(i), dimension)) >> (32 - k);
+                const std::uint64_t y = Math::ToUnderlying(sampler.Sample(u32(i), dimension + 1)) >> (32 - k);
+                cells.insert((y << k) | x);
+            }
+            REQUIRE(cells.size() == count);
+        }
+    }
+
+    // Note(3011): By the three distance theorem the gaps between the first
+    // values of a Kronecker sequence take at most three different lengths.
+    void CheckThreeGaps(const Math::R2Sampler& sampler, Math::SizeType dimension, std::uint64_t count)
+    {
+        std::vector<std::uint64_t> values;
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            values.push_back(Math::ToUnderlying(sampler.Sample(u32(i), dimension)));
+        }
+        std::sort(values.begin(), values.end());
+
+        std::set<std::uint64_t> gaps;
+        for (std::size_t i = 1; i < values.size(); ++i)
+        {
+            gaps.insert(values[i] - values[i - 1]);
+        }
+        gaps.insert(values.front() + (std::uint64_t(1) << 32) - values.back());
+        REQUIRE(gaps.size() <= 3);
+    }
+
+    template <typename Sampler>
+    void CheckSampler(u32 seed)
+    {
+        Sampler sampler(seed, u32(5));
+        for (Math::SizeType d = 0; d < 40; ++d)
+        {
+            REQUIRE(sampler.Dimension() == d);
+            REQUIRE(sampler() == sampler.Sample(u32(5), d));
+        }
+
+        const Sampler current = sampler.Jump();
+        REQUIRE(current.Index() == u32(5));
+        REQUIRE(sampler.Index() == u32(6));
+        REQUIRE(sampler.Dimension() == 0);
+        REQUIRE(sampler() == sampler.Sample(u32(6), 0));
+
+        const Sampler previous = sampler.LongJump();
+        REQUIRE(previous.Seed() == seed);
+        REQUIRE(sampler.Seed() != seed);
+
+        // Note(3011): Distributions read one dimension per f32.
+        Sampler drop(seed, u32(9));
+        Math::UniformUnitDistribution<f32> dist;
+        for (Math::SizeType d = 0; d < 8; ++d)
+        {
+            REQUIRE(dist(drop) == Math::Cast<f32>(drop.Sample(u32(9), d) >> 8) * 0x1.0p-24f);
+        }
+
+        // Note(3011): The mean over the pixels of an image.
+        double sum = 0;
+        for (u32 pixel = 0; pixel < 4096; ++pixel)
+        {
+            Sampler pixelSampler(pixel);
+            sum += Math::ToUnderlying(dist(pixelSampler));
+        }
+        REQUIRE(sum / 4096 > 0.48);
+        REQUIRE(sum / 4096 < 0.52);
+    }
+}
+
+TEST_CASE("Low-discrepancy sequences", "[Math][Random]")
+{
+    SECTION("Known values")
+    {
+        STATIC_REQUIRE(Math::SobolSampler::Sequence(u32(1), 0) == u32(0x80000000));
+        STATIC_REQUIRE(Math::SobolSampler::Sequence(u32(2), 0) == u32(0x40000000));
+        STATIC_REQUIRE(Math::SobolSampler::Sequence(u32(3), 0) == u32(0xC0000000));
+        STATIC_REQUIRE(Math::SobolSampler::Sequence(u32(2), 1) == u32(0xC0000000));
+        STATIC_REQUIRE(Math::SobolSampler::Sequence(u32(3), 1) == u32(0x40000000));
+
+        STATIC_REQUIRE(Math::HaltonSampler::Sequence(u32(1), 0) == u32(0x80000000));
+        STATIC_REQUIRE(Math::HaltonSampler::Sequence(u32(1), 1) == u32(0x55555555));
+        STATIC_REQUIRE(Math::HaltonSampler::Sequence(u32(3), 1) == u32(0x1C71C71C));
+        STATIC_REQUIRE(Math::HaltonSampler::Sequence(u32(2), 2) == u32(0x66666666));
+
+        STATIC_REQUIRE(Math::R2Sampler::Sequence(u32(1), 0) == u32(0xC13FA9A9));
+        STATIC_REQUIRE(Math::R2Sampler::Sequence(u32(1), 1) == u32(0x91E10DA5));
+    }
+
+    SECTION("Sobol")
+    {
+        for (u32 seed : { u32(0), u32(17), u32(0xDEADBEEF) })
+        {
+            const Math::SobolSampler sampler(seed);
+            for (Math::SizeType d = 0; d < 40; ++d)
+            {
+                CheckStratified(sampler, d, 2, 10);
+            }
+            CheckNet(sampler, 0, 5);
+            CheckNet(sampler, 16, 5);
+        }
+        CheckSampler<Math::SobolSampler>(u32(3));
+    }
+
+    SECTION("Halton")
+    {
+        const Math::HaltonSampler sampler(u32(23));
+        CheckStratified(sampler, 0, 2, 10);
+        CheckStratified(sampler, 1, 3, 6);
+        CheckStratified(sampler, 2, 5, 4);
+        CheckStratified(sampler, 9, 29, 2);
+        CheckStratified(sampler, 33, 3, 6);
+        CheckSampler<Math::HaltonSampler>(u32(3));
+    }
+
+    SECTION("R2")
+    {
+        const Math::R2Sampler sampler(u32(8));
+        for (Math::SizeType d = 0; d < 2; ++d)
+        {
+            CheckThreeGaps(Math::R2Sampler(), d, 100);
+            CheckThreeGaps(sampler, d, 1000);
+        }
+
+        // Note(3011): Shuffled pairs hold the same values for power of two
+        // counts.
+        std::multiset<std::uint64_t> first;
+        std::multiset<std::uint64_t> shuffled;
+        for (u32 i = 0; i < 256; ++i)
+        {
+            first.insert(Math::ToUnderlying(sampler.Sample(i, 0) - sampler.Sample(0, 0)));
+            shuffled.insert(Math::ToUnderlying(Math::R2Sampler::Sequence(i, 0)));
+        }
+        REQUIRE(first == shuffled);
+
+        CheckSampler<Math::R2Sampler>(u32(3));
+    }
+}
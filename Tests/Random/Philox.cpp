@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+using namespace Math::Types;
+
+namespace
+{
+    [[nodiscard]] constexpr
+    bool Same(const Math::Philox4x32::CounterType& a, const Math::Philox4x32::CounterType& b) noexcept
+    {
+        for (Math::SizeType i = 0; i < 4; ++i)
+        {
+            if (a[i] != b[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE("Philox4x32", "[Math][Random]")
+{
+    using Key = Math::Philox4x32::KeyType;
+    using Counter = Math::Philox4x32::CounterType;
+
+    SECTION("Known answers")
+    {
+        // Note(3011): The known answer vectors of the Random123 library.
+        STATIC_REQUIRE(Same(Math::Philox4x32::Block(Key(u32(0), u32(0)), Counter(u32(0), u32(0), u32(0), u32(0))),
+                            Counter(u32(0x6627E8D5), u32(0xE169C58D), u32(0xBC57AC4C), u32(0x9B00DBD8))));
+        REQUIRE(Same(Math::Philox4x32::Block(Key(u32::Max(), u32::Max()), Counter(u32::Max(), u32::Max(), u32::Max(), u32::Max())),
+                     Counter(u32(0x408F276D), u32(0x41C83B0E), u32(0xA20BC7C6), u32(0x6D5451FD))));
+        REQUIRE(Same(Math::Philox4x32::Block(Key(u32(0xA4093822), u32(0x299F31D0)), Counter(u32(0x243F6A88), u32(0x85A308D3), u32(0x13198A2E), u32(0x03707344))),
+                     Counter(u32(0xD16CFE09), u32(0x94FDCCEB), u32(0x5001E420), u32(0x24126EA1))));
+    }
+
+    SECTION("Sequential values are consecutive blocks")
+    {
+        Math::Philox4x32 rng(u64(0x1234), u64(7));
+        for (u32 block = 0; block < 10; ++block)
+        {
+            const Counter values = Math::Philox4x32::Block(Key(u32(0x1234), u32(0)), Counter(block, u32(0), u32(7), u32(0)));
+            for (Math::SizeType i = 0; i < 4; ++i)
+            {
+                REQUIRE(rng() == values[i]);
+            }
+        }
+        REQUIRE(rng.Position() == u64(40));
+        REQUIRE(rng.Stream() == u64(7));
+    }
+
+    SECTION("Random access")
+    {
+        Math::Philox4x32 rng(u64(99), u64(3));
+        for (int i = 0; i < 13; ++i)
+        {
+            static_cast<void>(rng());
+        }
+
+        Math::Philox4x32 direct(u64(99), u64(3), u64(13));
+        REQUIRE(direct.Position() == u64(13));
+        for (int i = 0; i < 20; ++i)
+        {
+            REQUIRE(rng() == direct());
+        }
+
+        direct.Seek(u64(13));
+        Math::Philox4x32 other(u64(99), u64(3), u64(13));
+        REQUIRE(direct() == other());
+    }
+
+    SECTION("Counter carries")
+    {
+        Math::Philox4x32 rng(Key(u32(1), u32(2)), Counter(u32::Max(), u32::Max(), u32(5), u32(0)));
+        for (int i = 0; i < 4; ++i)
+        {
+            static_cast<void>(rng());
+        }
+        REQUIRE(Same(rng.Counter(), Counter(u32(0), u32(0), u32(6), u32(0))));
+    }
+
+    SECTION("Jumps")
+    {
+        Math::Philox4x32 rng(u64(5), u64(0), u64(6));
+        const Math::Philox4x32 copy = rng;
+
+        Math::Philox4x32 previous = rng.Jump();
+        REQUIRE(previous() == Math::Philox4x32(copy)());
+        REQUIRE(rng.Stream() == u64(1));
+        REQUIRE(rng.Position() == u64(6));
+        REQUIRE(rng() == Math::Philox4x32(u64(5), u64(1), u64(6))());
+
+        static_cast<void>(rng.LongJump());
+        REQUIRE(rng.Stream() == (u64(1) << 32) + 1);
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Math::Types;
+
+namespace
+{
+    template <typename T, typename RNG>
+    void CheckMoments(RNG rng, double mean, int count)
+    {
+        const Math::PoissonDistribution<T> distribution(Math::Cast<typename Math::PoissonDistribution<T>::MeanType>(mean));
+
+        std::vector<T> values(static_cast<std::size_t>(count));
+        Math::Generate(rng, distribution, values);
+
+        double sum = 0;
+        double squares = 0;
+        for (T value : values)
+        {
+            const double v = static_cast<double>(Math::ToUnderlying(value));
+            sum += v;
+            squares += v * v;
+        }
+
+        const double measured = sum / count;
+        const double variance = squares / count - measured * measured;
+        REQUIRE(std::abs(measured - mean) < 5 * std::sqrt(mean / count));
+        REQUIRE(std::abs(variance / mean - 1) < 0.03);
+    }
+}
+
+TEST_CASE("PoissonDistribution", "[Math][Random]")
+{
+    SECTION("Moments")
+    {
+        for (double mean : { 0.5, 3.0, 9.9, 10.0, 47.5, 5000.0, 1e6 })
+        {
+            CheckMoments<u32>(Math::Random64(1), mean, 200000);
+            CheckMoments<u64>(Math::Random32(2), mean, 200000);
+        }
+    }
+
+    SECTION("Probabilities")
+    {
+        // Note(3011): Relative frequencies around the mode against the
+        // probability mass function.
+        const double mean = 20;
+        const Math::PoissonDistribution<u64> distribution(Math::Cast<f64>(mean));
+        Math::Random64 rng(3);
+
+        const int count = 1000000;
+        std::vector<int> histogram(64);
+        for (int i = 0; i < count; ++i)
+        {
+            const u64 value = distribution(rng);
+            if (value < u64(64))
+            {
+                ++histogram[static_cast<std::size_t>(Math::ToUnderlying(value))];
+            }
+        }
+
+        for (int k = 10; k <= 30; ++k)
+        {
+            const double p = std::exp(-mean + k * std::log(mean) - std::lgamma(k + 1.0));
+            const double frequency = static_cast<double>(histogram[static_cast<std::size_t>(k)]) / count;
+            REQUIRE(std::abs(frequency - p) < 5 * std::sqrt(p / count));
+        }
+    }
+
+    SECTION("Bulk generation matches single draws")
+    {
+        for (f32 mean : { f32(2.0f), f32(300.0f) })
+        {
+            Math::Random64 rng(4);
+            Math::Random64 reference = rng;
+            const Math::PoissonDistribution<u32> distribution(mean);
+
+            std::vector<u32> values(1000);
+            distribution.Generate(rng, std::span<u32>(values));
+            for (u32 value : values)
+            {
+                REQUIRE(value == distribution(reference));
+            }
+        }
+    }
+}
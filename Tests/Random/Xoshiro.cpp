@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Random.hpp>
+
+#include <vector>
+
+using namespace Math::Types;
+
+namespace
+{
+    template <typename RNG>
+    bool SameState(const RNG& a, const RNG& b)
+    {
+        for (Math::SizeType i = 0; i < 4; ++i)
+        {
+            if (a.State()[i] != b.State()[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename RNG>
+    void CheckAdvance()
+    {
+        for (u64 n : { u64(0), u64(1), u64(63), u64(64), u64(300), u64(1000), u64(123457) })
+        {
+            RNG advanced(7);
+            RNG stepped(7);
+            advanced.Advance(n);
+            for (u64 i = 0; i < n; ++i)
+            {
+                static_cast<void>(stepped());
+            }
+            REQUIRE(SameState(advanced, stepped));
+            REQUIRE(advanced() == stepped());
+        }
+
+        RNG once(11);
+        RNG twice(11);
+        once.Advance(u64(0x123456789ABCull) + u64(0xFEDCBA987ull));
+        twice.Advance(u64(0x123456789ABCull));
+        twice.Advance(u64(0xFEDCBA987ull));
+        REQUIRE(SameState(once, twice));
+    }
+
+    // Note(3011): Stream i has to be the generator after i jumps, and the
+    // generator has to continue after the last stream.
+    template <typename RNG>
+    void CheckSplit(Math::SizeType count)
+    {
+        RNG rng(3);
+        RNG jumped(3);
+        const std::vector<RNG> streams = rng.Split(count);
+        REQUIRE(streams.size() == Math::ToUnderlying(count));
+        for (const RNG& stream : streams)
+        {
+            REQUIRE(SameState(stream, jumped.Jump()));
+        }
+        REQUIRE(SameState(rng, jumped));
+    }
+}
+
+TEST_CASE("Xoshiro generators", "[Math][Random]")
+{
+    SECTION("Advance matches stepping")
+    {
+        CheckAdvance<Math::Xoshiro128StarStar>();
+        CheckAdvance<Math::Xoshiro256StarStar>();
+    }
+
+    SECTION("Advance by 2^64 is a jump of xoshiro128**")
+    {
+        Math::Xoshiro128StarStar advanced(5);
+        Math::Xoshiro128StarStar jumped(5);
+        advanced.Advance(u64(1) << 63);
+        advanced.Advance(u64(1) << 63);
+        static_cast<void>(jumped.Jump());
+        REQUIRE(SameState(advanced, jumped));
+    }
+
+    SECTION("Split returns consecutive jumps")
+    {
+        CheckSplit<Math::Xoshiro128StarStar>(0);
+        CheckSplit<Math::Xoshiro128StarStar>(5);
+        CheckSplit<Math::Xoshiro256StarStar>(5);
+
+        // Note(3011): Above 4W streams the jumps come from the table.
+        CheckSplit<Math::Xoshiro128StarStar>(300);
+        CheckSplit<Math::Xoshiro256StarStar>(600);
+    }
+}
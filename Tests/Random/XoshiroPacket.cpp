@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Packet.hpp>
+#include <Math/Random.hpp>
+
+using namespace Math::Types;
+
+namespace
+{
+    // Note(3011): Lane i has to continue the scalar generator with the same
+    // seed after i jumps.
+    template <typename PacketRNG, typename RNG>
+    void CheckLanes(PacketRNG rng, RNG scalar, Math::SizeType firstJump = 0)
+    {
+        for (Math::SizeType j = 0; j < firstJump; ++j)
+        {
+            static_cast<void>(scalar.Jump());
+        }
+
+        for (Math::SizeType i = 0; i < PacketRNG::Size; ++i)
+        {
+            RNG lane = scalar.Jump();
+            PacketRNG copy = rng;
+            for (int step = 0; step < 100; ++step)
+            {
+                REQUIRE(copy()[i] == lane());
+            }
+        }
+    }
+}
+
+TEST_CASE("Xoshiro packet generators", "[Math][Random]")
+{
+    SECTION("Lanes are jumped scalar streams")
+    {
+        CheckLanes(Math::Xoshiro128StarStarX4(3), Math::Xoshiro128StarStar(3));
+        CheckLanes(Math::Xoshiro128StarStarX8(4), Math::Xoshiro128StarStar(4));
+        CheckLanes(Math::Xoshiro256StarStarX4(5), Math::Xoshiro256StarStar(5));
+        CheckLanes(Math::Xoshiro256StarStarX8(6), Math::Xoshiro256StarStar(6));
+    }
+
+    SECTION("Jump advances every lane past the others")
+    {
+        Math::Xoshiro256StarStarX4 rng(9);
+        Math::Xoshiro256StarStarX4 first = rng.Jump();
+        CheckLanes(first, Math::Xoshiro256StarStar(9));
+        CheckLanes(rng, Math::Xoshiro256StarStar(9), 4);
+
+        Math::Xoshiro128StarStarX8 rng32(2);
+        static_cast<void>(rng32.LongJump());
+        Math::Xoshiro128StarStar lane = Math::Xoshiro128StarStarX8(2).Lane(5);
+        static_cast<void>(lane.LongJump());
+        REQUIRE(rng32()[5] == lane());
+    }
+
+    SECTION("Unit distribution on packets")
+    {
+        Math::UniformUnitDistribution<f32> distribution32;
+        Math::UniformUnitDistribution<f64> distribution64;
+
+        Math::Xoshiro256StarStarX8 rng(1);
+        Math::Xoshiro128StarStarX4 rng32(1);
+        for (int step = 0; step < 100; ++step)
+        {
+            Math::Xoshiro256StarStar lane = rng.Lane(3);
+            Math::Xoshiro128StarStar lane32 = rng32.Lane(2);
+
+            Math::Packet8f values = distribution32(rng);
+            Math::Packet<f64, 4> values64 = distribution64(rng32);
+            REQUIRE(values[3] == distribution32(lane));
+            REQUIRE(values64[2] == distribution64(lane32));
+
+            for (Math::SizeType i = 0; i < 8; ++i)
+            {
+                REQUIRE(values[i] >= 0.0f);
+                REQUIRE(values[i] < 1.0f);
+            }
+        }
+    }
+}
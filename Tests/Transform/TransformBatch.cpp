@@ -0,0 +1,169 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "TransformTestsCommon.hpp"
+#include <Math/Vector.hpp>
+#include <Math/Point.hpp>
+#include <Math/SoAArray.hpp>
+
+#include <vector>
+
+namespace
+{
+    // Note(3011): The SIMD kernels may fuse multiply-adds, so results can
+    // differ from operator* in the last bits.
+    constexpr Math::f32 Tolerance = 1e-4f;
+
+    Math::Transform3f MakeAffineTransform()
+    {
+        return Math::Translate(Math::Vector3f(1.0f, -2.0f, 0.5f))
+             * Math::RotateY(Math::f32(0.4f))
+             * Math::Scale(Math::Vector3f(2.0f, 0.5f, 3.0f));
+    }
+
+    Math::Point3f MakePoint(std::size_t i)
+    {
+        float s = static_cast<float>(i % 1024);
+        return Math::Point3f(s * 0.25f, 1.0f - s * 0.5f, 1.0f + s * 0.01f);
+    }
+
+    std::vector<Math::Point3f> MakePoints(std::size_t count)
+    {
+        std::vector<Math::Point3f> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            points[i] = MakePoint(i);
+        }
+        return points;
+    }
+}
+
+TEST_CASE("Batched transforms match operator*", "[Math][Transform]")
+{
+    const Math::Transform3f t = MakeAffineTransform();
+    const std::vector<Math::Point3f> points = MakePoints(37);
+
+    SECTION("Points")
+    {
+        std::vector<Math::Point3f> output(points.size());
+        Math::TransformPoints(t, points, output);
+
+        std::vector<Math::Point3f> inPlace = points;
+        Math::TransformPoints(t, inPlace);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Math::Equal(output[i], t * points[i], Tolerance));
+            REQUIRE(Math::Equal(inPlace[i], output[i], Tolerance));
+        }
+    }
+
+    SECTION("Vectors")
+    {
+        std::vector<Math::Vector3f> vectors(points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            vectors[i] = Math::Vector3f(points[i]);
+        }
+
+        std::vector<Math::Vector3f> output(vectors.size());
+        Math::TransformVectors(t, vectors, output);
+
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+        {
+            REQUIRE(Math::Equal(output[i], t * vectors[i], Tolerance));
+        }
+    }
+
+    SECTION("Normals stay perpendicular")
+    {
+        std::vector<Math::Vector3f> tangents = {
+            Math::Normalize(Math::Vector3f(1.0f, 1.0f, 0.0f)),
+            Math::Normalize(Math::Vector3f(0.0f, 2.0f, -1.0f)),
+        };
+        std::vector<Math::Vector3f> normals = {
+            Math::Normalize(Math::Vector3f(1.0f, -1.0f, 0.0f)),
+            Math::Normalize(Math::Vector3f(0.0f, 1.0f, 2.0f)),
+        };
+
+        Math::TransformVectors(t, tangents);
+        Math::TransformNormals(t, normals);
+
+        for (std::size_t i = 0; i < normals.size(); ++i)
+        {
+            REQUIRE(Math::Equal(Math::Dot(tangents[i], normals[i]), Math::f32(0.0f), Tolerance));
+        }
+    }
+
+    SECTION("Projective transforms")
+    {
+        auto projection = Math::PerspectiveProjection(Math::f32(1.0f), Math::f32(1.5f), Math::f32(0.1f), Math::f32(100.0f));
+
+        std::vector<Math::Point3f> output(points.size());
+        Math::TransformPoints(projection, points, output);
+
+        Math::SoAArray<Math::Point3f> soa(points);
+        Math::SoAArray<Math::Point3f> soaOutput;
+        Math::TransformPoints(projection, soa, soaOutput);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Math::Equal(output[i], projection * points[i], Tolerance));
+            REQUIRE(Math::Equal(soaOutput.Get(i), output[i], Tolerance));
+        }
+    }
+}
+
+TEST_CASE("Batched transforms on SoA arrays", "[Math][Transform][SoAArray]")
+{
+    SECTION("3D points and vectors")
+    {
+        const Math::Transform3f t = MakeAffineTransform();
+        const std::vector<Math::Point3f> points = MakePoints(133);
+
+        Math::SoAArray<Math::Point3f> soa(points);
+        Math::TransformPoints(t, soa);
+
+        Math::SoAArray3f vectors(133, Math::Vector3f(1.0f, 2.0f, 3.0f));
+        Math::SoAArray3f vectorOutput;
+        Math::TransformVectors(t, vectors, vectorOutput);
+        REQUIRE(vectorOutput.Size() == 133);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Math::Equal(soa.Get(i), t * points[i], Tolerance));
+            REQUIRE(Math::Equal(vectorOutput.Get(i), t * Math::Vector3f(1.0f, 2.0f, 3.0f), Tolerance));
+        }
+    }
+
+    SECTION("2D points")
+    {
+        const Math::Transform2f t = MakeTransform2f1();
+
+        Math::SoAArray<Math::Point2f> soa(5, Math::Point2f(1.0f, -1.0f));
+        Math::TransformPoints(t, soa);
+
+        REQUIRE(Math::Equal(soa.Get(4), t * Math::Point2f(1.0f, -1.0f), Tolerance));
+    }
+}
+
+TEST_CASE("Large parallel batched transforms", "[Math][Transform]")
+{
+    // Note(3011): Large enough to use streaming stores and several threads.
+    const Math::Transform3f t = MakeAffineTransform();
+    const std::vector<Math::Point3f> points = MakePoints(400001);
+
+    std::vector<Math::Point3f> output(points.size());
+    Math::TransformPoints<Math::Execution::Parallel>(t, points, output);
+
+    Math::SoAArray<Math::Point3f> soa(points);
+    Math::TransformPoints<Math::Execution::Parallel>(t, soa);
+
+    bool matches = true;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        matches = matches
+               && Math::Equal(output[i], t * points[i], Tolerance)
+               && Math::Equal(soa.Get(i), output[i], Tolerance);
+    }
+    REQUIRE(matches);
+}
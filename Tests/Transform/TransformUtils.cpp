@@ -3,6 +3,7 @@
 #include "TransformTestsCommon.hpp"
 #include <Math/Vector.hpp>
 #include <Math/Point.hpp>
+#include <Math/Matrix.hpp>
 
 // TODO(3011): Complete tests for 3D projections
 
@@ -94,6 +95,44 @@ TEST_CASE("Test 3D transform helpers")
     }
 }
 
+TEST_CASE("Test transform inverses", "[Math][Transform]")
+{
+    SECTION("Affine 2D")
+    {
+        Math::Transform2f t = Math::Translate(Math::Vector2f(1.0f, -2.0f))
+                            * Math::ShearX(Math::f32(0.5f))
+                            * Math::Scale(Math::Vector2f(2.0f, 3.0f));
+        Math::Transform2f inverse = Math::Invert(t);
+
+        Math::Point2f p(3.0f, 4.0f);
+        REQUIRE(Math::Equal(inverse * (t * p), p));
+        REQUIRE(Math::Equal((t * inverse).ToMatrix(), Math::Matrix3f(1.0f)));
+    }
+
+    SECTION("Affine 3D")
+    {
+        Math::Transform3f t = Math::Translate(Math::Vector3f(1.0f, 2.0f, 3.0f))
+                            * Math::RotateY(Math::f32(0.3f))
+                            * Math::Scale(Math::Vector3f(2.0f, 0.5f, 4.0f));
+        Math::Transform3f inverse = Math::Invert(t);
+
+        REQUIRE(Math::Equal((t * inverse).ToMatrix(), Math::Matrix4f(1.0f)));
+        REQUIRE(Math::Equal(inverse.ToMatrix(), Math::Invert(t.ToMatrix())));
+    }
+
+    SECTION("Rigid 3D")
+    {
+        Math::Transform3f t = Math::Translate(Math::Vector3f(-4.0f, 0.5f, 2.0f))
+                            * Math::RotateX(Math::f32(1.2f))
+                            * Math::RotateZ(Math::f32(-0.7f));
+        Math::Transform3f inverse = Math::InvertRigid(t);
+
+        Math::Point3f p(1.0f, -2.0f, 5.0f);
+        REQUIRE(Math::Equal(inverse * (t * p), p));
+        REQUIRE(Math::Equal(inverse.ToMatrix(), Math::Invert(t).ToMatrix()));
+    }
+}
+
 TEST_CASE("Test 3D LookAt transform")
 {
     SECTION("Basic parameters")
@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Vector.hpp>
+#include <Math/Packet.hpp>
+#include <Math/Implementation/Functions/Equal.hpp>
+
+namespace
+{
+    // Note(3011): Every lane of a packet result has to match the result of
+    // the scalar code on the corresponding lane.
+    template <typename VecPacket, typename Func>
+    bool MatchesScalar(const VecPacket& result, Func&& func)
+    {
+        for (Math::SizeType i = 0; i < VecPacket::Size; ++i)
+        {
+            if (!Math::Equal(result.Lane(i), func(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename P, typename Func>
+    bool MatchesScalarLanes(const P& result, Func&& func)
+    {
+        for (Math::SizeType i = 0; i < P::Size; ++i)
+        {
+            if (!Math::Equal(result[i], func(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Math::Vector3f Input(Math::SizeType i, float offset)
+    {
+        float s = static_cast<float>(Math::ToUnderlying(i)) + offset;
+        return Math::Vector3f(s, 2.0f - s, 0.5f * s + 1.0f);
+    }
+}
+
+TEST_CASE("Packet arithmetic", "[Math][Packet]")
+{
+    SECTION("Lane-wise operators")
+    {
+        Math::Packet8f a = Math::Packet8f::Sequence(1.0f, 1.0f);
+        Math::Packet8f b(2.0f);
+
+        REQUIRE(MatchesScalarLanes(a + b, [](Math::SizeType i) { return Math::Cast<Math::f32>(i) + 3.0f; }));
+        REQUIRE(MatchesScalarLanes(a - b, [](Math::SizeType i) { return Math::Cast<Math::f32>(i) - 1.0f; }));
+        REQUIRE(MatchesScalarLanes(a * b, [](Math::SizeType i) { return Math::Cast<Math::f32>(i) * 2.0f + 2.0f; }));
+        REQUIRE(MatchesScalarLanes(a / b, [](Math::SizeType i) { return (Math::Cast<Math::f32>(i) + 1.0f) / 2.0f; }));
+        REQUIRE(MatchesScalarLanes(-a, [](Math::SizeType i) { return -(Math::Cast<Math::f32>(i) + 1.0f); }));
+        REQUIRE(MatchesScalarLanes(2 * a, [](Math::SizeType i) { return Math::Cast<Math::f32>(i) * 2.0f + 2.0f; }));
+
+        a += 1.0f;
+        REQUIRE(Math::Equal(a.Sum(), 44.0f));
+        REQUIRE(Math::Equal(a.Min(), 2.0f));
+        REQUIRE(Math::Equal(a.Max(), 9.0f));
+    }
+
+    SECTION("Load and store")
+    {
+        const Math::f64 input[4] = { 1.0, 4.0, 9.0, 16.0 };
+        Math::f64 output[4] = {};
+
+        Math::Packet4d p = Math::Packet4d::Load(input);
+        Math::Sqrt(p).Store(output);
+
+        REQUIRE(Math::Equal(output[0], 1.0));
+        REQUIRE(Math::Equal(output[1], 2.0));
+        REQUIRE(Math::Equal(output[2], 3.0));
+        REQUIRE(Math::Equal(output[3], 4.0));
+    }
+
+    SECTION("Integer packets")
+    {
+        Math::Packet4u a(1u, 2u, 3u, 4u);
+        Math::Packet4u b = (a << Math::u32(2)) | Math::Packet4u(1u);
+
+        REQUIRE(b[0] == 5u);
+        REQUIRE(b[3] == 17u);
+        REQUIRE((b % Math::Packet4u(4u)).Sum() == 4u);
+    }
+
+    SECTION("Constant evaluation")
+    {
+        constexpr Math::Packet4f a(1.0f, 2.0f, 3.0f, 4.0f);
+        constexpr Math::Packet4f b = a * a + 1.0f;
+        static_assert(b[3] == 17.0f);
+        REQUIRE(b[0] == 2.0f);
+    }
+}
+
+TEST_CASE("Packet masks and select", "[Math][Packet]")
+{
+    Math::Packet4f a(1.0f, -2.0f, 3.0f, -4.0f);
+    Math::Packet4f zero(0.0f);
+
+    auto positive = a > zero;
+    REQUIRE(positive[0]);
+    REQUIRE(!positive[1]);
+    REQUIRE(positive.Count() == 2);
+    REQUIRE(Math::Any(positive));
+    REQUIRE(!Math::All(positive));
+    REQUIRE(Math::All(positive | !positive));
+    REQUIRE(Math::None(positive & !positive));
+
+    Math::Packet4f selected = Math::Select(positive, a, zero);
+    REQUIRE(Math::Equal(selected.Sum(), 4.0f));
+
+    REQUIRE(Math::Equal(Math::Abs(a).Sum(), 10.0f));
+    REQUIRE(Math::Equal(Math::Sign(a).Sum(), 0.0f));
+    REQUIRE(Math::Equal(Math::Max(a, zero).Sum(), 4.0f));
+    REQUIRE(Math::Equal(Math::Min(a, zero).Sum(), -6.0f));
+    REQUIRE(Math::Equal(Math::Clamp(a).Sum(), 2.0f));
+}
+
+TEST_CASE("Vector3 packets match scalar vectors", "[Math][Vector][Packet]")
+{
+    Math::Vector3f inputA[8];
+    Math::Vector3f inputB[8];
+    for (Math::SizeType i = 0; i < 8; ++i)
+    {
+        inputA[Math::ToUnderlying(i)] = Input(i, 1.0f);
+        inputB[Math::ToUnderlying(i)] = Input(i, -3.5f);
+    }
+
+    Math::Vector3Packet8f u = Math::Vector3Packet8f::Load(inputA);
+    Math::Vector3Packet8f v = Math::Vector3Packet8f::Load(inputB);
+    auto a = [&](Math::SizeType i) { return inputA[Math::ToUnderlying(i)]; };
+    auto b = [&](Math::SizeType i) { return inputB[Math::ToUnderlying(i)]; };
+
+    SECTION("Operators")
+    {
+        REQUIRE(MatchesScalar(u + v, [&](Math::SizeType i) { return a(i) + b(i); }));
+        REQUIRE(MatchesScalar(u - v, [&](Math::SizeType i) { return a(i) - b(i); }));
+        REQUIRE(MatchesScalar(u * v, [&](Math::SizeType i) { return a(i) * b(i); }));
+        REQUIRE(MatchesScalar(-u, [&](Math::SizeType i) { return -a(i); }));
+        REQUIRE(MatchesScalar(u * 2.0f, [&](Math::SizeType i) { return a(i) * 2.0f; }));
+        REQUIRE(MatchesScalar(3.0f - u, [&](Math::SizeType i) { return 3.0f - a(i); }));
+
+        Math::Vector3Packet8f w = u;
+        w += v;
+        w /= 2.0f;
+        REQUIRE(MatchesScalar(w, [&](Math::SizeType i) { return (a(i) + b(i)) / 2.0f; }));
+    }
+
+    SECTION("Utilities")
+    {
+        Math::Packet8f dot = Math::Dot(u, v);
+        REQUIRE(MatchesScalarLanes(dot, [&](Math::SizeType i) { return Math::Dot(a(i), b(i)); }));
+        REQUIRE(MatchesScalarLanes(u.Length(), [&](Math::SizeType i) { return a(i).Length(); }));
+
+        REQUIRE(MatchesScalar(Math::Cross(u, v), [&](Math::SizeType i) { return Math::Cross(a(i), b(i)); }));
+        REQUIRE(MatchesScalar(Math::Normalize(u), [&](Math::SizeType i) { return Math::Normalize(a(i)); }));
+        REQUIRE(MatchesScalar(Math::Reflect(u, v), [&](Math::SizeType i) { return Math::Reflect(a(i), b(i)); }));
+    }
+
+    SECTION("Refract")
+    {
+        Math::Vector3Packet8f n(Math::Vector3f::UnitZ());
+        Math::Vector3Packet8f d = Math::Normalize(u);
+
+        // Note(3011): A large eta makes some lanes totally internally reflect.
+        for (float eta : { 0.75f, 3.0f })
+        {
+            Math::Vector3Packet8f refracted = Math::Refract(d, n, Math::Packet8f(eta));
+            REQUIRE(MatchesScalar(refracted, [&](Math::SizeType i)
+            {
+                return Math::Refract(Math::Normalize(a(i)), Math::Vector3f::UnitZ(), Math::f32(eta));
+            }));
+        }
+    }
+
+    SECTION("Select and store")
+    {
+        auto mask = u.x > v.x + 5.0f;
+        Math::Vector3Packet8f selected = Math::Select(mask, u, v);
+        REQUIRE(MatchesScalar(selected, [&](Math::SizeType i) { return mask[i] ? a(i) : b(i); }));
+
+        Math::Vector3f output[8];
+        selected.Store(output);
+        for (Math::SizeType i = 0; i < 8; ++i)
+        {
+            REQUIRE(Math::Equal(output[Math::ToUnderlying(i)], selected.Lane(i)));
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Math/Vector.hpp>
+#include <Math/Implementation/Functions/Equal.hpp>
+
+// Note(3011): The constexpr values below are always computed by the scalar
+// code, while the runtime values go through the SIMD backend when it is
+// enabled (MATHLIB_ENABLE_SIMD). Both paths have to agree.
+
+TEST_CASE("Vector arithmetic matches constant evaluation", "[Math][Vector][SIMD]")
+{
+    SECTION("Vector3f")
+    {
+        constexpr Math::Vector3f a(1.0f, -2.0f, 3.5f);
+        constexpr Math::Vector3f b(4.0f, 0.5f, -6.0f);
+        Math::Vector3f u = a;
+        Math::Vector3f v = b;
+
+        constexpr Math::Vector3f sum = a + b;
+        constexpr Math::Vector3f difference = a - b;
+        constexpr Math::Vector3f product = a * b;
+        constexpr Math::Vector3f quotient = a / b;
+        constexpr Math::Vector3f negated = -a;
+        constexpr Math::Vector3f scaled = a * 3.0f;
+        constexpr Math::Vector3f divided = 2.0f / a;
+
+        REQUIRE(Math::Equal(u + v, sum));
+        REQUIRE(Math::Equal(u - v, difference));
+        REQUIRE(Math::Equal(u * v, product));
+        REQUIRE(Math::Equal(u / v, quotient));
+        REQUIRE(Math::Equal(-u, negated));
+        REQUIRE(Math::Equal(u * 3.0f, scaled));
+        REQUIRE(Math::Equal(3.0f * u, scaled));
+        REQUIRE(Math::Equal(2.0f / u, divided));
+    }
+
+    SECTION("Vector4f")
+    {
+        constexpr Math::Vector4f a(1.0f, -2.0f, 3.5f, 8.0f);
+        constexpr Math::Vector4f b(4.0f, 0.5f, -6.0f, 2.0f);
+        Math::Vector4f u = a;
+        Math::Vector4f v = b;
+
+        constexpr Math::Vector4f sum = a + b;
+        constexpr Math::Vector4f difference = a - b;
+        constexpr Math::Vector4f product = a * b;
+        constexpr Math::Vector4f quotient = a / b;
+        constexpr Math::Vector4f shifted = 1.0f - a;
+
+        REQUIRE(Math::Equal(u + v, sum));
+        REQUIRE(Math::Equal(u - v, difference));
+        REQUIRE(Math::Equal(u * v, product));
+        REQUIRE(Math::Equal(u / v, quotient));
+        REQUIRE(Math::Equal(1.0f - u, shifted));
+    }
+
+    SECTION("Vector4d")
+    {
+        constexpr Math::Vector4d a(1.0, -2.0, 3.5, 8.0);
+        constexpr Math::Vector4d b(4.0, 0.5, -6.0, 2.0);
+        Math::Vector4d u = a;
+        Math::Vector4d v = b;
+
+        constexpr Math::Vector4d sum = a + b;
+        constexpr Math::Vector4d quotient = a / b;
+
+        REQUIRE(Math::Equal(u + v, sum));
+        REQUIRE(Math::Equal(u / v, quotient));
+    }
+}
+
+TEST_CASE("Vector utilities match constant evaluation", "[Math][Vector][SIMD]")
+{
+    SECTION("Dot")
+    {
+        constexpr Math::Vector3f a(1.0f, 2.0f, 3.0f);
+        constexpr Math::Vector3f b(4.0f, -5.0f, 6.0f);
+        Math::Vector3f u = a;
+        Math::Vector3f v = b;
+        REQUIRE(Math::Equal(Math::Dot(u, v), 12.0f));
+
+        Math::Vector4f p(1.0f, 2.0f, 3.0f, 4.0f);
+        Math::Vector4f q(5.0f, 6.0f, 7.0f, 8.0f);
+        REQUIRE(Math::Equal(Math::Dot(p, q), 70.0f));
+    }
+
+    SECTION("Cross")
+    {
+        constexpr Math::Vector3f a(1.0f, 2.0f, 3.0f);
+        constexpr Math::Vector3f b(4.0f, -5.0f, 6.0f);
+        constexpr Math::Vector3f right = Math::Cross(a, b);
+        constexpr Math::Vector3f left = Math::Cross<Math::Orientation::Left>(a, b);
+        Math::Vector3f u = a;
+        Math::Vector3f v = b;
+        REQUIRE(Math::Equal(Math::Cross(u, v), right));
+        REQUIRE(Math::Equal(Math::Cross<Math::Orientation::Left>(u, v), left));
+
+        Math::Vector3d x = Math::Vector3d::UnitX();
+        Math::Vector3d y = Math::Vector3d::UnitY();
+        REQUIRE(Math::Equal(Math::Cross(x, y), Math::Vector3d::UnitZ()));
+    }
+
+    SECTION("Normalize")
+    {
+        Math::Vector3f u(3.0f, 0.0f, 4.0f);
+        REQUIRE(Math::Equal(Math::Normalize(u), Math::Vector3f(0.6f, 0.0f, 0.8f)));
+
+        Math::Vector4f v(2.0f, 2.0f, 2.0f, 2.0f);
+        REQUIRE(Math::Equal(Math::Normalize(v), Math::Vector4f(0.5f)));
+    }
+}
+
+TEST_CASE("Vector3 stores do not touch neighbouring memory", "[Math][Vector][SIMD]")
+{
+    Math::Vector3f buffer[3] = {
+        Math::Vector3f(1.0f),
+        Math::Vector3f(2.0f),
+        Math::Vector3f(3.0f),
+    };
+
+    buffer[1] += Math::Vector3f(1.0f, 2.0f, 3.0f);
+    buffer[1] *= 2.0f;
+
+    REQUIRE(Math::Equal(buffer[0], Math::Vector3f(1.0f)));
+    REQUIRE(Math::Equal(buffer[1], Math::Vector3f(6.0f, 8.0f, 10.0f)));
+    REQUIRE(Math::Equal(buffer[2], Math::Vector3f(3.0f)));
+}